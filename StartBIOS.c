@@ -8,6 +8,11 @@
 #include "local_inc/UART_Task.h"
 #include "local_inc/heartrate.h"
 #include "local_inc/broker.h"
+#include "local_inc/timestamp.h"
+#include "local_inc/history.h"
+#include "local_inc/recorder.h"
+#include "local_inc/telemetry.h"
+#include "local_inc/boot.h"
 
 int main(void)
 {
@@ -16,27 +21,49 @@ int main(void)
     ui32SysClock = Board_initGeneral(120*1000*1000);
     (void)ui32SysClock; // We don't really need this (yet)
 
+    // time base for the sample timestamps, before any task can use it
+    timestamp_init();
+    // boot stage gates, the tasks below signal and wait for them, their order does not matter
+    boot_init();
+    // heart rate history, filled by the estimators from the start
+    history_init();
+
     Board_initI2C();
     Board_initSPI();
     Board_initGPIO();
+    // Ethernet for the telemetry, the NDK brings the interface up after BIOS_start.
+    // initSPI takes the Ethernet LED pins (PF0, PF4) back as GPIO for the OLED status LEDs
+    Board_initEMAC();
+    // only the SD card port, the stock Board_initSDSPI takes the OLED SPI and the pins of sensor 0
+    Board_initSDSPI1();
 
     // init the SPI with the actual system clock
     initSPI(ui32SysClock);
+    // Starting the Broker Task, creates all mailboxes before any task runs
+    setup_Broker_task("Broker Task", 5);
+    System_printf("Created Startup Broker Task\n");
+    System_flush();
+    // The subsystems below initialize concurrently, every one signals its boot stage.
+    // The sensors come first, tasks of equal priority start in the order of creation and
+    // the sensor initialization is on the path to the first heart rate.
+    create_heartrate_tasks(5);
+    System_printf("Created startup Heartrate Task\n");
+    System_flush();
     // Starting the UART Task: sending char and displaying
     setup_UART_Task("UART Task", 5);
     System_printf("Created Startup UART Task\n");
     System_flush();
-    // Starting the Broker Task: receiving char and displaying
-    setup_Broker_task("Broker Task", 5);
-    System_printf("Created Startup Broker Task\n");
-    System_flush();
-    // Starting the OLED Task: receiving char and displaying
+    // Starting the OLED Task: receiving char and displaying, powers up while the sensors start
     setup_OLED_task("Startup_Oled", 5);
     System_printf("Created Startup Oled Task\n");
     System_flush();
-    //create heartrate main task
-    create_heartrate_tasks(5);
-    System_printf("Created startup Heartrate Task\n");
+    // Starting the Recorder Task: below the others, a slow SD card only delays the recording
+    setup_Recorder_task("Recorder Task", 4);
+    System_printf("Created Startup Recorder Task\n");
+    System_flush();
+    // Starting the Telemetry Task: reads the sample rings on its own, never delays the acquisition
+    setup_Telemetry_task("Telemetry Task", 4);
+    System_printf("Created Startup Telemetry Task\n");
     System_flush();
 
     /* Start BIOS */
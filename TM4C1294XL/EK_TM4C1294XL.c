@@ -291,7 +291,10 @@ GPIO_PinConfig gpioPinConfigs[] = {
     /* EK_TM4C1294XL_USR_SW2 */
     GPIOTiva_PJ_1 | GPIO_CFG_IN_PU | GPIO_CFG_IN_INT_RISING,
 
+    /* EK_TM4C1294XL_CLICK_2, interrupt of the heartrate click on BoosterPack 2 */
     GPIOTiva_PD_4 | GPIO_CFG_IN_PU | GPIO_CFG_IN_INT_FALLING,
+    /* EK_TM4C1294XL_CLICK_1, interrupt of the second heartrate click */
+    GPIOTiva_PC_6 | GPIO_CFG_IN_PU | GPIO_CFG_IN_INT_FALLING,
 
     /* Output pins */
     /* EK_TM4C1294XL_USR_D1 */
@@ -310,7 +313,8 @@ GPIO_PinConfig gpioPinConfigs[] = {
 GPIO_CallbackFxn gpioCallbackFunctions[] = {
     NULL,  /* EK_TM4C1294XL_USR_SW1 */
     NULL,   /* EK_TM4C1294XL_USR_SW2 */
-    NULL
+    NULL,   /* EK_TM4C1294XL_CLICK_2 */
+    NULL    /* EK_TM4C1294XL_CLICK_1 */
 };
 
 /* The device-specific GPIO_config structure */
@@ -348,6 +352,9 @@ I2CTiva_Object i2cTivaObjects[EK_TM4C1294XL_I2CCOUNT];
 
 /* I2C configuration structure, describing which pins are to be used */
 const I2CTiva_HWAttrs i2cTivaHWAttrs[EK_TM4C1294XL_I2CCOUNT] = {
+#if I2CM_0
+    {I2C0_BASE, INT_I2C0, ~0 /* Interrupt priority */},
+#endif
 #if I2CM_7
     {I2C7_BASE, INT_I2C7, ~0 /* Interrupt priority */},
 #endif
@@ -357,6 +364,9 @@ const I2CTiva_HWAttrs i2cTivaHWAttrs[EK_TM4C1294XL_I2CCOUNT] = {
 };
 
 const I2C_Config I2C_config[] = {
+#if I2CM_0
+    {&I2CTiva_fxnTable, &i2cTivaObjects[EK_TM4C1294XL_I2C0], &i2cTivaHWAttrs[EK_TM4C1294XL_I2C0]},
+#endif
 #if I2CM_7
     {&I2CTiva_fxnTable, &i2cTivaObjects[EK_TM4C1294XL_I2C7], &i2cTivaHWAttrs[EK_TM4C1294XL_I2C7]},
 #endif
@@ -371,6 +381,17 @@ const I2C_Config I2C_config[] = {
  */
 void EK_TM4C1294XL_initI2C(void)
 {
+    /* I2C0 Init */
+    /* Enable the peripheral */
+#if I2CM_0
+	SysCtlPeripheralEnable(SYSCTL_PERIPH_I2C0);
+
+	/* Configure the appropriate pins to be I2C instead of GPIO. */
+	GPIOPinConfigure(GPIO_PB2_I2C0SCL);
+	GPIOPinConfigure(GPIO_PB3_I2C0SDA);
+	GPIOPinTypeI2CSCL(GPIO_PORTB_BASE, GPIO_PIN_2);
+	GPIOPinTypeI2C(GPIO_PORTB_BASE, GPIO_PIN_3);
+#endif
     /* I2C7 Init */
     /*
      * NOTE: TI-RTOS examples configure pins PD0 & PD1 for SSI2 or I2C7.  Thus,
@@ -556,6 +577,37 @@ void EK_TM4C1294XL_initSDSPI(void)
     SDSPI_init();
 }
 
+/*
+ *  ======== EK_TM4C1294XL_initSDSPI1 ========
+ *  Only the SD card on SSI3 (SDSPI1). EK_TM4C1294XL_initSDSPI also muxes SSI2
+ *  with chip select PH2, the port of the OLED, and turns PA2/PA3 into inputs,
+ *  the I2C8 bus of the first heart rate sensor.
+ */
+void EK_TM4C1294XL_initSDSPI1(void)
+{
+    /* Enable the peripherals used by the SD Card */
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_SSI3);
+
+    /* Configure pad settings */
+    GPIOPadConfigSet(GPIO_PORTQ_BASE,
+                     GPIO_PIN_0 | GPIO_PIN_2,
+                     GPIO_STRENGTH_4MA, GPIO_PIN_TYPE_STD);
+
+    GPIOPadConfigSet(GPIO_PORTQ_BASE,
+                     GPIO_PIN_3,
+                     GPIO_STRENGTH_4MA, GPIO_PIN_TYPE_STD_WPU);
+
+    GPIOPadConfigSet(GPIO_PORTP_BASE,
+                     GPIO_PIN_4,
+                     GPIO_STRENGTH_4MA, GPIO_PIN_TYPE_STD);
+
+    GPIOPinConfigure(GPIO_PQ0_SSI3CLK);
+    GPIOPinConfigure(GPIO_PQ3_SSI3XDAT1);
+    GPIOPinConfigure(GPIO_PQ2_SSI3XDAT0);
+
+    SDSPI_init();
+}
+
 /*
  *  =============================== SPI ===============================
  */
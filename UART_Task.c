@@ -7,13 +7,24 @@
 // ----------------------------------------------------------------------------- includes ---
 #include "local_inc/common.h"
 #include "local_inc/UART_Task.h"
+#include "local_inc/boot.h"
+#include "local_inc/command.h"
 //! \addtogroup group_comm
 //! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief received bytes the callback keeps until the task takes them, power of two
+#define UART_RX_SIZE 128
 // ------------------------------------------------------------------------------ globals ---
-Semaphore_Handle sem;
 uint8_t input;
+//! \brief received bytes, filled by the read callback, emptied by the task
+static uint8_t rxRing[UART_RX_SIZE];
+static volatile uint16_t rxHead;
+static volatile uint16_t rxTail;
+// statistics
+static uint32_t rxOverruns;
 // ---------------------------------------------------------------------------- functions ---
 static void outputMenu(void);
+static void receive(uint8_t byte);
 static void UARTreadCallback(UART_Handle, void *buf, size_t count);
 
 // ----------------------------------------------------------------------- implementation ---
@@ -21,16 +32,16 @@ static void UARTreadCallback(UART_Handle, void *buf, size_t count);
 /*!
  * \brief UART Task receives keystrokes from an attached Terminal via UART
  * The keystroke get tested, and if the comply with the valid chars the char get appended to
- * the global char buffer. And a semaphore get posted
+ * the global char buffer. Command frames of host tools are put together here and handed to
+ * the broker as a whole. The task sleeps on its Event until a char arrived or the broker
+ * has something to write.
  */
 void UARTFxn(UArg arg0, UArg arg1)
 {
-    char UARTwrite[3];
-    Error_Block er;
-    Semaphore_Params params;
-    Semaphore_Params_init(&params);
-
-    sem = Semaphore_create(0, &params, &er);
+    char UARTwrite[BROKER_WRITE_SIZE];
+    commandFrame ack;
+    uint8_t frame[COMMAND_FRAME_SIZE];
+    unsigned int events;
 
     UART_Handle uart;
     UART_Params uartParams;
@@ -50,6 +61,7 @@ void UARTFxn(UArg arg0, UArg arg1)
     if (uart == NULL) {
         System_abort("Error opening the UART");
     }
+    boot_signal(BOOT_UART);
 
     UART_write(uart, echoPrompt, sizeof(echoPrompt));
 
@@ -58,25 +70,19 @@ void UARTFxn(UArg arg0, UArg arg1)
     UART_read(uart, &input, 1);
     /* Loop forever echoing */
     while (1) {
+        events = Event_pend(uartEvent, Event_Id_NONE, UART_EVENT_READ | UART_EVENT_WRITE | UART_EVENT_ACK,
+                            BIOS_WAIT_FOREVER);
 
-        if(Semaphore_pend(sem, 1))
+        if (events & UART_EVENT_READ)
         {
-            // Keystroke in the valid region, send it to broker otherwise just ignore it
-            if (input >= 0x08 && input <= 0x7F) {
-                // inputChar is the shared memory in broker to wait for any input
-                Mailbox_post(brokerRead, &input, BIOS_WAIT_FOREVER);
-
-            }
-
-            UART_read(uart, &input, 1);
+            while (rxTail != rxHead)
+                receive(rxRing[rxTail++ & (UART_RX_SIZE - 1)]);
         }
 
-
-
-        if(Mailbox_pend(brokerWrite, UARTwrite, BIOS_NO_WAIT))
-            UART_write(uart, UARTwrite, 4);
-
-        Task_yield();
+        while (queue_take(&brokerWrite, UARTwrite))
+            UART_write(uart, UARTwrite, strlen(UARTwrite));
+        while (queue_take(&ackMailbox, &ack))
+            UART_write(uart, frame, command_encode(&ack, frame));
     }
 
 }
@@ -122,19 +128,59 @@ static void outputMenu(void) {
     System_printf("#1 Heart rate (Input) In -> UART out\n");
     System_printf("#2 UART In -> OLED C (Output) out\n");
     System_printf("#3 Toggle OLED- Display on/ off\n");
+    System_printf("#4 Heart rate trend of the last hour -> OLED C (Output) out\n");
+    System_printf("#5 Print acquisition statistics\n");
+    System_printf("#6 Toggle acquisition interrupt/ timer\n");
+    System_printf("#7 Print heart rate history (minute, hour, day)\n");
+    System_printf("#8 Start/ stop recording to SD card\n");
+    System_printf("#9 Toggle heart rate estimator beats/ FFT\n");
     System_printf("Select needed by providing leading '#' before number.\n");
+    System_printf("Host tools send framed commands, see local_inc/command.h\n");
+    System_flush();
+}
+
+/*!
+ * \brief print lost input, what the broker did not take counts in its queues
+ */
+void UART_printStatistics(void) {
+    System_printf("UART: %u bytes lost\n", rxOverruns);
     System_flush();
 }
 
+/*!
+ * \brief one received byte, either part of a command frame or a keystroke
+ */
+static void receive(uint8_t byte) {
+    static commandFrame frame;
+    commandReceive result = command_receive(byte, Clock_getTicks(), &frame);
+
+    // the broker gets the whole frame, the host repeats a dropped one
+    if (result == COMMAND_RECEIVE_FRAME) {
+        queue_post(&commandMailbox, &frame);
+    }
+    // Keystroke in the valid region, send it to broker otherwise just ignore it
+    else if (result == COMMAND_RECEIVE_NONE && byte >= 0x08 && byte <= 0x7F) {
+        queue_post(&brokerRead, &byte);
+    }
+}
+
 void outputTestcaseChange(uint8_t testcase){
     System_printf("New Testcase: %u\n", testcase);
     System_flush();
 }
 
+/*!
+ * \brief a byte arrived, it is kept and the next read starts right away, so a frame of a host
+ * tool is not lost while the task is busy
+ */
 static void UARTreadCallback(UART_Handle uart, void *buf, size_t count){
-    input = *((uint8_t*) buf);
+    if ((uint16_t) (rxHead - rxTail) < UART_RX_SIZE)
+        rxRing[rxHead++ & (UART_RX_SIZE - 1)] = *((uint8_t*) buf);
+    else
+        rxOverruns++;
+    UART_read(uart, &input, 1);
 
-    Semaphore_post(sem);
+    Event_post(uartEvent, UART_EVENT_READ);
 }
 
 // End Doxygen group
@@ -0,0 +1,113 @@
+/*!
+ * \file boot.c
+ * \brief readiness of the boot stages, one gate per stage
+ * A gate is a counting Semaphore that stays closed until the stage is signalled. Every waiter
+ * passes it and posts it again for the next one, so a signalled stage stays open for good.
+ * Signalling and waiting are allowed from Task context only, the signal prints the time of the stage.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/boot.h"
+#include "local_inc/timestamp.h"
+
+#include <ti/sysbios/hal/Hwi.h>
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ globals ---
+//! \brief gate of every stage, opened by boot_signal
+static Semaphore_Handle gates[BOOT_STAGES];
+//! \brief stages signalled so far, one bit per stage
+static volatile uint32_t readyStages;
+//! \brief time of the boot, of every stage the ms since the boot
+static timestamp_t bootTime;
+static uint32_t stageTime[BOOT_STAGES];
+//! \brief names of the stages for the statistics
+static const char *const stageNames[BOOT_STAGES] = {"UART", "display", "sensors", "first heart rate"};
+
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief create the closed gates and take the boot time, has to be called once before any task is created
+ */
+void boot_init(void)
+{
+    Semaphore_Params semParams;
+    Error_Block eb;
+    uint8_t i;
+
+    bootTime = timestamp_now();
+    for (i = 0; i < BOOT_STAGES; i++)
+    {
+        Error_init(&eb);
+        Semaphore_Params_init(&semParams);
+        gates[i] = Semaphore_create(0, &semParams, &eb);
+        if (gates[i] == NULL)
+            System_abort("Boot semaphore create failed");
+    }
+}
+
+/*!
+ * \brief a stage is reached, all of its waiters continue, only the first call counts
+ * Prints the time of the stage, so it must not be called from a Swi or Hwi
+ * \param stage the stage
+ */
+void boot_signal(bootStage stage)
+{
+    unsigned int key;
+    bool first;
+
+    key = Hwi_disable();
+    first = (readyStages & (1u << stage)) == 0;
+    readyStages |= 1u << stage;
+    Hwi_restore(key);
+    if (!first)
+        return;
+
+    stageTime[stage] = (uint32_t) ((timestamp_now() - bootTime) / 1000);
+    Semaphore_post(gates[stage]);
+    System_printf("Boot: %s after %u ms\n", stageNames[stage], stageTime[stage]);
+    System_flush();
+}
+
+/*!
+ * \brief wait until a stage is reached, returns at once if it is already
+ * \param stage the stage
+ * \param timeout Clock ticks to wait at most, BIOS_WAIT_FOREVER or BIOS_NO_WAIT
+ * \return true if the stage is reached
+ */
+bool boot_wait(bootStage stage, uint32_t timeout)
+{
+    if (!Semaphore_pend(gates[stage], timeout))
+        return false;
+    // keep the gate open for the other waiters
+    Semaphore_post(gates[stage]);
+    return true;
+}
+
+/*!
+ * \brief whether a stage is reached, without waiting, usable from any context
+ */
+bool boot_isReady(bootStage stage)
+{
+    return (readyStages & (1u << stage)) != 0;
+}
+
+/*!
+ * \brief print the time of every stage since the boot
+ */
+void boot_printStatistics(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < BOOT_STAGES; i++)
+    {
+        if (boot_isReady((bootStage) i))
+            System_printf("Boot: %s after %u ms\n", stageNames[i], stageTime[i]);
+        else
+            System_printf("Boot: %s pending\n", stageNames[i]);
+    }
+    System_flush();
+}
+// End Doxygen group
+//! @}
@@ -7,6 +7,14 @@
 
 // ----------------------------------------------------------------------------- includes ---
 #include "local_inc/broker.h"
+#include "local_inc/boot.h"
+#include "local_inc/heartrate.h"
+#include "local_inc/history.h"
+#include "local_inc/recorder.h"
+#include "local_inc/telemetry.h"
+#include "local_inc/power.h"
+#include "local_inc/command.h"
+#include "local_inc/bus.h"
 
 /* Function: Broker interacts direct with UART (bidirectional)
  * and takes from input from the Input-Module
@@ -20,12 +28,32 @@
 //! @{
 // ---------------------------------------------------------------------------- functions ---
 static void initializeMailboxes(void);
+static void handleInput(uint8_t UART_read);
+static void handleCommand(uint8_t UART_read);
+static void handleHeartrate(const heartrateMessage *heartrate);
+static void handleRr(const rrMessage *rr);
+static void handleFrame(const commandFrame *frame);
+static commandStatus execute(const commandEntry *entry, uint8_t *result, uint8_t *length);
+static void setTestcase(uint8_t newTestcase);
+static void printStatistics(void);
+static void setAcquisitionMode(heartrateAcquisitionMode mode);
+static void setEstimatorMode(heartrateEstimatorMode mode);
+static void putUint32(uint8_t *data, uint32_t value);
 // ---------------------------------------------------------------------------- globals -----
+//! \brief selected testcase, broker task only, the OLED gets every change as a message
 static uint8_t testcase;
-static bool isChanged;
+//! \brief heart rates and RR intervals from the bus
+static busSubscriber subscription;
+//! \brief latest heart rate of every sensor, aggregated from all heartrate tasks
+static uint8_t latestHeartrate[HEARTRATE_SENSOR_COUNT];
+//! \brief signal quality of the latest heart rate of every sensor
+static uint8_t latestQuality[HEARTRATE_SENSOR_COUNT];
+//! \brief heart rate variability of the latest heart rate of every sensor
+static hrvMetrics latestHrv[HEARTRATE_SENSOR_COUNT];
 // ----------------------------------------------------------------------- implementation ---
 /*!
  * \brief create a new Broker Task and initialize it with the necessary parameters.
+ * The mailboxes are created here, before any task runs, so every task may use them from its start.
  * \param name xdc_String, identifying name of the task
  * \param priority uint8_t initial priority of the task (1-15) 15 is highest priority
  */
@@ -34,6 +62,7 @@ extern void setup_Broker_task(xdc_String name, uint8_t priority)
     Task_Params taskLedParams;
     Task_Handle taskLed;
     Error_Block eb;
+    initializeMailboxes();
     Error_init(&eb);
     Task_Params_init(&taskLedParams);
     taskLedParams.instance->name = name;
@@ -51,84 +80,388 @@ extern void setup_Broker_task(xdc_String name, uint8_t priority)
  * broker task receives input from interprocess signal (semaphore) from UART or from
  * the input module converts the input to ascii format and sends it to the OLED function
  * to display.
+ * The task blocks on the broker Event until one of its mailboxes or its bus queue has a message,
+ * it never polls.
  */
 extern void Broker_task(void)
 {
-    initializeMailboxes();
     uint8_t UART_read;
-    uint8_t temp;
+    commandFrame frame;
+    const busMessage *message;
 
     while (1)
     {
-        if (Mailbox_pend(brokerRead, &UART_read, BIOS_NO_WAIT))
+        Event_pend(brokerEvent, Event_Id_NONE, BROKER_EVENT_UART | BROKER_EVENT_BUS | BROKER_EVENT_COMMAND,
+                   BIOS_WAIT_FOREVER);
+        while (queue_take(&brokerRead, &UART_read))
+            handleInput(UART_read);
+        while (queue_take(&commandMailbox, &frame))
+            handleFrame(&frame);
+        // the messages are shared with the other subscribers, read in place
+        while ((message = bus_receive(&subscription)) != NULL)
         {
-            System_printf("gelesen1: %c\n", UART_read);
-            System_flush();
-
-            if (UART_read == '#')
-            {
-                Mailbox_pend(brokerRead, &UART_read, BIOS_WAIT_FOREVER);
-                System_printf("gelesen2: %c\n", UART_read);
-                System_flush();
-                if (UART_read >= '0' && UART_read <= '4')
-                {
-                    testcase = UART_read - '0';
-                    isChanged = true;
-                    outputTestcaseChange(testcase);
-                }
-                // Testcase 3 swich the oled off
-                if (testcase == 3)
-                {
-                    OLED_toggle_Display_on_off();
-                }
-            } // Testcase 2 routes the UART to the output, User can write to OLED
-            else if (testcase == 2)
-            {
-                Mailbox_post(oledMailbox, &UART_read, BIOS_WAIT_FOREVER);
-            }
+            if (message->topic == BUS_TOPIC_HEARTRATE)
+                handleHeartrate(&message->payload.heartrate);
+            else
+                handleRr(&message->payload.rr);
+            bus_release(message);
         }
+    }
+}
 
-        // Testcase 0 is normal mode input module get routed to output module
-        if (testcase == 0)
-        {
-            Mailbox_pend(heartrateMailbox, &temp, BIOS_WAIT_FOREVER);
-            Mailbox_post(oledMailbox, &temp, BIOS_NO_WAIT);
-        }
-        // Testcase 1 is test input in which form whatsoever
-        else if (testcase == 1)
-        {
-            char heartrateString[4];
+/*!
+ * \brief a char from the UART, '#' and a digit select a testcase or a command
+ */
+static void handleInput(uint8_t UART_read)
+{
+    static bool command;
+    oledMessage output;
 
-            Mailbox_pend(heartrateMailbox, &temp, BIOS_WAIT_FOREVER);
-            sprintf(heartrateString, "%03u ", temp);
-            Mailbox_post(brokerWrite, heartrateString, BIOS_WAIT_FOREVER);
-        }
-//        else if (testcase == 4)
-//        {
-//            // post dummy char to give up processor time
-//            Mailbox_post(oledMailbox, &temp, BIOS_WAIT_FOREVER);
-//        }
-        Task_yield();
+    // every keystroke counts as user activity, a dimmed display lights up again
+    if (power_activity())
+    {
+        output.type = OLED_MESSAGE_WAKE;
+        output.sensor = 0;
+        output.value = 0;
+        output.timestamp = timestamp_now();
+        queue_post(&oledMailbox, &output);
+    }
+
+    if (command)
+    {
+        command = false;
+        System_printf("gelesen2: %c\n", UART_read);
+        System_flush();
+        handleCommand(UART_read);
+        return;
+    }
+    System_printf("gelesen1: %c\n", UART_read);
+    System_flush();
+
+    if (UART_read == '#')
+    {
+        command = true;
+    } // Testcase 2 routes the UART to the output, User can write to OLED
+    else if (testcase == 2)
+    {
+        output.type = OLED_MESSAGE_VALUE;
+        output.sensor = 0;
+        output.value = UART_read;
+        output.timestamp = timestamp_now();
+        queue_post(&oledMailbox, &output);
+    }
+}
+
+/*!
+ * \brief the digit after a '#', the terminal shortcut of the framed commands that toggles
+ * where a command takes a value
+ */
+static void handleCommand(uint8_t UART_read)
+{
+    if (UART_read == '3')
+    {
+        // #3 toggles the display, sent again it goes back to the heart rate
+        setTestcase(testcase == 3 ? 0 : 3);
+    }
+    else if (UART_read >= '0' && UART_read <= '4')
+    {
+        setTestcase(UART_read - '0');
+    } // #5 to #9 only print or act on the acquisition, the testcase stays
+    else if (UART_read == '5')
+    {
+        printStatistics();
+    }
+    else if (UART_read == '6')
+    {
+        setAcquisitionMode(heartrate_getAcquisitionMode() == HEARTRATE_ACQUISITION_TIMER
+                           ? HEARTRATE_ACQUISITION_INTERRUPT : HEARTRATE_ACQUISITION_TIMER);
+    }
+    else if (UART_read == '7')
+    {
+        history_printSummary();
+    }
+    else if (UART_read == '8')
+    {
+        recorder_toggle();
+    }
+    else if (UART_read == '9')
+    {
+        setEstimatorMode(heartrate_getEstimatorMode() == HEARTRATE_ESTIMATOR_FFT
+                         ? HEARTRATE_ESTIMATOR_BEATS : HEARTRATE_ESTIMATOR_FFT);
+    }
+}
+
+/*!
+ * \brief a command frame from the UART, its commands are executed in order and acknowledged
+ * together in one frame
+ */
+static void handleFrame(const commandFrame *frame)
+{
+    commandFrame ack;
+    commandEntry entry;
+    uint8_t result[COMMAND_RESULT_SIZE];
+    uint8_t length;
+    uint8_t offset = 1;
+    commandStatus status;
+
+    command_startAck(&ack, frame);
+    while (command_next(frame, &offset, &entry))
+    {
+        length = 0;
+        status = entry.malformed ? COMMAND_MALFORMED : execute(&entry, result, &length);
+        if (!command_addAck(&ack, entry.id, status, result, length))
+            break;
+    }
+    queue_post(&ackMailbox, &ack);
+}
+
+/*!
+ * \brief execute one command of a frame
+ * \param entry command with its arguments
+ * \param result filled with up to COMMAND_RESULT_SIZE bytes of the result
+ * \param length set to the length of the result
+ */
+static commandStatus execute(const commandEntry *entry, uint8_t *result, uint8_t *length)
+{
+    const uint8_t *argument = entry->arguments;
+    uint32_t period;
+    hrvMetrics hrv;
+    queue *q;
+
+    switch (entry->id)
+    {
+    case COMMAND_PING:
+        return entry->length == 0 ? COMMAND_OK : COMMAND_BAD_ARGUMENT;
+    case COMMAND_SET_TESTCASE:
+        if (entry->length != 1 || argument[0] > 4)
+            return COMMAND_BAD_ARGUMENT;
+        if (argument[0] != testcase)
+            setTestcase(argument[0]);
+        return COMMAND_OK;
+    case COMMAND_PRINT_STATISTICS:
+        if (entry->length != 0)
+            return COMMAND_BAD_ARGUMENT;
+        printStatistics();
+        return COMMAND_OK;
+    case COMMAND_SET_ACQUISITION:
+        if (entry->length != 1 || argument[0] > HEARTRATE_ACQUISITION_TIMER)
+            return COMMAND_BAD_ARGUMENT;
+        if (argument[0] != heartrate_getAcquisitionMode())
+            setAcquisitionMode((heartrateAcquisitionMode) argument[0]);
+        return COMMAND_OK;
+    case COMMAND_PRINT_HISTORY:
+        if (entry->length != 0)
+            return COMMAND_BAD_ARGUMENT;
+        history_printSummary();
+        return COMMAND_OK;
+    case COMMAND_SET_RECORDING:
+        if (entry->length != 1 || argument[0] > 1)
+            return COMMAND_BAD_ARGUMENT;
+        recorder_setRecording(argument[0] == 1);
+        return COMMAND_OK;
+    case COMMAND_SET_ESTIMATOR:
+        if (entry->length != 1 || argument[0] > HEARTRATE_ESTIMATOR_FFT)
+            return COMMAND_BAD_ARGUMENT;
+        if (argument[0] != heartrate_getEstimatorMode())
+            setEstimatorMode((heartrateEstimatorMode) argument[0]);
+        return COMMAND_OK;
+    case COMMAND_SET_TELEMETRY:
+        if (entry->length != 4)
+            return COMMAND_BAD_ARGUMENT;
+        period = argument[0] | (uint32_t) argument[1] << 8 | (uint32_t) argument[2] << 16 | (uint32_t) argument[3] << 24;
+        if (period == 0)
+            return COMMAND_BAD_ARGUMENT;
+        telemetry_setPeriod(period);
+        return COMMAND_OK;
+    case COMMAND_GET_HEARTRATE:
+        if (entry->length != 1 || argument[0] >= HEARTRATE_SENSOR_COUNT)
+            return COMMAND_BAD_ARGUMENT;
+        hrv = latestHrv[argument[0]];
+        result[0] = latestHeartrate[argument[0]];
+        result[1] = latestQuality[argument[0]];
+        result[2] = hrv.rmssd & 0xFF;
+        result[3] = hrv.rmssd >> 8;
+        result[4] = hrv.sdnn & 0xFF;
+        result[5] = hrv.sdnn >> 8;
+        result[6] = hrv.pnn50;
+        *length = 7;
+        return COMMAND_OK;
+    case COMMAND_GET_QUEUE:
+        if (entry->length != 1 || (q = queue_get(argument[0])) == NULL)
+            return COMMAND_BAD_ARGUMENT;
+        result[0] = q->policy;
+        result[1] = q->depth;
+        result[2] = q->highWater;
+        result[3] = queue_pending(q);
+        putUint32(&result[4], q->posted);
+        putUint32(&result[8], q->dropped);
+        putUint32(&result[12], q->waited);
+        *length = 16;
+        return COMMAND_OK;
+    case COMMAND_SET_QUEUE_POLICY:
+        if (entry->length != 2 || (q = queue_get(argument[0])) == NULL)
+            return COMMAND_BAD_ARGUMENT;
+        return queue_setPolicy(q, (queuePolicy) argument[1]) ? COMMAND_OK : COMMAND_BAD_ARGUMENT;
+    default:
+        return COMMAND_UNKNOWN;
     }
 }
 
 /*!
- * \brief initialize all used mailboxes
+ * \brief select a testcase, the OLED clears its screen for it
+ * 0 ... normal mode
+ * 1 ... testing input module
+ * 2 ... testing output module
+ * 3 ... display off/ on
+ * 4 ... heart rate trend of the last hour
+ */
+static void setTestcase(uint8_t newTestcase)
+{
+    oledMessage output;
+    bool wasOff = testcase == 3;
+
+    testcase = newTestcase;
+    outputTestcaseChange(testcase);
+    // the OLED clears its screen when it takes the message
+    output.type = OLED_MESSAGE_TESTCASE;
+    output.sensor = 0;
+    output.value = testcase;
+    output.timestamp = timestamp_now();
+    queue_post(&oledMailbox, &output);
+
+    // Testcase 3 swich the oled off, any other one on again. The OLED task runs the sequence
+    if (testcase == 3 || wasOff)
+    {
+        output.type = OLED_MESSAGE_POWER;
+        output.value = testcase != 3;
+        queue_post(&oledMailbox, &output);
+    }
+}
+
+/*!
+ * \brief statistics of every module to the console
+ */
+static void printStatistics(void)
+{
+    heartrate_printStatistics();
+    recorder_printStatistics();
+    telemetry_printStatistics();
+    OLED_printStatistics();
+    boot_printStatistics();
+    power_printStatistics();
+    command_printStatistics();
+    UART_printStatistics();
+    bus_printStatistics();
+    queue_printStatistics();
+}
+
+/*!
+ * \brief a heart rate from the estimators, every one is taken. The OLED gets it from the bus itself,
+ * testcase 1 streams it to the UART
+ */
+static void handleHeartrate(const heartrateMessage *heartrate)
+{
+    char heartrateString[BROKER_WRITE_SIZE];
+
+    if (heartrate->sensor < HEARTRATE_SENSOR_COUNT)
+    {
+        latestHeartrate[heartrate->sensor] = heartrate->bpm;
+        latestQuality[heartrate->sensor] = heartrate->quality;
+        latestHrv[heartrate->sensor] = heartrate->hrv;
+    }
+    if (heartrate->bpm > 0 && !boot_isReady(BOOT_HEARTRATE))
+        boot_signal(BOOT_HEARTRATE);
+
+    // Testcase 1 is test input in which form whatsoever
+    if (testcase == 1)
+    {
+        // prefix the sensor number, so all sensors can be told apart in one stream
+        // the heart rate variability follows as RMSSD/SDNN/pNN50 once it is known
+        if (heartrate->hrv.sdnn > 0 || heartrate->hrv.rmssd > 0)
+            System_snprintf(heartrateString, BROKER_WRITE_SIZE, "%u:%03u %u/%u/%u ", heartrate->sensor, heartrate->bpm,
+                            heartrate->hrv.rmssd, heartrate->hrv.sdnn, heartrate->hrv.pnn50);
+        else
+            System_snprintf(heartrateString, BROKER_WRITE_SIZE, "%u:%03u ", heartrate->sensor, heartrate->bpm);
+        queue_post(&brokerWrite, heartrateString);
+    }
+}
+
+/*!
+ * \brief an RR interval of an accepted beat, testcase 1 streams them between the heart rates
+ */
+static void handleRr(const rrMessage *rr)
+{
+    char rrString[BROKER_WRITE_SIZE];
+
+    if (testcase == 1)
+    {
+        System_snprintf(rrString, BROKER_WRITE_SIZE, "%u:rr %u ", rr->sensor, rr->interval);
+        queue_post(&brokerWrite, rrString);
+    }
+}
+
+/*!
+ * \brief initialize all used mailboxes and the bus subscription of the broker
  *
  *
  */
 static void initializeMailboxes(void)
 {
-    Mailbox_Params params;
     Error_Block eb;
 
-    Mailbox_Params_init(&params);
     Error_init(&eb);
+    brokerEvent = Event_create(NULL, &eb);
+    uartEvent = Event_create(NULL, &eb);
+    oledEvent = Event_create(NULL, &eb);
+    if (brokerEvent == NULL || uartEvent == NULL || oledEvent == NULL)
+        System_abort("Broker event create failed");
+
+    // the readers block on the Event of their task, the queues post it with every message.
+    // The UART task must not wait for the broker, which waits for the UART, no policy may change that
+    queue_create(&brokerRead, "UART keys", sizeof(uint8_t), BROKER_READ_DEPTH, BROKER_READ_POLICY, false,
+                 brokerEvent, BROKER_EVENT_UART);
+    queue_create(&commandMailbox, "UART frames", sizeof(commandFrame), BROKER_COMMAND_DEPTH, BROKER_COMMAND_POLICY,
+                 false, brokerEvent, BROKER_EVENT_COMMAND);
+    queue_create(&brokerWrite, "UART write", sizeof(char) * BROKER_WRITE_SIZE, BROKER_WRITE_DEPTH,
+                 BROKER_WRITE_POLICY, true, uartEvent, UART_EVENT_WRITE);
+    queue_create(&ackMailbox, "UART acks", sizeof(commandFrame), BROKER_ACK_DEPTH, BROKER_ACK_POLICY, true,
+                 uartEvent, UART_EVENT_ACK);
+    queue_create(&oledMailbox, "OLED control", sizeof(oledMessage), BROKER_OLED_DEPTH, BROKER_OLED_POLICY, true,
+                 oledEvent, OLED_EVENT_MESSAGE);
 
-    heartrateMailbox = Mailbox_create(sizeof(uint8_t), 5, &params, &eb);
-    oledMailbox = Mailbox_create(sizeof(uint8_t), 5, &params, &eb);
-    brokerWrite = Mailbox_create(sizeof(char) * 4, 5, &params, &eb);
-    brokerRead = Mailbox_create(sizeof(uint8_t), 5, &params, &eb);
+    bus_subscribe(&subscription, "broker bus", BUS_TOPIC(BUS_TOPIC_HEARTRATE) | BUS_TOPIC(BUS_TOPIC_RR),
+                  BROKER_BUS_DEPTH, BROKER_BUS_POLICY, brokerEvent, BROKER_EVENT_BUS);
+}
+
+/*!
+ * \brief pace the heartrate acquisition by the sensor interrupt or by the hardware timer
+ */
+static void setAcquisitionMode(heartrateAcquisitionMode mode)
+{
+    heartrate_setAcquisitionMode(mode);
+    System_printf("Acquisition: %s\n", mode == HEARTRATE_ACQUISITION_TIMER ? "timer" : "interrupt");
+    System_flush();
+}
+
+/*!
+ * \brief take the published heart rate from the beats of the quality stage or from the FFT estimator
+ */
+static void setEstimatorMode(heartrateEstimatorMode mode)
+{
+    heartrate_setEstimatorMode(mode);
+    System_printf("Estimator: %s\n", mode == HEARTRATE_ESTIMATOR_FFT ? "FFT" : "beats");
+    System_flush();
+}
+
+/*!
+ * \brief a result value in little endian
+ */
+static void putUint32(uint8_t *data, uint32_t value)
+{
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = value >> 24;
 }
 
 /*!
@@ -137,30 +470,39 @@ static void initializeMailboxes(void)
  */
 
 /*!
- * \brief get the actual testcase value
- * 0 ... normal mode
- * 1 ... testing input module
- * 2 ... testing output module
- * 3 ... display off/ on
+ * \brief get the latest heart rate of a given sensor
+ * \param sensor number of the sensor
+ * \return heart rate in bpm, 0 if unknown
  */
-uint8_t getTestcase(void)
+uint8_t getHeartrate(uint8_t sensor)
 {
-    return testcase;
+    if (sensor >= HEARTRATE_SENSOR_COUNT)
+        return 0;
+    return latestHeartrate[sensor];
 }
 /*!
- * \brief reset the static variable isChanged from outside.
- * Necessary because oled_display.c needs to reset the value
+ * \brief get the signal quality of the latest heart rate of a given sensor
+ * \param sensor number of the sensor
+ * \return quality in percent, 0 if unknown or no pulse was found
  */
-void resetChanged(void)
+uint8_t getQuality(uint8_t sensor)
 {
-    isChanged = false;
+    if (sensor >= HEARTRATE_SENSOR_COUNT)
+        return 0;
+    return latestQuality[sensor];
 }
 /*!
- * \ get the actual value of the changing testcase status
+ * \brief get the heart rate variability of the latest heart rate of a given sensor
+ * \param sensor number of the sensor
+ * \return RMSSD, SDNN and pNN50, all 0 if unknown
  */
-bool getChanged(void)
+hrvMetrics getHrv(uint8_t sensor)
 {
-    return isChanged;
+    hrvMetrics none = {0, 0, 0};
+
+    if (sensor >= HEARTRATE_SENSOR_COUNT)
+        return none;
+    return latestHrv[sensor];
 }
 
 //! @}
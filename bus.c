@@ -0,0 +1,140 @@
+/*!
+ * \file bus.c
+ * \brief publish/subscribe bus, see bus.h
+ * Producers publish from tasks, Swis (the estimator clock) and with the Swis disabled, so the
+ * reference counts only change with the interrupts off, for a few instructions each.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/bus.h"
+
+#include <ti/sysbios/hal/Hwi.h>
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ globals ---
+//! \brief the messages, a slot without references is free
+static busMessage pool[BUS_POOL_SIZE];
+//! \brief all subscribers, fixed after the setup
+static busSubscriber *subscribers[BUS_MAX_SUBSCRIBERS];
+static uint8_t subscriberCount;
+// statistics
+static uint32_t published[BUS_TOPICS];
+static uint32_t poolExhausted;
+//! \brief names of the topics for the statistics
+static const char *const topicNames[BUS_TOPICS] = {"heartrate", "RR"};
+// ---------------------------------------------------------------------------- functions ---
+static void discardMessage(const void *message);
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief add a subscriber, during the setup only
+ * \param subscriber state of the subscriber, kept by the caller
+ * \param name shown in the statistics
+ * \param topics mask of BUS_TOPIC of every topic to receive
+ * \param depth messages the queue holds
+ * \param policy what the full queue does with the next message, anything but QUEUE_BLOCK
+ * \param event posted with eventId for every message, the subscriber may wait on it together with others
+ */
+void bus_subscribe(busSubscriber *subscriber, const char *name, uint32_t topics, uint8_t depth,
+                   queuePolicy policy, Event_Handle event, unsigned int eventId)
+{
+    if (subscriberCount == BUS_MAX_SUBSCRIBERS)
+        System_abort("Bus subscribers exhausted");
+    queue_create(&subscriber->messages, name, sizeof(busMessage *), depth, policy, false, event, eventId);
+    // a message the policy drops from the queue is never received, its reference goes with it
+    subscriber->messages.discard = discardMessage;
+    subscriber->topics = topics;
+    subscribers[subscriberCount++] = subscriber;
+}
+
+/*!
+ * \brief copy a message into the pool and queue it for every subscriber of its topic, never blocks
+ * \param topic topic of the message
+ * \param payload the message, of the type of the topic
+ * \param size size of the payload
+ * \return false if the pool is exhausted, nobody gets the message then
+ */
+bool bus_publish(busTopic topic, const void *payload, uint8_t size)
+{
+    busMessage *message = NULL;
+    unsigned int key;
+    uint8_t i;
+
+    // the publisher holds a reference itself, a subscriber that runs right away cannot free the slot
+    key = Hwi_disable();
+    for (i = 0; i < BUS_POOL_SIZE && message == NULL; i++)
+    {
+        if (pool[i].references == 0)
+        {
+            message = &pool[i];
+            message->references = 1;
+        }
+    }
+    Hwi_restore(key);
+    if (message == NULL)
+    {
+        poolExhausted++;
+        return false;
+    }
+    message->topic = topic;
+    memcpy(&message->payload, payload, size);
+    published[topic]++;
+
+    for (i = 0; i < subscriberCount; i++)
+    {
+        if ((subscribers[i]->topics & BUS_TOPIC(topic)) == 0)
+            continue;
+        key = Hwi_disable();
+        message->references++;
+        Hwi_restore(key);
+        if (!queue_post(&subscribers[i]->messages, &message))
+            bus_release(message);
+    }
+    bus_release(message);
+    return true;
+}
+
+/*!
+ * \brief take the next message of a subscriber, never blocks
+ * \return the message, to be released when done, NULL if the queue is empty
+ */
+const busMessage *bus_receive(busSubscriber *subscriber)
+{
+    busMessage *message;
+
+    return queue_take(&subscriber->messages, &message) ? message : NULL;
+}
+
+/*!
+ * \brief a subscriber is done with a message, the last one frees its slot
+ */
+void bus_release(const busMessage *message)
+{
+    unsigned int key;
+
+    key = Hwi_disable();
+    ((busMessage *) message)->references--;
+    Hwi_restore(key);
+}
+
+void bus_printStatistics(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < BUS_TOPICS; i++)
+        System_printf("Bus: %u %s messages published\n", published[i], topicNames[i]);
+    System_printf("Bus: %u messages lost, all %u slots in use\n", poolExhausted, BUS_POOL_SIZE);
+    System_flush();
+}
+
+/*!
+ * \brief a subscriber queue dropped a waiting message, release the reference it held
+ */
+static void discardMessage(const void *message)
+{
+    bus_release(*(busMessage *const *) message);
+}
+
+// End Doxygen group
+//! @}
@@ -0,0 +1,182 @@
+/*!
+ * \file command.c
+ * \brief framed command protocol over the UART, see command.h
+ * The parser runs in the UART task byte by byte, only complete and checked frames go on to the
+ * broker, one mailbox message per frame instead of one per byte.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/command.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief generator polynomial of the CRC-8, x^8 + x^2 + x + 1
+#define COMMAND_CRC_POLYNOMIAL 0x07
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief states of the parser
+typedef enum commandState {
+    COMMAND_STATE_IDLE,         //!< waiting for COMMAND_START
+    COMMAND_STATE_LENGTH,       //!< next byte is the body length
+    COMMAND_STATE_BODY,         //!< collecting the body
+    COMMAND_STATE_CRC           //!< next byte is the CRC
+} commandState;
+// ------------------------------------------------------------------------------ globals ---
+//! \brief parser of the UART task
+static commandState state;
+static uint8_t received;
+static uint8_t crc;
+static uint32_t lastByte;
+// statistics
+static uint32_t framesReceived;
+static uint32_t crcErrors;
+static uint32_t lengthErrors;
+static uint32_t timeouts;
+static uint32_t commandsRejected;
+// ---------------------------------------------------------------------------- functions ---
+static uint8_t crc8(uint8_t crc, uint8_t byte);
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief take the next byte from the UART, UART task only
+ * \param byte received byte
+ * \param now clock ticks at its reception, a frame that pauses too long starts over
+ * \param frame filled with the body, valid once COMMAND_RECEIVE_FRAME is returned
+ * \return whether the byte was part of a frame, or completed one
+ */
+commandReceive command_receive(uint8_t byte, uint32_t now, commandFrame *frame)
+{
+    if (state != COMMAND_STATE_IDLE && now - lastByte > COMMAND_TIMEOUT)
+    {
+        state = COMMAND_STATE_IDLE;
+        timeouts++;
+    }
+    lastByte = now;
+
+    switch (state)
+    {
+    case COMMAND_STATE_IDLE:
+        if (byte != COMMAND_START)
+            return COMMAND_RECEIVE_NONE;
+        state = COMMAND_STATE_LENGTH;
+        break;
+    case COMMAND_STATE_LENGTH:
+        if (byte == 0 || byte > COMMAND_BODY_SIZE)
+        {
+            lengthErrors++;
+            state = COMMAND_STATE_IDLE;
+            break;
+        }
+        frame->length = byte;
+        received = 0;
+        crc = crc8(0, byte);
+        state = COMMAND_STATE_BODY;
+        break;
+    case COMMAND_STATE_BODY:
+        frame->body[received++] = byte;
+        crc = crc8(crc, byte);
+        if (received == frame->length)
+            state = COMMAND_STATE_CRC;
+        break;
+    case COMMAND_STATE_CRC:
+        state = COMMAND_STATE_IDLE;
+        if (byte != crc)
+        {
+            crcErrors++;
+            break;
+        }
+        framesReceived++;
+        return COMMAND_RECEIVE_FRAME;
+    }
+    return COMMAND_RECEIVE_BUSY;
+}
+
+/*!
+ * \brief take the next command out of a command frame
+ * \param frame complete command frame
+ * \param offset position in the body, 1 for the first command, advanced to the next one
+ * \param entry filled with the command
+ * \return false if there is no further command
+ */
+bool command_next(const commandFrame *frame, uint8_t *offset, commandEntry *entry)
+{
+    if (*offset + 2 > frame->length)
+        return false;
+    entry->id = frame->body[*offset];
+    entry->length = frame->body[*offset + 1];
+    entry->arguments = &frame->body[*offset + 2];
+    entry->malformed = *offset + 2 + entry->length > frame->length;
+    *offset = entry->malformed ? frame->length : *offset + 2 + entry->length;
+    return true;
+}
+
+/*!
+ * \brief start the acknowledgement of a command frame, with its sequence number
+ */
+void command_startAck(commandFrame *ack, const commandFrame *frame)
+{
+    ack->body[0] = frame->body[0];
+    ack->length = 1;
+}
+
+/*!
+ * \brief append the outcome of one command to an acknowledgement
+ * \return false if it does not fit anymore, the host sees the missing entries
+ */
+bool command_addAck(commandFrame *ack, uint8_t id, commandStatus status, const uint8_t *result, uint8_t length)
+{
+    if (ack->length + 3 + length > COMMAND_BODY_SIZE)
+        return false;
+    if (status != COMMAND_OK)
+        commandsRejected++;
+    ack->body[ack->length++] = id;
+    ack->body[ack->length++] = status;
+    ack->body[ack->length++] = length;
+    memcpy(&ack->body[ack->length], result, length);
+    ack->length += length;
+    return true;
+}
+
+/*!
+ * \brief put a frame on the line format
+ * \param data room for COMMAND_FRAME_SIZE bytes
+ * \return bytes to send
+ */
+uint8_t command_encode(const commandFrame *frame, uint8_t *data)
+{
+    uint8_t checksum = crc8(0, frame->length);
+    uint8_t i;
+
+    data[0] = COMMAND_START;
+    data[1] = frame->length;
+    for (i = 0; i < frame->length; i++)
+    {
+        data[2 + i] = frame->body[i];
+        checksum = crc8(checksum, frame->body[i]);
+    }
+    data[2 + frame->length] = checksum;
+    return frame->length + 3;
+}
+
+void command_printStatistics(void)
+{
+    System_printf("Commands: %u frames, dropped %u CRC %u length %u timeout, %u commands rejected\n",
+                  framesReceived, crcErrors, lengthErrors, timeouts, commandsRejected);
+    System_flush();
+}
+
+/*!
+ * \brief one byte into the CRC-8, bit by bit, the frames are short
+ */
+static uint8_t crc8(uint8_t crc, uint8_t byte)
+{
+    uint8_t bit;
+
+    crc ^= byte;
+    for (bit = 0; bit < 8; bit++)
+        crc = crc & 0x80 ? (uint8_t) ((crc << 1) ^ COMMAND_CRC_POLYNOMIAL) : (uint8_t) (crc << 1);
+    return crc;
+}
+
+// End Doxygen group
+//! @}
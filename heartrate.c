@@ -6,124 +6,243 @@
  */
 #include "local_inc/common.h"
 #include "local_inc/heartrate.h"
+#include "local_inc/timestamp.h"
+#include "local_inc/history.h"
+#include "local_inc/recorder.h"
+#include "local_inc/boot.h"
+#include "local_inc/bus.h"
 
 #include <ti/sysbios/hal/Hwi.h>
+#include <ti/sysbios/knl/Swi.h>
+#include <ti/sysbios/hal/Timer.h>
 #include <inc/hw_ints.h>
 #include <driverlib/sysctl.h>
-#include <ti/drivers/I2C.h>
 #include <ti/drivers/GPIO.h>
 
-#define SLAVEADDR_READ 0b10101111
-#define SLAVEADDR_WRITE 0b10101110
-#define SLAVEADDR 0b1010111 //tiva ware appends the one and zero on its own?
+#define PART_ID 0x11    //content of the part id register 0xFF of every MAX30100
 #define FREQUENCY 5000  //in milliseconds (although documentation says ticks)
-#define SENSOR_DATA_SIZE 300
-
-static void heartrate_run();
-static void init();
-static void readFIFOData();
-static void I2C_write(uint8_t reg, uint8_t value);
-static uint8_t I2C_read(uint8_t reg);
-static void I2C_readFIFO(uint8_t* array);
-static int comparison(const void* a, const void* b);
-static void initInterrupt();
+#define SAMPLE_RATE 50  //in Hz, has to match the SpO2 configuration register in init()
+#define SAMPLE_PERIOD_US (TIMESTAMP_US_PER_SECOND / SAMPLE_RATE)
+#define RECOVERY_BACKOFF 10         //ms to wait before the first attempt to bring a failed sensor back
+#define RECOVERY_BACKOFF_MAX 1000   //ms between attempts if the sensor stays unreachable
+#define EMPTY_WINDOWS 3             //estimator windows without a heart rate until the LED goes off
+#define PROBE_WINDOWS 3             //estimator windows with the LED off until it probes for a finger again
+#define MIN_INTERVALS 2             //beat intervals an estimator window needs for a heart rate
+#define MIN_QUALITY 50              //percent of accepted candidates an estimator window needs for a heart rate
+#define GAIN_PERIOD 64              //samples between two decisions of the LED current control
+#define GAIN_DC_LOW 32000           //below this DC the LED current goes up
+#define GAIN_DC_TARGET 48000        //DC the LED current control aims at, about three quarters of the ADC range
+#define GAIN_DC_HIGH 60000          //above this DC the LED current goes down
+#define GAIN_SATURATION 65000       //a sample above this clips, the LED current goes down
+#define GAIN_AC_MIN 20              //smaller pulses get more LED current if the DC leaves room for it
+#define FFT_PRIORITY 1              //FFT task below every other task, it only takes the CPU nobody else needs
+#define FFT_AGREEMENT 5             //bpm the two estimators may differ by to agree
+/* the FFT window must not span a gap in the samples, as after the LED was off. 5 % for the clock tolerance */
+#define FFT_MAX_SPAN ((HEARTRATE_FFT_SIZE - 1) * SAMPLE_PERIOD_US * 21 / 20)
+#if HEARTRATE_FFT_SIZE > HEARTRATE_RING_SIZE
+#error "the FFT window has to fit into the ring buffer"
+#endif
+#define RING_MASK (HEARTRATE_RING_SIZE - 1)
+/* in timer mode the FIFO gets drained when it is half full, leaves half a FIFO of headroom for jitter */
+#define ACQUISITION_TIMER_PERIOD_US ((HEARTRATE_FIFO_DEPTH / 2) * SAMPLE_PERIOD_US)
+
+/* where a sensor is attached to the board */
+typedef struct heartrateSensorConfig {
+    unsigned int i2cIndex;
+    unsigned int gpioIndex;
+} heartrateSensorConfig;
+
+static void heartrate_run(UArg arg0, UArg arg1);
+static bool init(heartrateSensor *sensor);
+static void recover(heartrateSensor *sensor);
+static void storeFIFOBlock(heartrateSensor *sensor, const heartrateFifoBlock *block);
+static void clockFunction(UArg arg);
+static void initInterrupt(heartrateSensor *sensor);
 static void interruptFunction(unsigned int index);
-
-I2C_Handle handle;
-Semaphore_Handle interruptSem;
-
-unsigned short sensor_data[SENSOR_DATA_SIZE];
-unsigned short data_count;
+static void timerFunction(UArg arg);
+static void recordTrigger(heartrateSensor *sensor, timestamp_t now);
+static void resetJitter(heartrateSensor *sensor, uint32_t expectedInterval);
+static void sensorStarted(void);
+static void dutyCycle(heartrateSensor *sensor, uint8_t bpm);
+static void applyDutyCycle(heartrateSensor *sensor);
+static void controlGain(heartrateSensor *sensor);
+static void publish(heartrateSensor *sensor, const heartrateMessage *message);
+static bool startFft(heartrateSensor *sensor, uint16_t writeIndex, const heartrateMessage *message);
+static void fft_run(UArg arg0, UArg arg1);
+static void finishFft(heartrateSensor *sensor);
+static int16_t saturate16(int32_t value);
+static void passIntervals(heartrateSensor *sensor);
+
+/* IR LED current of every code of the LED configuration register in 0.1 mA */
+static const uint16_t ledCurrents[MAX30100_LED_IR_MAX + 1] = {
+    0, 44, 76, 110, 142, 174, 208, 240, 271, 306, 338, 370, 402, 436, 468, 500
+};
+
+/* one entry per enabled I2C master, the order defines the sensor number */
+static const heartrateSensorConfig sensorConfig[HEARTRATE_SENSOR_COUNT] = {
+#if I2CM_8
+    {EK_TM4C1294XL_I2C8, EK_TM4C1294XL_CLICK_2},
+#endif
+#if I2CM_0
+    {EK_TM4C1294XL_I2C0, EK_TM4C1294XL_CLICK_1},
+#endif
+};
+
+heartrateSensor sensors[HEARTRATE_SENSOR_COUNT];
+
+/* selected trigger for draining the FIFOs, shared by all sensors */
+static volatile heartrateAcquisitionMode acquisitionMode = HEARTRATE_ACQUISITION_INTERRUPT;
+/* drains all sensors in timer mode */
+static Timer_Handle acquisitionTimer;
+
+/* selected estimator of the published heart rate, shared by all sensors */
+static volatile heartrateEstimatorMode estimatorMode = HEARTRATE_ESTIMATOR_BEATS;
+/* wakes up the FFT task for a new window of any sensor */
+static Semaphore_Handle fftSem;
+/* FFT statistics: its cost per window and how far it is off the time domain estimator */
+static latencyStats fftCost;
+static uint32_t fftSkipped;
+static uint32_t fftCompared;
+static uint32_t fftAgreed;
+static uint32_t fftDifference;
+static uint8_t fftMaxDifference;
+
+/* sensors that finished their initialization, found or not */
+static uint8_t sensorsStarted;
+
+/* task and clock names need to stay valid for the lifetime of the instance */
+static char taskNames[HEARTRATE_SENSOR_COUNT][12];
 
 void create_heartrate_tasks(int prio)
 {
     Task_Params params;
     Task_Handle taskHeartrate;
+    Clock_Params clockParams;
+    Clock_Handle myClock;
+    Semaphore_Params semParams;
+    Timer_Params timerParams;
     Error_Block eb;
-    /* Create heartrate task */
+    heartrateSensor *sensor;
+    uint8_t i;
+
+    //timer for the paced acquisition, only runs in HEARTRATE_ACQUISITION_TIMER mode
+    Error_init(&eb);
+    Timer_Params_init(&timerParams);
+    timerParams.period = ACQUISITION_TIMER_PERIOD_US;
+    timerParams.periodType = Timer_PeriodType_MICROSECS;
+    timerParams.startMode = Timer_StartMode_USER;
+    acquisitionTimer = Timer_create(Timer_ANY, timerFunction, &timerParams, &eb);
+    if (acquisitionTimer == NULL)
+        System_abort("Acquisition timer create failed");
+
+    //one FFT task for all sensors, only busy while the FFT estimator is selected
+    Error_init(&eb);
+    Semaphore_Params_init(&semParams);
+    fftSem = Semaphore_create(0, &semParams, &eb);
+    if (fftSem == NULL)
+        System_abort("FFT semaphore create failed");
+    latency_reset(&fftCost);
     Error_init(&eb);
     Task_Params_init(&params);
-    params.stackSize = 1024; /* stack in bytes */
-    params.priority = prio; /* 0-15 (15 is highest priority on default -> see RTOS Task configuration) */
-    params.instance->name = "heartrate";
+    params.stackSize = 1024;
+    params.priority = FFT_PRIORITY;
+    params.instance->name = "heartrateFFT";
+    if (Task_create(fft_run, &params, &eb) == NULL)
+        System_abort("FFT task create failed");
 
-    taskHeartrate = Task_create(heartrate_run, &params, &eb);
-    if (taskHeartrate == NULL)
-        System_abort("TaskLed create failed");
-    else
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
     {
-        System_printf("Created heartrate main Task\n");
-        System_flush();
-    }
-
-    //create heartrate clock task
-    Clock_Params clockParams;
-    Clock_Handle myClock;
+        sensor = &sensors[i];
+        memset(sensor, 0, sizeof(*sensor));
+        sensor->id = i;
+        sensor->i2cIndex = sensorConfig[i].i2cIndex;
+        sensor->gpioIndex = sensorConfig[i].gpioIndex;
+        sensor->ledCurrent = MAX30100_LED_IR_MAX;
+        latency_reset(&sensor->estimatorCost);
+        resetJitter(sensor, SAMPLE_PERIOD_US);
+
+        Error_init(&eb);
+        Semaphore_Params_init(&semParams);
+        sensor->dataSem = Semaphore_create(0, &semParams, &eb);
+        if (sensor->dataSem == NULL)
+            System_abort("Heartrate semaphore create failed");
+
+        /* Create heartrate task, one per sensor */
+        Error_init(&eb);
+        Task_Params_init(&params);
+        params.stackSize = 1024; /* stack in bytes */
+        params.priority = prio; /* 0-15 (15 is highest priority on default -> see RTOS Task configuration) */
+        System_sprintf(taskNames[i], "heartrate%u", i);
+        params.instance->name = taskNames[i];
+        params.arg0 = (UArg) sensor;
+
+        taskHeartrate = Task_create(heartrate_run, &params, &eb);
+        if (taskHeartrate == NULL)
+            System_abort("TaskLed create failed");
+        else
+        {
+            System_printf("Created heartrate main Task %u\n", i);
+            System_flush();
+        }
 
-    Error_init(&eb);
-    Clock_Params_init(&clockParams);
-    clockParams.period = FREQUENCY;
-    clockParams.startFlag = TRUE;
-    clockParams.arg = 0; // Don't have anything to pass to the function
-    myClock = Clock_create(clockFunction, FREQUENCY, &clockParams, &eb); //Frequency is passed into create_clock to configure ticks waited until first invoke, and clockparams.period for every invoke after that
-    if (myClock == NULL)
-        System_abort("Clock create failed");
-    else
-    {
-        System_printf("Created Clock Task\n");
-        System_flush();
+        //create heartrate clock task, every sensor runs its own estimator
+        Error_init(&eb);
+        Clock_Params_init(&clockParams);
+        clockParams.period = FREQUENCY;
+        clockParams.startFlag = TRUE;
+        clockParams.arg = (UArg) sensor;
+        myClock = Clock_create(clockFunction, FREQUENCY, &clockParams, &eb); //Frequency is passed into create_clock to configure ticks waited until first invoke, and clockparams.period for every invoke after that
+        if (myClock == NULL)
+            System_abort("Clock create failed");
+        else
+        {
+            System_printf("Created Clock Task %u\n", i);
+            System_flush();
+        }
     }
 }
 
 //I2CIntRegister(SLAVEADDR, interruptFunction);
-static void heartrate_run()
+static void heartrate_run(UArg arg0, UArg arg1)
 {
-    I2C_Params i2cparams;
-    uint8_t readBuffer = 0; //I2C always reads 4 bytes? (or at least max 4 bytes?)
-
-    I2C_Params_init(&i2cparams);
-    i2cparams.bitRate = I2C_400kHz;
-    i2cparams.transferMode = I2C_MODE_BLOCKING;/*important if you call I2C_transfer in Task context*/
-    handle = I2C_open(EK_TM4C1294XL_I2C8, &i2cparams);
-    if (handle == NULL)
+    heartrateSensor *sensor = (heartrateSensor *) arg0;
+    heartrateFifoBlock *block;
+
+    if (!heartrateI2C_open(&sensor->bus, sensor->i2cIndex, sensor->dataSem))
     {
         System_abort("I2C was not opened");
     }
 
-    Error_Block er;
-    Semaphore_Params params;
-    Semaphore_Params_init(&params);
-
-    interruptSem = Semaphore_create(0, &params, &er);
-
-    initInterrupt();
     //since the power on interrupt is a lie we initialize here.
-    init();
+    if (!init(sensor))
+    {
+        //nothing connected to this bus, the other sensors keep running
+        System_printf("Heartrate sensor %u not found\n", sensor->id);
+        System_flush();
+        heartrateI2C_close(&sensor->bus);
+        sensorStarted();
+        return;
+    }
+    initInterrupt(sensor);
+    sensorStarted();
 
-    while (1)       //GPIO INt pin suchen anschauen implementieren
+    while (1)
     {
-        if (Semaphore_pend(interruptSem, BIOS_WAIT_FOREVER))
+        //the I2C chain reads status, pointers and FIFO on its own, the task only sees complete blocks
+        if (Semaphore_pend(sensor->dataSem, BIOS_WAIT_FOREVER))
         {
-            //read interrupt register
-            readBuffer = I2C_read(0x00);
-
-            switch (readBuffer)
+            while (heartrateI2C_takeBlock(&sensor->bus, &block))
             {
-            case 0b00000001: //Power On -> init; Or not. Interrupt is a lie.
-                System_printf("Halleluja, der Messiah hat vorbeigeschaut!");
-                System_flush();
-                break;
-
-            case 0b00100000: //heartrate Data ready -> go fetch
-                readFIFOData();
-                break;
-            default:
-                System_printf("funky interrupts %u\n", readBuffer);
-                System_flush();
-                break;
+                storeFIFOBlock(sensor, block);
+                heartrateI2C_releaseBlock(&sensor->bus);
             }
 
-            GPIO_clearInt(EK_TM4C1294XL_CLICK_2);
+            if (sensor->bus.needsRecovery || sensor->bus.sensorReset)
+                recover(sensor);
+            if (sensor->ledOff != sensor->ledApplied)
+                applyDutyCycle(sensor);
+            if (sensor->gainSamples >= GAIN_PERIOD)
+                controlGain(sensor);
         }
 
     }
@@ -150,164 +269,584 @@ static void heartrate_run()
     //I2C_close(handle);
 }
 
-static void init()
+/* returns false if no MAX30100 answers on the sensors bus */
+static bool init(heartrateSensor *sensor)
 {
-    /* prepare sensor data buffer */
-    memset(sensor_data, 0, sizeof(*sensor_data) * SENSOR_DATA_SIZE);
-    data_count = 0;
+    heartrateI2C *bus = &sensor->bus;
+    uint8_t partId = 0;
 
-    //set mode to 010 in mode configuration register for heartrate only
-    I2C_write(0x06, 0b00000010);
+    //check if there is a sensor at all, a missing one must not stop the others
+    if (!heartrateI2C_read(bus, MAX30100_PART_ID, &partId) || partId != PART_ID)
+        return false;
 
+    //set mode to 010 in mode configuration register for heartrate only
     //set sample rate to 000 in SpO2 config register (apparently also configures the IR LED for heartrate)
     //for 50 samples per second and pulse width 11 for 16 bit resolution (lowest res is 13, so its 2 bytes either way)
-    I2C_write(0x07, 0b00000011);
+    //set IR LED current in LED configuration register, 50 mA at the start, the gain control takes it from there
+    //initialise FIFO to known (empty state)
+    //set FIFO write pointer, overflow counter and read pointer to zero
+    //enable heartrate interrupt in interrupt enable register
+    //clear out any interrupts that have already accumulated
+    bus->sensorReset = false;
+    sensor->ledApplied = false;
+    heartrateQuality_restart(&sensor->quality);
+    return heartrateI2C_write(bus, MAX30100_MODE_CONFIG, MAX30100_MODE_HR)
+            && heartrateI2C_write(bus, MAX30100_SPO2_CONFIG, 0b00000011)
+            && heartrateI2C_write(bus, MAX30100_LED_CONFIG, sensor->ledCurrent)
+            && heartrateI2C_write(bus, MAX30100_FIFO_WR_PTR, 0x00)
+            && heartrateI2C_write(bus, MAX30100_OVF_COUNTER, 0x00)
+            && heartrateI2C_write(bus, MAX30100_FIFO_RD_PTR, 0x00)
+            && heartrateI2C_write(bus, MAX30100_INT_ENABLE, MAX30100_INT_HR_RDY)
+            && heartrateI2C_read(bus, MAX30100_INT_STATUS, &partId);
+}
 
-    //set IR LED current to 1111 in LED configuration register. This means 50 mA for maximum power. Mostly because we can.
-    I2C_write(0x09, 0b00001111);
+/* a glitch on the bus or a sensor reset no longer costs a reboot: reopen the bus and configure
+ * the sensor again, with a growing pause between the attempts while it stays unreachable */
+static void recover(heartrateSensor *sensor)
+{
+    uint32_t backoff = RECOVERY_BACKOFF;
 
-    //initialise FIFO to known (empty state)
-    //set FIFO write pointer to zero
-    I2C_write(0x02, 0x00);
-    //set FIFO overflow counter to zero
-    I2C_write(0x03, 0x00);
-    //set FIFO read pointer to zero
-    I2C_write(0x04, 0x00);
+    //the pacing timer keeps running, its chains would mix with the configuration writes
+    sensor->bus.recovering = true;
+    GPIO_disableInt(sensor->gpioIndex);
+    System_printf("Heartrate sensor %u recovering (%u failed transfers)\n", sensor->id, sensor->bus.failures);
+    System_flush();
 
-    //enable heartrate interrupt in interrupt enable register
-    I2C_write(0x01, 0b00100000);
+    while (1)
+    {
+        heartrateI2C_close(&sensor->bus);
+        Task_sleep(backoff);
+        if (heartrateI2C_open(&sensor->bus, sensor->i2cIndex, sensor->dataSem) && init(sensor))
+            break;
+        backoff = backoff * 2 > RECOVERY_BACKOFF_MAX ? RECOVERY_BACKOFF_MAX : backoff * 2;
+    }
 
-    //clear out any interrupts that have already accumulated
-    I2C_read(0x00);
+    sensor->bus.recoveries++;
+    sensor->bus.recovering = false;
+    GPIO_clearInt(sensor->gpioIndex);
+    if (acquisitionMode == HEARTRATE_ACQUISITION_INTERRUPT)
+        GPIO_enableInt(sensor->gpioIndex);
 }
 
-static void readFIFOData()
+/* block->time is the time the newest sample in the FIFO was taken, the older ones are
+ * reconstructed backwards from the configured sample rate. Every sample is kept, the quality
+ * stage decides which beats count */
+static void storeFIFOBlock(heartrateSensor *sensor, const heartrateFifoBlock *block)
 {
-    uint8_t read_ptr;
-    uint8_t write_ptr;
-    short samples;
-    uint8_t buffer[4];
     int i;
-    unsigned short temp;
+    const uint8_t *buffer;
+    heartrateSample *slot;
+    uint16_t raw[HEARTRATE_FIFO_DEPTH];
+    timestamp_t start = timestamp_now();
 
-    read_ptr = I2C_read(0x04);
-    write_ptr = I2C_read(0x02);
+    for (i = 0; i < block->samples; i++)
+    {
+        buffer = &block->data[i * HEARTRATE_FIFO_SAMPLE_SIZE];
+        raw[i] = (buffer[0] << 8) + buffer[1];
+        if (raw[i] > sensor->gainPeak)
+            sensor->gainPeak = raw[i];
+        sensor->gainSamples++;
+        //the ring buffer overwrites the oldest values
+        slot = &sensor->ring[sensor->writeIndex & RING_MASK];
+        slot->value = raw[i];
+        slot->time = block->time - (timestamp_t) (block->samples - 1 - i) * SAMPLE_PERIOD_US;
+        heartrateQuality_addSample(&sensor->quality, slot->time, slot->value);
+        sensor->writeIndex++;
+    }
+    passIntervals(sensor);
+    //cost of the time domain path, the quality stage is nearly all of the loop
+    sensor->qualityTime += (uint32_t) (timestamp_now() - start);
+    recorder_addSamples(sensor->id, block->time, raw, block->samples);
 
-    samples = write_ptr - read_ptr;
+    /* einzelne Werte mit value/max * 96 auf eine Kurve mit höhe 96 pixel bringen (und max 96 davon liefern wegen breite)? */
+}
 
-    if (samples < 0)
-        samples = 0x0f - read_ptr + write_ptr;
-    else if (samples == 0) //when the buffer is full read and write pointer point to the same address and since we got an interrupt there has to be data
-        samples = 16;
+/* every beat the quality stage accepted since the last block goes on as RR interval, to the
+ * bus and into the HRV window. The metrics are updated once per block, not per beat */
+static void passIntervals(heartrateSensor *sensor)
+{
+    heartrateQuality *quality = &sensor->quality;
+    uint16_t beatIndex = quality->beatIndex;
+    const heartrateBeat *beat;
+    rrMessage rr;
+    hrvMetrics metrics;
+    unsigned int key;
+
+    if (sensor->rrIndex == beatIndex)
+        return;
+    //the quality stage runs in this task, its ring never overtakes the index
+    for (; sensor->rrIndex != beatIndex; sensor->rrIndex++)
+    {
+        beat = &quality->beats[sensor->rrIndex & (QUALITY_BEATS - 1)];
+        heartrateHrv_addInterval(&sensor->hrv, beat->interval);
+        if (beat->interval == 0)
+            continue;
+        rr.timestamp = beat->time;
+        rr.sensor = sensor->id;
+        rr.interval = (uint16_t) ((beat->interval + 500) / 1000);
+        bus_publish(BUS_TOPIC_RR, &rr, sizeof(rr));
+    }
+    heartrateHrv_metrics(&sensor->hrv, &metrics);
+    //the estimator reads them in Clock context
+    key = Swi_disable();
+    sensor->variability = metrics;
+    Swi_restore(key);
+}
 
-    for (i = 0; i < samples; i++)
+/* estimator of one sensor, the heart rate from the beats the quality stage accepted since the
+ * last call. The quality is the share of accepted candidates, a window with too few of them
+ * gives no heart rate at all */
+static void clockFunction(UArg arg)
+{
+    heartrateSensor *sensor = (heartrateSensor *) arg;
+    heartrateEstimator *estimator = &sensor->estimator;
+    heartrateQuality *quality = &sensor->quality;
+    timestamp_t start = timestamp_now();
+    uint32_t qualityTime = sensor->qualityTime;
+    uint16_t writeIndex = sensor->writeIndex;
+    uint16_t beatIndex = quality->beatIndex;
+    uint16_t candidates = quality->candidates;
+    uint16_t accepted = quality->accepted;
+    const heartrateBeat *beat;
+    uint16_t count;
+    uint16_t i;
+    uint8_t intervals = 0;
+    uint64_t sum = 0;
+    uint32_t score = 0;
+    uint64_t bpm = 0;
+    heartrateMessage message;
+
+    //take the newest beats if the estimator fell behind
+    count = (uint16_t) (beatIndex - estimator->beatIndex);
+    if (count > QUALITY_BEATS)
+        count = QUALITY_BEATS;
+    for (i = 0; i < count; i++)
     {
-        I2C_readFIFO(buffer);
-        temp = (buffer[0] << 8) + buffer[1];
-        if (temp > 30000 && i < SENSOR_DATA_SIZE)
-        { //if there are meaningful values and we still have space in the array
-            sensor_data[data_count] = temp;
-            data_count++;
+        beat = &quality->beats[(uint16_t) (beatIndex - count + i) & (QUALITY_BEATS - 1)];
+        if (beat->interval > 0)
+        {
+            sum += beat->interval;
+            intervals++;
         }
     }
 
-    /* einzelne Werte mit value/max * 96 auf eine Kurve mit höhe 96 pixel bringen (und max 96 davon liefern wegen breite)? */
+    //a candidate is counted when it crosses, accepted a few samples later, so both may differ by one
+    if ((uint16_t) (candidates - estimator->candidates) > 0)
+        score = (uint32_t) (uint16_t) (accepted - estimator->accepted) * 100 / (uint16_t) (candidates - estimator->candidates);
+    message.quality = score > 100 ? 100 : (uint8_t) score;
+
+    message.sensor = sensor->id;
+    message.timestamp = writeIndex != estimator->readIndex ? sensor->ring[(writeIndex - 1) & RING_MASK].time : 0;
+    estimator->readIndex = writeIndex;
+    estimator->beatIndex = beatIndex;
+    estimator->candidates = candidates;
+    estimator->accepted = accepted;
+
+    //beats per minute from the mean of the accepted intervals
+    if (intervals >= MIN_INTERVALS && message.quality >= MIN_QUALITY)
+        bpm = (60 * TIMESTAMP_US_PER_SECOND * (uint64_t) intervals) / sum;
+    message.bpm = bpm > UINT8_MAX ? UINT8_MAX : (uint8_t) bpm;
+    //no heart rate, no variability either
+    if (message.bpm > 0)
+        message.hrv = sensor->variability;
+    else
+        memset(&message.hrv, 0, sizeof(message.hrv));
+    estimator->lastQuality = message.quality;
+    latency_add(&sensor->estimatorCost, (uint32_t) (timestamp_now() - start) + (qualityTime - estimator->qualityTime));
+    estimator->qualityTime = qualityTime;
+    if (!sensor->present)
+        return;
+
+    //the LED follows the beats in both modes, they tell whether there is a finger
+    dutyCycle(sensor, message.bpm);
+    //in FFT mode the FFT task publishes the heart rate of this window when it is done
+    if (estimatorMode == HEARTRATE_ESTIMATOR_FFT && startFft(sensor, writeIndex, &message))
+        return;
+    publish(sensor, &message);
+}
+
+/* keep the history and publish the heart rate on the bus. Clock context, or a task with the Swis disabled */
+static void publish(heartrateSensor *sensor, const heartrateMessage *message)
+{
+    sensor->estimator.lastBpm = message->bpm;
+    history_record(sensor->id, message->bpm);
+    recorder_addBpm(sensor->id, message->timestamp, message->bpm);
+    bus_publish(BUS_TOPIC_HEARTRATE, message, sizeof(*message));
 }
 
-static void I2C_write(uint8_t reg, uint8_t value)
+/* hand the newest HEARTRATE_FFT_SIZE samples to the FFT task, from the estimator. The windows of
+ * two estimator periods overlap by half. Returns false if the FFT task is still busy with the
+ * last window of this sensor or the samples have a gap, the time domain result is published then */
+static bool startFft(heartrateSensor *sensor, uint16_t writeIndex, const heartrateMessage *message)
 {
-    I2C_Transaction i2c;
-    uint8_t writeBuffer[2];
-
-    //enable heartrate interrupt
-    i2c.slaveAddress = SLAVEADDR;
-    i2c.readCount = 0;
-    i2c.readBuf = NULL;
-    writeBuffer[0] = reg; /*address of interrupt enable register*/
-    writeBuffer[1] = value; /*enable heartrate interrupt*/
-    i2c.writeCount = 2;
-    i2c.writeBuf = &writeBuffer[0];
-
-    if (!I2C_transfer(handle, &i2c))
+    const heartrateSample *oldest = &sensor->ring[(uint16_t) (writeIndex - HEARTRATE_FFT_SIZE) & RING_MASK];
+    const heartrateSample *newest = &sensor->ring[(uint16_t) (writeIndex - 1) & RING_MASK];
+    uint32_t sum = 0;
+    int32_t mean;
+    uint16_t i;
+
+    if (sensor->fftBusy || oldest->time == 0 || newest->time - oldest->time > FFT_MAX_SPAN)
     {
-        System_abort("Bad I2C transfer!");
+        fftSkipped++;
+        return false;
     }
+    //the ring only changes in the acquisition task, the Swi copies it consistently
+    for (i = 0; i < HEARTRATE_FFT_SIZE; i++)
+        sum += sensor->ring[(uint16_t) (writeIndex - HEARTRATE_FFT_SIZE + i) & RING_MASK].value;
+    mean = (int32_t) (sum / HEARTRATE_FFT_SIZE);
+    for (i = 0; i < HEARTRATE_FFT_SIZE; i++)
+        sensor->fft.data[i] = saturate16(sensor->ring[(uint16_t) (writeIndex - HEARTRATE_FFT_SIZE + i) & RING_MASK].value - mean);
+
+    heartrateFft_start(&sensor->fft, SAMPLE_RATE);
+    sensor->fftMessage = *message;
+    sensor->fftBusy = true;
+    Semaphore_post(fftSem);
+    return true;
 }
 
-static uint8_t I2C_read(uint8_t reg)
+/* runs the FFT of every window handed over, one step at a time. Between the steps it yields,
+ * so not even a task of the same priority waits for a whole transform */
+static void fft_run(UArg arg0, UArg arg1)
 {
-    I2C_Transaction i2c;
-    uint8_t readBuffer = 0;
+    heartrateSensor *sensor;
+    timestamp_t start;
+    uint32_t cost;
+    bool done;
+    uint8_t i;
+
+    while (1)
+    {
+        Semaphore_pend(fftSem, BIOS_WAIT_FOREVER);
+        for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
+        {
+            sensor = &sensors[i];
+            if (!sensor->fftBusy)
+                continue;
+            cost = 0;
+            do
+            {
+                start = timestamp_now();
+                done = heartrateFft_step(&sensor->fft);
+                cost += (uint32_t) (timestamp_now() - start);
+                Task_yield();
+            } while (!done);
+            latency_add(&fftCost, cost);
+            finishFft(sensor);
+        }
+    }
+}
 
-    i2c.slaveAddress = SLAVEADDR;
-    i2c.readCount = 1;
-    i2c.readBuf = &readBuffer;
-    i2c.writeCount = 1;
-    i2c.writeBuf = &reg;
+/* compare the FFT result with the time domain one of the same window and publish it instead */
+static void finishFft(heartrateSensor *sensor)
+{
+    heartrateMessage message = sensor->fftMessage;
+    uint8_t difference;
+    unsigned int key;
 
-    if (!I2C_transfer(handle, &i2c))
+    if (message.bpm > 0 && sensor->fft.bpm > 0)
     {
-        System_abort("Bad I2C transfer!");
+        difference = message.bpm > sensor->fft.bpm ? message.bpm - sensor->fft.bpm : sensor->fft.bpm - message.bpm;
+        fftCompared++;
+        fftDifference += difference;
+        if (difference <= FFT_AGREEMENT)
+            fftAgreed++;
+        if (difference > fftMaxDifference)
+            fftMaxDifference = difference;
     }
+    message.bpm = sensor->fft.bpm;
+    //the variability comes from the beats, without a heart rate of the FFT there is none either
+    if (message.bpm == 0)
+        memset(&message.hrv, 0, sizeof(message.hrv));
+
+    //the history is written from Clock context only, keep the Swis out meanwhile
+    key = Swi_disable();
+    publish(sensor, &message);
+    Swi_restore(key);
+    sensor->fftBusy = false;
+}
 
-    return readBuffer;
+static int16_t saturate16(int32_t value)
+{
+    return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t) value;
 }
 
-static void I2C_readFIFO(uint8_t* array)
+static void initInterrupt(heartrateSensor *sensor)
 {
-    I2C_Transaction i2c;
-    uint8_t reg = 0x05;
+    sensor->present = true;
+    GPIO_setCallback(sensor->gpioIndex, interruptFunction);
+    if (acquisitionMode == HEARTRATE_ACQUISITION_INTERRUPT)
+        GPIO_enableInt(sensor->gpioIndex);
+}
 
-    i2c.slaveAddress = SLAVEADDR;
-    i2c.readCount = 4;
-    i2c.readBuf = array;
-    i2c.writeCount = 1;
-    i2c.writeBuf = &reg;
+/* shared by all sensors, index is the board GPIO that triggered */
+static void interruptFunction(unsigned int index)
+{
+    timestamp_t now;
+    uint8_t i;
 
-    if (!I2C_transfer(handle, &i2c))
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
     {
-        System_abort("Bad I2C transfer!");
+        if (sensors[i].gpioIndex == index)
+        {
+            //drain the FIFO right from here, the task is woken up when the data is there
+            now = timestamp_now();
+            recordTrigger(&sensors[i], now);
+            heartrateI2C_startChain(&sensors[i].bus, now, false);
+        }
     }
 }
 
-void clockFunction()
+/* timer mode, drains every sensor at a fixed cadence independent of its interrupt line.
+ * The newest sample was taken up to one sample period before now */
+static void timerFunction(UArg arg)
 {
-    unsigned short median;
-    unsigned short temp_data[SENSOR_DATA_SIZE];
-    memcpy(temp_data, sensor_data, sizeof(*sensor_data) * data_count);
-    int i;
-    uint8_t heartrate = 0;
+    timestamp_t now = timestamp_now();
+    uint8_t i;
+
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
+    {
+        if (sensors[i].present)
+        {
+            recordTrigger(&sensors[i], now);
+            heartrateI2C_startChain(&sensors[i].bus, now, true);
+        }
+    }
+}
+
+/* switch between interrupt and timer driven acquisition, statistics start over */
+void heartrate_setAcquisitionMode(heartrateAcquisitionMode mode)
+{
+    uint8_t i;
 
-    qsort(temp_data, data_count, sizeof(*sensor_data), comparison);
-    median = temp_data[data_count / 2]; //yes, dividing data_count by two rounds down in case of uneven amounts of data. I don't care.
+    Timer_stop(acquisitionTimer);
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
+        GPIO_disableInt(sensors[i].gpioIndex);
 
-    for (i = 0; i < data_count; i = i + 2)
+    acquisitionMode = mode;
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
     {
-        if (sensor_data[i] <= median && sensor_data[i + 1] >= median)
-            heartrate++;
+        resetJitter(&sensors[i], mode == HEARTRATE_ACQUISITION_TIMER ? ACQUISITION_TIMER_PERIOD_US : SAMPLE_PERIOD_US);
+        if (mode == HEARTRATE_ACQUISITION_INTERRUPT && sensors[i].present)
+        {
+            GPIO_clearInt(sensors[i].gpioIndex);
+            GPIO_enableInt(sensors[i].gpioIndex);
+        }
     }
+    if (mode == HEARTRATE_ACQUISITION_TIMER)
+        Timer_start(acquisitionTimer);
+}
+
+heartrateAcquisitionMode heartrate_getAcquisitionMode(void)
+{
+    return acquisitionMode;
+}
 
-    memset(sensor_data, 0, sizeof(*sensor_data) * SENSOR_DATA_SIZE);
-    data_count = 0;
+/* select the estimator of the published heart rate, a window in the FFT task still finishes */
+void heartrate_setEstimatorMode(heartrateEstimatorMode mode)
+{
+    estimatorMode = mode;
+}
 
-    heartrate = heartrate * 12; //extrapolate from 5 seconds to 1 Minute
+heartrateEstimatorMode heartrate_getEstimatorMode(void)
+{
+    return estimatorMode;
+}
 
-    //send data to broker
-    Mailbox_post(heartrateMailbox, &heartrate, BIOS_NO_WAIT);
+/* read only access for consumers that read the ring buffer directly, NULL for an unknown sensor */
+const heartrateSensor *heartrate_getSensor(uint8_t id)
+{
+    return id < HEARTRATE_SENSOR_COUNT ? &sensors[id] : NULL;
 }
 
-static int comparison(const void* a, const void* b)
+/* print trigger jitter and bus statistics of every sensor */
+void heartrate_printStatistics(void)
 {
-    return (*(unsigned short*) a - *(unsigned short*) b);
+    heartrateSensor *sensor;
+    heartrateJitter jitter;
+    unsigned int key;
+    uint8_t i;
+
+    System_printf("Estimator: %s\n", estimatorMode == HEARTRATE_ESTIMATOR_FFT ? "FFT" : "beats");
+    System_printf("FFT: %u windows, cost avg %u max %u us, %u skipped\n",
+                  fftCost.count, latency_average(&fftCost), fftCost.max, fftSkipped);
+    System_printf("FFT vs beats: %u compared, %u agreed within %u bpm, difference avg %u max %u bpm\n",
+                  fftCompared, fftAgreed, FFT_AGREEMENT, fftCompared > 0 ? fftDifference / fftCompared : 0, fftMaxDifference);
+    System_printf("Acquisition mode: %s, nominal interval %u us\n",
+                  acquisitionMode == HEARTRATE_ACQUISITION_TIMER ? "timer" : "interrupt",
+                  acquisitionMode == HEARTRATE_ACQUISITION_TIMER ? ACQUISITION_TIMER_PERIOD_US : SAMPLE_PERIOD_US);
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
+    {
+        sensor = &sensors[i];
+        //copy, the triggers keep coming while printing
+        key = Hwi_disable();
+        jitter = sensor->jitter;
+        Hwi_restore(key);
+
+        System_printf("Sensor %u: %u triggers, interval min %u max %u us, jitter mean %u max %u us\n", i,
+                      jitter.triggers, jitter.triggers > 1 ? jitter.minInterval : 0, jitter.maxInterval,
+                      jitter.triggers > 1 ? (uint32_t) (jitter.sumJitter / (jitter.triggers - 1)) : 0, jitter.maxJitter);
+        System_printf("Sensor %u: %u transfers, %u retries, %u failures, %u recoveries\n", i,
+                      sensor->bus.transfers, sensor->bus.retryCount, sensor->bus.failures, sensor->bus.recoveries);
+        System_printf("Sensor %u: LED %s, off %u times without a finger\n", i,
+                      sensor->ledApplied ? "off" : "on", sensor->ledOffCount);
+        System_printf("Sensor %u: beats estimator cost avg %u max %u us per window\n", i,
+                      latency_average(&sensor->estimatorCost), sensor->estimatorCost.max);
+        System_printf("Sensor %u: LED current %u.%u mA, changed %u times\n", i,
+                      ledCurrents[sensor->ledCurrent] / 10, ledCurrents[sensor->ledCurrent] % 10, sensor->gainSteps);
+        System_printf("Sensor %u: quality %u percent, perfusion index %u.%02u percent, %u beats, rejected %u perfusion %u interval %u shape\n", i,
+                      sensor->estimator.lastQuality, sensor->quality.perfusion / 100, sensor->quality.perfusion % 100,
+                      sensor->quality.accepted, sensor->quality.rejectedPerfusion, sensor->quality.rejectedInterval,
+                      sensor->quality.rejectedShape);
+        System_printf("Sensor %u: HRV of %u intervals, RMSSD %u ms, SDNN %u ms, pNN50 %u percent\n", i,
+                      sensor->hrv.count, sensor->variability.rmssd, sensor->variability.sdnn, sensor->variability.pnn50);
+    }
+    System_flush();
 }
 
-static void initInterrupt()
+/* the sensors stage of the boot is reached when the last sensor finished its initialization */
+static void sensorStarted(void)
 {
-    GPIO_setCallback(EK_TM4C1294XL_CLICK_2, interruptFunction);
-    GPIO_enableInt(EK_TM4C1294XL_CLICK_2);
+    unsigned int key;
+    bool last;
+
+    key = Hwi_disable();
+    last = ++sensorsStarted == HEARTRATE_SENSOR_COUNT;
+    Hwi_restore(key);
+    if (last)
+        boot_signal(BOOT_SENSORS);
 }
 
-static void interruptFunction(unsigned int index)
+/* the LED only runs while there is a signal: after EMPTY_WINDOWS without a heart rate the sensor
+ * goes to power save, every PROBE_WINDOWS it is on for one window to look for a finger again.
+ * A found heart rate keeps it on, the measurement itself always runs at full LED current.
+ * Estimator context, the task writes the sensor */
+static void dutyCycle(heartrateSensor *sensor, uint8_t bpm)
+{
+    if (!sensor->ledOff)
+    {
+        sensor->emptyWindows = bpm > 0 ? 0 : sensor->emptyWindows + 1;
+        if (sensor->emptyWindows < EMPTY_WINDOWS)
+            return;
+        sensor->ledOff = true;
+        sensor->emptyWindows = 0;
+    }
+    else
+    {
+        if (++sensor->emptyWindows < PROBE_WINDOWS)
+            return;
+        //without a heart rate in the probe window the LED goes off again right after it
+        sensor->ledOff = false;
+        sensor->emptyWindows = EMPTY_WINDOWS - 1;
+    }
+    Semaphore_post(sensor->dataSem);
+}
+
+/* switch the LED as the estimator requested, power save keeps the configuration */
+static void applyDutyCycle(heartrateSensor *sensor)
+{
+    bool off = sensor->ledOff;
+    unsigned int key;
+
+    if (heartrateI2C_write(&sensor->bus, MAX30100_MODE_CONFIG, off ? MAX30100_MODE_SHDN | MAX30100_MODE_HR : MAX30100_MODE_HR))
+    {
+        sensor->ledApplied = off;
+        if (off)
+        {
+            //without a finger the window would only hold intervals of a past measurement
+            sensor->ledOffCount++;
+            heartrateHrv_reset(&sensor->hrv);
+            key = Swi_disable();
+            memset(&sensor->variability, 0, sizeof(sensor->variability));
+            Swi_restore(key);
+        }
+        else
+            heartrateQuality_restart(&sensor->quality);
+    }
+}
+
+/* closed loop LED current control, once every GAIN_PERIOD samples while the quality stage is settled.
+ * Between GAIN_DC_LOW and GAIN_DC_HIGH nothing changes, this dead band keeps the loop from
+ * oscillating. Outside of it the current is set whose predicted DC is nearest to GAIN_DC_TARGET,
+ * the DC scales with the current since the sensor cancels the ambient light. Going up the
+ * prediction has to stay inside the band, so a weak pulse never drives the signal into clipping */
+static void controlGain(heartrateSensor *sensor)
+{
+    uint32_t dc = heartrateQuality_baseline(&sensor->quality);
+    uint16_t ac = heartrateQuality_amplitude(&sensor->quality);
+    uint16_t peak = sensor->gainPeak;
+    uint8_t current = sensor->ledCurrent;
+    uint8_t best = current;
+    uint8_t code;
+    uint32_t predicted;
+    uint32_t distance;
+    uint32_t bestDistance = UINT32_MAX;
+    bool tooBright;
+
+    sensor->gainPeak = 0;
+    sensor->gainSamples = 0;
+    if (!heartrateQuality_isSettled(&sensor->quality) || dc == 0)
+        return;
+    if (peak >= GAIN_SATURATION || dc > GAIN_DC_HIGH)
+        tooBright = true;
+    else if (dc < GAIN_DC_LOW || (ac < GAIN_AC_MIN && dc < GAIN_DC_TARGET))
+        tooBright = false;
+    else
+        return;
+
+    for (code = MAX30100_LED_IR_MIN; code <= MAX30100_LED_IR_MAX; code++)
+    {
+        predicted = dc * ledCurrents[code] / ledCurrents[current];
+        if (tooBright ? code >= current : (code <= current || predicted > GAIN_DC_HIGH))
+            continue;
+        distance = predicted > GAIN_DC_TARGET ? predicted - GAIN_DC_TARGET : GAIN_DC_TARGET - predicted;
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            best = code;
+        }
+    }
+    if (best == current)
+        return;
+
+    if (heartrateI2C_write(&sensor->bus, MAX30100_LED_CONFIG, best))
+    {
+        sensor->ledCurrent = best;
+        sensor->gainSteps++;
+        //the DC jumps with the current, the quality stage starts over
+        heartrateQuality_restart(&sensor->quality);
+    }
+}
+
+/* interval between two triggers compared to the nominal one, interrupt context */
+static void recordTrigger(heartrateSensor *sensor, timestamp_t now)
+{
+    heartrateJitter *jitter = &sensor->jitter;
+    uint32_t interval;
+    uint32_t deviation;
+
+    if (jitter->triggers > 0)
+    {
+        interval = (uint32_t) (now - jitter->lastTrigger);
+        deviation = interval > jitter->expectedInterval ? interval - jitter->expectedInterval : jitter->expectedInterval - interval;
+        if (interval < jitter->minInterval)
+            jitter->minInterval = interval;
+        if (interval > jitter->maxInterval)
+            jitter->maxInterval = interval;
+        if (deviation > jitter->maxJitter)
+            jitter->maxJitter = deviation;
+        jitter->sumJitter += deviation;
+    }
+    jitter->lastTrigger = now;
+    jitter->triggers++;
+}
+
+static void resetJitter(heartrateSensor *sensor, uint32_t expectedInterval)
 {
-    Semaphore_post(interruptSem);
+    unsigned int key;
+
+    key = Hwi_disable();
+    memset(&sensor->jitter, 0, sizeof(sensor->jitter));
+    sensor->jitter.expectedInterval = expectedInterval;
+    sensor->jitter.minInterval = UINT32_MAX;
+    Hwi_restore(key);
 }
@@ -0,0 +1,272 @@
+/*
+ * heartrate_fft.c
+ *
+ * Fixed point FFT heart rate estimator, see heartrate_fft.h
+ */
+#include "local_inc/common.h"
+#include "local_inc/heartrate_fft.h"
+
+#define POINTS (HEARTRATE_FFT_SIZE / 2)     //complex points of the inner FFT
+#define STAGES 8                            //butterfly stages of the inner FFT, log2(POINTS)
+#define STEP_WINDOW 0
+#define STEP_REORDER 1
+#define STEP_STAGE 2                        //first butterfly stage, one step per stage
+#define STEP_SPECTRUM (STEP_STAGE + STAGES)
+#define MIN_BPM 30                          //cardiac band searched for the peak
+#define MAX_BPM 220
+#define MAX_BINS 48                         //bins of the band at the lowest sample rate used, with a neighbour on each side
+#define INPUT_RANGE 14                      //bits of the largest input sample, the complex pairs then stay below 2^15
+#define HARMONIC_RATIO 20                   //percent of the peak power a subharmonic needs to be taken as the fundamental
+#define PEAK_SHARE 40                       //percent of the band power the peak needs, less is no clear heart rate
+
+/* round(32767 * sin(2 * pi * i / HEARTRATE_FFT_SIZE)) of the first quarter wave */
+static const int16_t sineTable[HEARTRATE_FFT_SIZE / 4 + 1] = {
+        0,   402,   804,  1206,  1608,  2009,  2410,  2811,  3212,  3612,  4011,  4410,
+     4808,  5205,  5602,  5998,  6393,  6786,  7179,  7571,  7962,  8351,  8739,  9126,
+     9512,  9896, 10278, 10659, 11039, 11417, 11793, 12167, 12539, 12910, 13279, 13645,
+    14010, 14372, 14732, 15090, 15446, 15800, 16151, 16499, 16846, 17189, 17530, 17869,
+    18204, 18537, 18868, 19195, 19519, 19841, 20159, 20475, 20787, 21096, 21403, 21705,
+    22005, 22301, 22594, 22884, 23170, 23452, 23731, 24007, 24279, 24547, 24811, 25072,
+    25329, 25582, 25832, 26077, 26319, 26556, 26790, 27019, 27245, 27466, 27683, 27896,
+    28105, 28310, 28510, 28706, 28898, 29085, 29268, 29447, 29621, 29791, 29956, 30117,
+    30273, 30424, 30571, 30714, 30852, 30985, 31113, 31237, 31356, 31470, 31580, 31685,
+    31785, 31880, 31971, 32057, 32137, 32213, 32285, 32351, 32412, 32469, 32521, 32567,
+    32609, 32646, 32678, 32705, 32728, 32745, 32757, 32765, 32767,
+};
+
+static void applyWindow(heartrateFft *fft);
+static void reorder(heartrateFft *fft);
+static void butterflies(heartrateFft *fft, uint8_t stage);
+static void findPeak(heartrateFft *fft);
+static uint32_t magnitude(uint64_t power);
+static int32_t sine(uint16_t i);
+static int32_t cosine(uint16_t i);
+
+/* data holds a new window, the transform starts over */
+void heartrateFft_start(heartrateFft *fft, uint16_t sampleRate)
+{
+    fft->sampleRate = sampleRate;
+    fft->step = STEP_WINDOW;
+    fft->bpm = 0;
+}
+
+/* one step of the transform, returns true when bpm holds the result */
+bool heartrateFft_step(heartrateFft *fft)
+{
+    if (fft->step == STEP_WINDOW)
+        applyWindow(fft);
+    else if (fft->step == STEP_REORDER)
+        reorder(fft);
+    else if (fft->step < STEP_SPECTRUM)
+        butterflies(fft, fft->step - STEP_STAGE);
+    else
+    {
+        findPeak(fft);
+        return true;
+    }
+    fft->step++;
+    return false;
+}
+
+/* Hann window, then every sample is scaled up so the largest one has INPUT_RANGE bits,
+ * the butterflies halve every stage and would lose a weak pulse otherwise */
+static void applyWindow(heartrateFft *fft)
+{
+    int32_t largest = 0;
+    int32_t value;
+    uint8_t shift = 0;
+    uint16_t i;
+
+    for (i = 0; i < HEARTRATE_FFT_SIZE; i++)
+    {
+        value = (fft->data[i] * ((32767 - cosine(i)) >> 1)) >> 15;
+        fft->data[i] = (int16_t) value;
+        if (value < 0)
+            value = -value;
+        if (value > largest)
+            largest = value;
+    }
+    while (largest > 0 && (largest << (shift + 1)) < (1 << INPUT_RANGE))
+        shift++;
+    for (i = 0; i < HEARTRATE_FFT_SIZE; i++)
+        fft->data[i] = (int16_t) (fft->data[i] << shift);
+}
+
+/* the real samples are the complex points (even + j odd), bring them into bit reversed order */
+static void reorder(heartrateFft *fft)
+{
+    int16_t *data = fft->data;
+    int16_t swap;
+    uint16_t i;
+    uint16_t j = 0;
+    uint16_t bit;
+
+    for (i = 0; i < POINTS; i++)
+    {
+        if (i < j)
+        {
+            swap = data[2 * i];
+            data[2 * i] = data[2 * j];
+            data[2 * j] = swap;
+            swap = data[2 * i + 1];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j + 1] = swap;
+        }
+        for (bit = POINTS >> 1; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+    }
+}
+
+/* one radix 2 decimation in time stage, every butterfly halves its results against overflow */
+static void butterflies(heartrateFft *fft, uint8_t stage)
+{
+    int16_t *data = fft->data;
+    uint16_t half = 1 << stage;
+    uint16_t stride = HEARTRATE_FFT_SIZE / (2 * half);
+    uint16_t start;
+    uint16_t k;
+    uint16_t a;
+    uint16_t b;
+    int32_t wr;
+    int32_t wi;
+    int32_t tr;
+    int32_t ti;
+    int32_t ar;
+    int32_t ai;
+
+    for (k = 0; k < half; k++)
+    {
+        //W = exp(-j * 2 * pi * k / (2 * half)), taken from the table of the real size
+        wr = cosine(k * stride);
+        wi = -sine(k * stride);
+        for (start = 0; start < POINTS; start += 2 * half)
+        {
+            a = 2 * (start + k);
+            b = a + 2 * half;
+            tr = (wr * data[b] - wi * data[b + 1]) >> 15;
+            ti = (wr * data[b + 1] + wi * data[b]) >> 15;
+            ar = data[a];
+            ai = data[a + 1];
+            data[a] = (int16_t) ((ar + tr) >> 1);
+            data[a + 1] = (int16_t) ((ai + ti) >> 1);
+            data[b] = (int16_t) ((ar - tr) >> 1);
+            data[b + 1] = (int16_t) ((ai - ti) >> 1);
+        }
+    }
+}
+
+/* split the complex spectrum into the one of the real samples, only for the cardiac band,
+ * and take its peak */
+static void findPeak(heartrateFft *fft)
+{
+    const int16_t *z = fft->data;
+    uint64_t power[MAX_BINS];
+    uint16_t first = (uint16_t) ((uint32_t) MIN_BPM * HEARTRATE_FFT_SIZE / (60 * fft->sampleRate));
+    uint16_t last = (uint16_t) ((uint32_t) MAX_BPM * HEARTRATE_FFT_SIZE / (60 * fft->sampleRate));
+    uint16_t k;
+    uint16_t m;
+    uint16_t peak;
+    uint16_t fundamental;
+    int32_t er;
+    int32_t ei;
+    int32_t dr;
+    int32_t di;
+    int32_t xr;
+    int32_t xi;
+    uint64_t total = 0;
+    int32_t left;
+    int32_t centre;
+    int32_t right;
+    int32_t offset = 0;
+
+    if (first < 2)
+        first = 2;
+    if (last - first + 3 > MAX_BINS)
+        last = first + MAX_BINS - 3;
+
+    //X[k] = (Z[k] + Z*[N/2-k]) / 2 - j/2 W^k (Z[k] - Z*[N/2-k]), with one neighbour on each side
+    for (k = first - 1; k <= last + 1; k++)
+    {
+        m = POINTS - k;
+        er = (z[2 * k] + z[2 * m]) >> 1;
+        ei = (z[2 * k + 1] - z[2 * m + 1]) >> 1;
+        dr = (z[2 * k + 1] + z[2 * m + 1]) >> 1;
+        di = (z[2 * m] - z[2 * k]) >> 1;
+        xr = er + ((cosine(k) * dr + sine(k) * di) >> 15);
+        xi = ei + ((cosine(k) * di - sine(k) * dr) >> 15);
+        power[k - first + 1] = (uint64_t) ((int64_t) xr * xr + (int64_t) xi * xi);
+    }
+
+    peak = first;
+    for (k = first; k <= last; k++)
+    {
+        total += power[k - first + 1];
+        if (power[k - first + 1] > power[peak - first + 1])
+            peak = k;
+    }
+    if (power[peak - first + 1] == 0
+            || (power[peak - first] + power[peak - first + 1] + power[peak - first + 2]) * 100 < total * PEAK_SHARE)
+        return;
+
+    //a strong subharmonic is the fundamental, the peak only its second harmonic
+    fundamental = 0;
+    for (k = peak / 2 - 1; k <= peak / 2 + 1; k++)
+    {
+        if (k >= first && (fundamental == 0 || power[k - first + 1] > power[fundamental - first + 1]))
+            fundamental = k;
+    }
+    if (fundamental != 0 && power[fundamental - first + 1] * 100 >= power[peak - first + 1] * HARMONIC_RATIO)
+        peak = fundamental;
+    if (peak > first && peak < last)
+    {
+        //vertex of the parabola through the magnitudes of the peak and its neighbours, in 1/256 bins
+        left = magnitude(power[peak - first]);
+        centre = magnitude(power[peak - first + 1]);
+        right = magnitude(power[peak - first + 2]);
+        if (left - 2 * centre + right < 0)
+            offset = 128 * (left - right) / (left - 2 * centre + right);
+    }
+    fft->bpm = (uint8_t) ((((int32_t) peak * 256 + offset) * 60 * fft->sampleRate / HEARTRATE_FFT_SIZE + 128) / 256);
+}
+
+/* integer square root, bit by bit, three times per window */
+static uint32_t magnitude(uint64_t power)
+{
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t) 1 << 62;
+
+    while (bit > power)
+        bit >>= 2;
+    while (bit != 0)
+    {
+        if (power >= root + bit)
+        {
+            power -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+            root >>= 1;
+        bit >>= 2;
+    }
+    return (uint32_t) root;
+}
+
+/* sin(2 * pi * i / HEARTRATE_FFT_SIZE) in Q15 */
+static int32_t sine(uint16_t i)
+{
+    i &= HEARTRATE_FFT_SIZE - 1;
+    if (i <= HEARTRATE_FFT_SIZE / 4)
+        return sineTable[i];
+    if (i <= HEARTRATE_FFT_SIZE / 2)
+        return sineTable[HEARTRATE_FFT_SIZE / 2 - i];
+    if (i <= 3 * HEARTRATE_FFT_SIZE / 4)
+        return -sineTable[i - HEARTRATE_FFT_SIZE / 2];
+    return -sineTable[HEARTRATE_FFT_SIZE - i];
+}
+
+/* cos(2 * pi * i / HEARTRATE_FFT_SIZE) in Q15 */
+static int32_t cosine(uint16_t i)
+{
+    return sine(i + HEARTRATE_FFT_SIZE / 4);
+}
@@ -0,0 +1,116 @@
+/*
+ * heartrate_hrv.c
+ *
+ * Incremental heart rate variability, see heartrate_hrv.h
+ */
+#include "local_inc/common.h"
+#include "local_inc/heartrate_hrv.h"
+
+#define NN50_LIMIT 50000            //us, successive differences above count for pNN50
+#define US_PER_MS 1000
+
+static void dropOldest(heartrateHrv *hrv, const heartrateRr *rr);
+static uint16_t toMilliseconds(uint64_t variance);
+static uint32_t squareRoot(uint64_t value);
+
+/* empty window, the next interval starts a new chain */
+void heartrateHrv_reset(heartrateHrv *hrv)
+{
+    memset(hrv, 0, sizeof(*hrv));
+}
+
+/* the next RR interval in us, replaces the oldest one of a full window.
+ * 0 is the gap of a rejected beat, the next interval is not successive then */
+void heartrateHrv_addInterval(heartrateHrv *hrv, uint32_t interval)
+{
+    heartrateRr *rr = &hrv->window[hrv->next];
+    int64_t difference;
+
+    if (interval == 0)
+    {
+        hrv->lastInterval = 0;
+        return;
+    }
+    if (hrv->count == HRV_WINDOW)
+        dropOldest(hrv, rr);
+    else
+        hrv->count++;
+
+    rr->interval = interval;
+    rr->successive = hrv->lastInterval != 0;
+    rr->difference = rr->successive ? (int32_t) (interval - hrv->lastInterval) : 0;
+    hrv->sum += interval;
+    hrv->sumSquares += (uint64_t) interval * interval;
+    if (rr->successive)
+    {
+        difference = rr->difference;
+        hrv->differenceSquares += (uint64_t) (difference * difference);
+        hrv->differences++;
+        if (difference > NN50_LIMIT || difference < -NN50_LIMIT)
+            hrv->nn50++;
+    }
+    hrv->next = (hrv->next + 1) & (HRV_WINDOW - 1);
+    hrv->lastInterval = interval;
+}
+
+/* RMSSD, SDNN and pNN50 of the window, all 0 until it holds HRV_MIN_INTERVALS */
+void heartrateHrv_metrics(const heartrateHrv *hrv, hrvMetrics *metrics)
+{
+    uint64_t n = hrv->count;
+
+    memset(metrics, 0, sizeof(*metrics));
+    if (n < HRV_MIN_INTERVALS)
+        return;
+    //sample variance from the sums, n * sum(x^2) - sum(x)^2 stays far below 2^64 for a minute of intervals
+    metrics->sdnn = toMilliseconds((n * hrv->sumSquares - hrv->sum * hrv->sum) / (n * (n - 1)));
+    if (hrv->differences == 0)
+        return;
+    metrics->rmssd = toMilliseconds(hrv->differenceSquares / hrv->differences);
+    metrics->pnn50 = (uint8_t) (hrv->nn50 * 100 / hrv->differences);
+}
+
+/* take the oldest interval out of the sums */
+static void dropOldest(heartrateHrv *hrv, const heartrateRr *rr)
+{
+    int64_t difference = rr->difference;
+
+    hrv->sum -= rr->interval;
+    hrv->sumSquares -= (uint64_t) rr->interval * rr->interval;
+    if (rr->successive)
+    {
+        hrv->differenceSquares -= (uint64_t) (difference * difference);
+        hrv->differences--;
+        if (difference > NN50_LIMIT || difference < -NN50_LIMIT)
+            hrv->nn50--;
+    }
+}
+
+/* square root of a variance in us^2, rounded to ms */
+static uint16_t toMilliseconds(uint64_t variance)
+{
+    uint32_t root = (squareRoot(variance) + US_PER_MS / 2) / US_PER_MS;
+
+    return root > UINT16_MAX ? UINT16_MAX : (uint16_t) root;
+}
+
+/* integer square root, bit by bit */
+static uint32_t squareRoot(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t) 1 << 62;
+
+    while (bit > value)
+        bit >>= 2;
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+            root >>= 1;
+        bit >>= 2;
+    }
+    return (uint32_t) root;
+}
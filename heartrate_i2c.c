@@ -0,0 +1,320 @@
+/*
+ * heartrate_i2c.c
+ *
+ * Non blocking I2C transaction chain for the MAX30100, see heartrate_i2c.h
+ */
+#include "local_inc/common.h"
+#include "local_inc/heartrate_i2c.h"
+
+#include <ti/sysbios/hal/Hwi.h>
+
+#define SLAVEADDR 0b1010111 //tiva ware appends the one and zero on its own
+#define SYNC_TIMEOUT 100    //ticks (ms) a single register access may take before the bus is considered stuck
+#define SYNC_ATTEMPTS 50    //times a synchronous access waits 1 ms for a running chain to finish
+
+static void submit(heartrateI2C *bus, uint8_t reg, uint8_t writeCount, uint8_t *readBuf, size_t readCount);
+static void transferCallback(I2C_Handle handle, I2C_Transaction *transaction, bool success);
+static void transferFailed(heartrateI2C *bus);
+static void finishChain(heartrateI2C *bus, bool blockComplete);
+static bool transferSync(heartrateI2C *bus, uint8_t reg, uint8_t value, uint8_t writeCount, uint8_t *readBuf,
+                         size_t readCount);
+
+/* open the I2C master of a sensor in callback mode, blockSem gets posted for every FIFO block */
+bool heartrateI2C_open(heartrateI2C *bus, unsigned int i2cIndex, Semaphore_Handle blockSem)
+{
+    I2C_Params i2cparams;
+    Semaphore_Params semParams;
+    Error_Block eb;
+
+    bus->i2cIndex = i2cIndex;
+    bus->blockSem = blockSem;
+    bus->step = HEARTRATE_I2C_IDLE;
+    bus->retries = 0;
+    bus->pending = false;
+    bus->needsRecovery = false;
+    bus->sensorReset = false;
+    bus->fillBlock = 0;
+    bus->readyBlocks = 0;
+
+    if (bus->syncSem != NULL)
+    {
+        //a sync access that timed out before the reopen may have been completed after all
+        while (Semaphore_pend(bus->syncSem, BIOS_NO_WAIT))
+            ;
+    }
+    else
+    {
+        Error_init(&eb);
+        Semaphore_Params_init(&semParams);
+        semParams.mode = Semaphore_Mode_BINARY;
+        bus->syncSem = Semaphore_create(0, &semParams, &eb);
+        if (bus->syncSem == NULL)
+            return false;
+    }
+
+    I2C_Params_init(&i2cparams);
+    i2cparams.bitRate = I2C_400kHz;
+    i2cparams.transferMode = I2C_MODE_CALLBACK; //transfers return at once, the chain continues in transferCallback
+    i2cparams.transferCallbackFxn = transferCallback;
+    bus->handle = I2C_open(i2cIndex, &i2cparams);
+
+    return bus->handle != NULL;
+}
+
+/* close the I2C master, used by the recovery to reset the peripheral */
+void heartrateI2C_close(heartrateI2C *bus)
+{
+    if (bus->handle != NULL)
+        I2C_close(bus->handle);
+    bus->handle = NULL;
+    bus->step = HEARTRATE_I2C_IDLE;
+}
+
+/* write one register, task context only. Waits until a running chain is finished */
+bool heartrateI2C_write(heartrateI2C *bus, uint8_t reg, uint8_t value)
+{
+    return transferSync(bus, reg, value, 2, NULL, 0);
+}
+
+/* read one register, task context only. Waits until a running chain is finished */
+bool heartrateI2C_read(heartrateI2C *bus, uint8_t reg, uint8_t *value)
+{
+    return transferSync(bus, reg, 0, 1, value, 1);
+}
+
+/* start draining the sensor, callable from Hwi, Swi and Task context.
+ * time is the time the newest sample in the FIFO was taken. A paced chain comes from a timer
+ * instead of the sensor interrupt, it reads the FIFO even without the data ready flag */
+void heartrateI2C_startChain(heartrateI2C *bus, timestamp_t time, bool paced)
+{
+    unsigned int key;
+
+    key = Hwi_disable();
+    if (bus->needsRecovery || bus->recovering || bus->handle == NULL)
+    {
+        Hwi_restore(key);
+        return;
+    }
+    if (bus->step != HEARTRATE_I2C_IDLE || bus->readyBlocks == HEARTRATE_I2C_BLOCKS)
+    {
+        //bus busy or no free block, remember to drain again as soon as possible
+        bus->pending = true;
+        bus->paced = paced;
+        bus->chainTime = time;
+        Hwi_restore(key);
+        return;
+    }
+    bus->step = HEARTRATE_I2C_STATUS;
+    bus->paced = paced;
+    bus->chainTime = time;
+    Hwi_restore(key);
+
+    submit(bus, MAX30100_INT_STATUS, 1, &bus->status, 1);
+}
+
+/* get the oldest complete FIFO block, has to be released after processing */
+bool heartrateI2C_takeBlock(heartrateI2C *bus, heartrateFifoBlock **block)
+{
+    unsigned int key;
+    uint8_t index;
+
+    key = Hwi_disable();
+    if (bus->readyBlocks == 0)
+    {
+        Hwi_restore(key);
+        return false;
+    }
+    index = (bus->fillBlock + HEARTRATE_I2C_BLOCKS - bus->readyBlocks) % HEARTRATE_I2C_BLOCKS;
+    Hwi_restore(key);
+
+    *block = &bus->blocks[index];
+    return true;
+}
+
+/* hand the block taken with heartrateI2C_takeBlock back to the chain */
+void heartrateI2C_releaseBlock(heartrateI2C *bus)
+{
+    unsigned int key;
+    bool restart;
+
+    key = Hwi_disable();
+    if (bus->readyBlocks > 0)
+        bus->readyBlocks--;
+    restart = bus->pending && bus->step == HEARTRATE_I2C_IDLE;
+    if (restart)
+        bus->pending = false;
+    Hwi_restore(key);
+
+    //an interrupt was skipped because all blocks were in use
+    if (restart)
+        heartrateI2C_startChain(bus, bus->chainTime, bus->paced);
+}
+
+/* queue one register access, reg is the first register, readCount bytes are read from there */
+static void submit(heartrateI2C *bus, uint8_t reg, uint8_t writeCount, uint8_t *readBuf, size_t readCount)
+{
+    bus->writeBuffer[0] = reg;
+    bus->transaction.slaveAddress = SLAVEADDR;
+    bus->transaction.writeBuf = bus->writeBuffer;
+    bus->transaction.writeCount = writeCount;
+    bus->transaction.readBuf = readBuf;
+    bus->transaction.readCount = readCount;
+    bus->transaction.arg = bus;
+
+    if (!I2C_transfer(bus->handle, &bus->transaction))
+        transferFailed(bus);
+}
+
+/* runs in interrupt context after every transaction, continues the chain without the task */
+static void transferCallback(I2C_Handle handle, I2C_Transaction *transaction, bool success)
+{
+    heartrateI2C *bus = (heartrateI2C *) transaction->arg;
+    heartrateFifoBlock *block;
+    uint8_t samples;
+
+    if (!success)
+    {
+        transferFailed(bus);
+        return;
+    }
+    bus->retries = 0;
+    bus->transfers++;
+
+    switch (bus->step)
+    {
+    case HEARTRATE_I2C_SYNC:
+        bus->syncSuccess = true;
+        bus->step = HEARTRATE_I2C_IDLE;
+        Semaphore_post(bus->syncSem);
+        break;
+
+    case HEARTRATE_I2C_STATUS:
+        if (bus->status & MAX30100_INT_PWR_RDY) //sensor went through a power on reset and lost its configuration
+            bus->sensorReset = true;
+        if ((bus->status & MAX30100_INT_HR_RDY) || bus->paced)
+        {
+            bus->step = HEARTRATE_I2C_POINTERS;
+            submit(bus, MAX30100_FIFO_WR_PTR, 1, bus->pointers, sizeof(bus->pointers));
+        }
+        else
+            finishChain(bus, false);
+        break;
+
+    case HEARTRATE_I2C_POINTERS:
+        //pointers[0] write pointer, pointers[1] overflow counter, pointers[2] read pointer
+        samples = (bus->pointers[0] - bus->pointers[2]) & (HEARTRATE_FIFO_DEPTH - 1);
+        //when the buffer is full read and write pointer point to the same address. After an interrupt there has to be data,
+        //a timer only finds a full FIFO if samples were lost already
+        if (samples == 0 && (!bus->paced || bus->pointers[1] > 0))
+            samples = HEARTRATE_FIFO_DEPTH;
+        if (samples == 0)
+        {
+            finishChain(bus, false);
+            break;
+        }
+        block = &bus->blocks[bus->fillBlock];
+        block->time = bus->chainTime;
+        block->samples = samples;
+        block->overflow = bus->pointers[1];
+        bus->step = HEARTRATE_I2C_FIFO;
+        submit(bus, MAX30100_FIFO_DATA, 1, block->data, samples * HEARTRATE_FIFO_SAMPLE_SIZE);
+        break;
+
+    case HEARTRATE_I2C_FIFO:
+        finishChain(bus, true);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/* retry the current transaction, if that does not help leave the recovery to the task */
+static void transferFailed(heartrateI2C *bus)
+{
+    if (bus->retries < HEARTRATE_I2C_RETRIES)
+    {
+        bus->retries++;
+        bus->retryCount++;
+        if (I2C_transfer(bus->handle, &bus->transaction))
+            return;
+    }
+
+    bus->retries = 0;
+    bus->failures++;
+    if (bus->step == HEARTRATE_I2C_SYNC)
+    {
+        //the task is waiting for the result and decides on its own
+        bus->syncSuccess = false;
+        bus->step = HEARTRATE_I2C_IDLE;
+        Semaphore_post(bus->syncSem);
+        return;
+    }
+    bus->step = HEARTRATE_I2C_IDLE;
+    bus->needsRecovery = true;
+    Semaphore_post(bus->blockSem);
+}
+
+/* end of a chain, hand a filled block to the task and start the next chain if one is pending */
+static void finishChain(heartrateI2C *bus, bool blockComplete)
+{
+    bool restart;
+
+    if (blockComplete)
+    {
+        bus->fillBlock = (bus->fillBlock + 1) % HEARTRATE_I2C_BLOCKS;
+        bus->readyBlocks++;
+    }
+    bus->step = HEARTRATE_I2C_IDLE;
+    restart = bus->pending && bus->readyBlocks < HEARTRATE_I2C_BLOCKS;
+    if (restart)
+        bus->pending = false;
+
+    if (blockComplete || bus->sensorReset)
+        Semaphore_post(bus->blockSem);
+    if (restart)
+        heartrateI2C_startChain(bus, bus->chainTime, bus->paced);
+}
+
+/* single transaction out of task context, waits for the callback.
+ * The write buffer is shared with the chain, it is only filled once the bus belongs to the task */
+static bool transferSync(heartrateI2C *bus, uint8_t reg, uint8_t value, uint8_t writeCount, uint8_t *readBuf,
+                         size_t readCount)
+{
+    unsigned int key;
+    uint8_t attempts;
+
+    for (attempts = 0; attempts < SYNC_ATTEMPTS; attempts++)
+    {
+        key = Hwi_disable();
+        if (bus->handle == NULL || bus->needsRecovery)
+        {
+            //closed or waiting for the task to reopen it, nothing may be queued on it
+            Hwi_restore(key);
+            return false;
+        }
+        if (bus->step == HEARTRATE_I2C_IDLE)
+        {
+            bus->step = HEARTRATE_I2C_SYNC;
+            Hwi_restore(key);
+            break;
+        }
+        Hwi_restore(key);
+        Task_sleep(1); //a chain is running, it is done within a few hundred us
+    }
+    if (attempts == SYNC_ATTEMPTS)
+        return false;
+
+    bus->writeBuffer[1] = value;
+    bus->syncSuccess = false;
+    submit(bus, reg, writeCount, readBuf, readCount);
+    if (!Semaphore_pend(bus->syncSem, SYNC_TIMEOUT))
+    {
+        //no callback at all, the bus hangs. The transaction may still be queued in the driver, the
+        //step stays SYNC so no chain starts on it and the task reopens the bus
+        bus->needsRecovery = true;
+        Semaphore_post(bus->blockSem);
+        return false;
+    }
+    return bus->syncSuccess;
+}
@@ -0,0 +1,219 @@
+/*
+ * heartrate_quality.c
+ *
+ * Streaming signal quality stage of the heartrate pipeline, see heartrate_quality.h
+ */
+#include "local_inc/common.h"
+#include "local_inc/heartrate_quality.h"
+
+#define BASELINE_SHIFT 6            //baseline follows the signal with 1/64 per sample, about 1.3 s at 50 Hz
+#define AMPLITUDE_SHIFT 5           //amplitude follows with 1/32 per sample, over several beats
+#define REFRACTORY_TIME 300000      //us, candidates closer to the last one are notches or noise (200 bpm)
+#define MAX_INTERVAL 2000000        //us, longer intervals are missed beats or no pulse at all (30 bpm)
+#define INTERVAL_TOLERANCE 25       //percent an interval may differ from the running average
+#define MIN_BASELINE 30000          //lower DC means no finger on the sensor, only ambient light
+#define PERFUSION_MIN 3             //0.01 %, below the pulse drowns in the noise
+#define PERFUSION_MAX 300           //0.01 %, above the finger moves
+#define CORRELATION_MIN 80          //percent correlation of a shape with the template
+#define RELEARN_REJECTS 4           //consecutive rejects until interval and template are learned again
+
+static void candidate(heartrateQuality *quality, timestamp_t time);
+static void judge(heartrateQuality *quality);
+static bool correlates(const int16_t *shape, const int16_t *beatTemplate);
+static int16_t saturate(int32_t value);
+
+/* forget the signal, the next sample starts the baseline over. Accepted beats and counters stay,
+ * the estimator keeps reading them. Called after a gap in the samples, acquisition task only */
+void heartrateQuality_restart(heartrateQuality *quality)
+{
+    quality->baseline = 0;
+    quality->settling = 1 << BASELINE_SHIFT;
+    quality->armed = false;
+    quality->lastBeat = 0;
+    quality->lastAccepted = false;
+    quality->shapeCount = QUALITY_SHAPE_SIZE;
+}
+
+/* one sample through the stage, acquisition task only */
+void heartrateQuality_addSample(heartrateQuality *quality, timestamp_t time, uint16_t value)
+{
+    int32_t deviation;
+    timestamp_t crossing;
+
+    if (quality->baseline == 0)
+    {
+        //the baseline starts right at the signal instead of rising slowly from zero
+        quality->baseline = (int32_t) value << BASELINE_SHIFT;
+        quality->amplitude = 0;
+        quality->lastDeviation = 0;
+        quality->lastTime = time;
+        return;
+    }
+    quality->baseline += value - (quality->baseline >> BASELINE_SHIFT);
+    deviation = value - (quality->baseline >> BASELINE_SHIFT);
+    quality->amplitude += (deviation < 0 ? -deviation : deviation) - (quality->amplitude >> AMPLITUDE_SHIFT);
+
+    //no candidates until the baseline follows the signal
+    if (quality->settling > 0)
+        quality->settling--;
+    //arm half an amplitude below the baseline, so noise around it does not make candidates
+    else if (deviation < -(quality->amplitude >> (AMPLITUDE_SHIFT + 1)))
+        quality->armed = true;
+    else if (quality->armed && quality->lastDeviation < 0 && deviation >= 0)
+    {
+        quality->armed = false;
+        crossing = quality->lastTime + (time - quality->lastTime) * (uint32_t) -quality->lastDeviation
+                / (uint32_t) (deviation - quality->lastDeviation);
+        candidate(quality, crossing);
+    }
+
+    if (quality->shapeCount < QUALITY_SHAPE_SIZE)
+    {
+        quality->shape[quality->shapeCount++] = saturate(deviation);
+        if (quality->shapeCount == QUALITY_SHAPE_SIZE)
+            judge(quality);
+    }
+    quality->lastDeviation = deviation;
+    quality->lastTime = time;
+}
+
+/* whether the baseline follows the signal since the last restart */
+bool heartrateQuality_isSettled(const heartrateQuality *quality)
+{
+    return quality->baseline != 0 && quality->settling == 0;
+}
+
+/* DC of the signal in ADC counts */
+uint16_t heartrateQuality_baseline(const heartrateQuality *quality)
+{
+    return (uint16_t) (quality->baseline >> BASELINE_SHIFT);
+}
+
+/* AC of the signal, mean absolute deviation from the baseline in ADC counts */
+uint16_t heartrateQuality_amplitude(const heartrateQuality *quality)
+{
+    int32_t amplitude = quality->amplitude >> AMPLITUDE_SHIFT;
+
+    return amplitude > UINT16_MAX ? UINT16_MAX : (uint16_t) amplitude;
+}
+
+/* a rising baseline crossing, its shape is collected over the next samples */
+static void candidate(heartrateQuality *quality, timestamp_t time)
+{
+    uint64_t interval = quality->lastBeat != 0 ? time - quality->lastBeat : 0;
+
+    quality->candidates++;
+    if (quality->lastBeat != 0 && interval < REFRACTORY_TIME)
+    {
+        quality->rejectedInterval++;
+        return;
+    }
+    quality->lastBeat = time;
+    quality->candidateTime = time;
+    quality->candidateInterval = interval > MAX_INTERVAL ? MAX_INTERVAL + 1 : (uint32_t) interval;
+    quality->shapeCount = 0;
+}
+
+/* the shape of the candidate is complete, all three checks decide whether it is a beat */
+static void judge(heartrateQuality *quality)
+{
+    int32_t dc = quality->baseline >> BASELINE_SHIFT;
+    uint32_t interval = quality->candidateInterval;
+    uint32_t mean = quality->meanInterval;
+    uint32_t perfusion;
+    bool perfusionOk;
+    bool intervalOk;
+    bool shapeOk;
+    heartrateBeat *beat;
+    uint8_t i;
+
+    perfusion = dc > 0 ? (uint32_t) (quality->amplitude >> AMPLITUDE_SHIFT) * 10000 / dc : 0;
+    quality->perfusion = perfusion > UINT16_MAX ? UINT16_MAX : perfusion;
+    perfusionOk = dc >= MIN_BASELINE && perfusion >= PERFUSION_MIN && perfusion <= PERFUSION_MAX;
+    //the first candidate has no interval yet
+    intervalOk = interval <= MAX_INTERVAL
+            && (mean == 0 || (interval > mean ? interval - mean : mean - interval) * 100 <= mean * INTERVAL_TOLERANCE);
+    shapeOk = !quality->hasTemplate || correlates(quality->shape, quality->beatTemplate);
+
+    if (perfusionOk && intervalOk && shapeOk)
+    {
+        beat = &quality->beats[quality->beatIndex & (QUALITY_BEATS - 1)];
+        beat->time = quality->candidateTime;
+        beat->interval = quality->lastAccepted ? interval : 0;
+        quality->beatIndex++;
+        quality->accepted++;
+
+        if (interval > 0)
+            quality->meanInterval = mean == 0 ? interval : (3 * mean + interval) / 4;
+        for (i = 0; i < QUALITY_SHAPE_SIZE; i++)
+            quality->beatTemplate[i] = quality->hasTemplate
+                    ? (3 * quality->beatTemplate[i] + quality->shape[i]) / 4 : quality->shape[i];
+        quality->hasTemplate = true;
+        quality->lastAccepted = true;
+        quality->rejectRun = 0;
+        return;
+    }
+
+    if (!perfusionOk)
+        quality->rejectedPerfusion++;
+    else if (!intervalOk)
+        quality->rejectedInterval++;
+    else
+        quality->rejectedShape++;
+    quality->lastAccepted = false;
+
+    //the rhythm or the shape changed for good, learn both again starting with this candidate
+    if (++quality->rejectRun >= RELEARN_REJECTS)
+    {
+        quality->meanInterval = 0;
+        memcpy(quality->beatTemplate, quality->shape, sizeof(quality->beatTemplate));
+        quality->hasTemplate = perfusionOk;
+        quality->rejectRun = 0;
+    }
+}
+
+/* whether the Pearson correlation of a shape and the template reaches CORRELATION_MIN.
+ * Compared squared, so no square root is needed, the sums get scaled down to stay in 64 bit */
+static bool correlates(const int16_t *shape, const int16_t *beatTemplate)
+{
+    int32_t meanShape = 0;
+    int32_t meanTemplate = 0;
+    int64_t x;
+    int64_t y;
+    int64_t sxy = 0;
+    int64_t sxx = 0;
+    int64_t syy = 0;
+    uint8_t i;
+
+    for (i = 0; i < QUALITY_SHAPE_SIZE; i++)
+    {
+        meanShape += shape[i];
+        meanTemplate += beatTemplate[i];
+    }
+    meanShape /= QUALITY_SHAPE_SIZE;
+    meanTemplate /= QUALITY_SHAPE_SIZE;
+
+    for (i = 0; i < QUALITY_SHAPE_SIZE; i++)
+    {
+        x = shape[i] - meanShape;
+        y = beatTemplate[i] - meanTemplate;
+        sxy += x * y;
+        sxx += x * x;
+        syy += y * y;
+    }
+    if (sxy <= 0 || sxx == 0 || syy == 0)
+        return false;
+
+    while (sxx >= (1 << 24) || syy >= (1 << 24))
+    {
+        sxx >>= 1;
+        syy >>= 1;
+        sxy >>= 1;
+    }
+    return (uint64_t) (sxy * sxy) * 10000 >= (uint64_t) (sxx * syy) * (CORRELATION_MIN * CORRELATION_MIN);
+}
+
+static int16_t saturate(int32_t value)
+{
+    return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t) value;
+}
@@ -0,0 +1,277 @@
+/*!
+ * \file history.c
+ * \brief ring of rings history of the heart rate, one hour per second and one day per minute
+ * The estimators feed every heart rate into the open bucket of both tiers, a 1 Hz Clock closes
+ * the second bucket every second and the minute bucket every 60 seconds. Both writers run in
+ * the Clock Swi and never preempt each other, the FFT estimator task disables the Swis to write.
+ * Readers (UART menu, OLED trend) run in Task context and copy without locking: every ring
+ * counts its written buckets, a copy is only valid if the writer did not reach the oldest
+ * copied bucket meanwhile.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/history.h"
+#include "local_inc/heartrate.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief Clock ticks (ms) of one second bucket
+#define HISTORY_TICK_PERIOD 1000
+//! \brief copies overtaken by the writer are repeated this often before a reader gives up
+#define HISTORY_READ_ATTEMPTS 3
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief heart rates of the currently open bucket
+typedef struct historyAccumulator {
+    uint32_t sum;       //!< sum of all heart rates in the open interval
+    uint16_t count;     //!< amount of heart rates in the open interval
+    uint8_t min;        //!< lowest heart rate in the open interval
+    uint8_t max;        //!< highest heart rate in the open interval
+} historyAccumulator;
+
+//! \brief one tier of one sensor
+typedef struct historyRing {
+    historyBucket *buckets;     //!< storage, size buckets
+    uint16_t size;              //!< amount of buckets
+    volatile uint32_t written;  //!< closed buckets since start, the next one goes to written % size
+    historyAccumulator open;    //!< bucket in progress, not visible to readers
+} historyRing;
+// ------------------------------------------------------------------------------ globals ---
+static historyBucket secondBuckets[HEARTRATE_SENSOR_COUNT][HISTORY_SECONDS_SIZE];
+static historyBucket minuteBuckets[HEARTRATE_SENSOR_COUNT][HISTORY_MINUTES_SIZE];
+//! \brief both tiers of every sensor, indexed by historyTier
+static historyRing rings[HEARTRATE_SENSOR_COUNT][2];
+//! \brief closed second buckets of the open minute bucket
+static uint8_t secondsInMinute;
+// ---------------------------------------------------------------------------- functions ---
+static void tickFunction(UArg arg);
+static void accumulate(historyAccumulator *open, uint8_t bpm);
+static void closeBucket(historyRing *ring);
+static uint16_t clipRange(const historyRing *ring, uint32_t written, uint32_t ago, uint16_t count, uint32_t *start);
+static void printRange(const char *label, uint8_t sensor, historyTier tier, uint16_t count);
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief set up the empty tiers and start the 1 Hz Clock, has to be called once before BIOS_start
+ */
+void history_init(void)
+{
+    Clock_Params clockParams;
+    Clock_Handle clock;
+    Error_Block eb;
+    uint8_t sensor;
+
+    for (sensor = 0; sensor < HEARTRATE_SENSOR_COUNT; sensor++)
+    {
+        rings[sensor][HISTORY_SECONDS].buckets = secondBuckets[sensor];
+        rings[sensor][HISTORY_SECONDS].size = HISTORY_SECONDS_SIZE;
+        rings[sensor][HISTORY_MINUTES].buckets = minuteBuckets[sensor];
+        rings[sensor][HISTORY_MINUTES].size = HISTORY_MINUTES_SIZE;
+    }
+
+    Error_init(&eb);
+    Clock_Params_init(&clockParams);
+    clockParams.period = HISTORY_TICK_PERIOD;
+    clockParams.startFlag = TRUE;
+    clock = Clock_create(tickFunction, HISTORY_TICK_PERIOD, &clockParams, &eb);
+    if (clock == NULL)
+        System_abort("History clock create failed");
+}
+
+/*!
+ * \brief add a heart rate to the open buckets of a sensor, O(1)
+ * Must be called from Clock context, like the estimators do, or from a task with the Swis disabled.
+ * \param sensor number of the sensor
+ * \param bpm estimated heart rate, 0 (no beat found) is not recorded
+ */
+void history_record(uint8_t sensor, uint8_t bpm)
+{
+    if (sensor >= HEARTRATE_SENSOR_COUNT || bpm == 0)
+        return;
+    accumulate(&rings[sensor][HISTORY_SECONDS].open, bpm);
+    accumulate(&rings[sensor][HISTORY_MINUTES].open, bpm);
+}
+
+/*!
+ * \brief copy a range of closed buckets, oldest first. Never blocks.
+ * \param sensor number of the sensor
+ * \param tier resolution of the buckets
+ * \param ago amount of newest buckets to skip, 0 ends the range with the last closed bucket
+ * \param count amount of buckets wanted
+ * \param buckets destination, room for count buckets
+ * \return amount of copied buckets, less than count if the history does not reach back that
+ *         far, 0 if the writer kept overtaking the copy
+ */
+uint16_t history_read(uint8_t sensor, historyTier tier, uint32_t ago, uint16_t count, historyBucket *buckets)
+{
+    const historyRing *ring;
+    uint32_t start;
+    uint16_t copied;
+    uint16_t i;
+    uint8_t attempt;
+
+    if (sensor >= HEARTRATE_SENSOR_COUNT)
+        return 0;
+    ring = &rings[sensor][tier];
+
+    for (attempt = 0; attempt < HISTORY_READ_ATTEMPTS; attempt++)
+    {
+        copied = clipRange(ring, ring->written, ago, count, &start);
+        for (i = 0; i < copied; i++)
+            buckets[i] = ring->buckets[(start + i) % ring->size];
+        // the slot of start gets reused once written passes start + size - 1
+        if (ring->written - start < ring->size)
+            return copied;
+    }
+    return 0;
+}
+
+/*!
+ * \brief aggregate a range of closed buckets into one. Never blocks.
+ * Parameters are the same as for history_read.
+ * \param summary minimum, maximum and average over all buckets with an estimate
+ * \return true if the range contains at least one estimate
+ */
+bool history_summarize(uint8_t sensor, historyTier tier, uint32_t ago, uint16_t count, historyBucket *summary)
+{
+    const historyRing *ring;
+    historyAccumulator total;
+    historyBucket bucket;
+    uint32_t start;
+    uint16_t available;
+    uint16_t i;
+    uint8_t attempt;
+
+    if (sensor >= HEARTRATE_SENSOR_COUNT)
+        return false;
+    ring = &rings[sensor][tier];
+
+    for (attempt = 0; attempt < HISTORY_READ_ATTEMPTS; attempt++)
+    {
+        memset(&total, 0, sizeof(total));
+        available = clipRange(ring, ring->written, ago, count, &start);
+        for (i = 0; i < available; i++)
+        {
+            bucket = ring->buckets[(start + i) % ring->size];
+            if (bucket.avg == 0)
+                continue;
+            if (total.count == 0 || bucket.min < total.min)
+                total.min = bucket.min;
+            if (bucket.max > total.max)
+                total.max = bucket.max;
+            total.sum += bucket.avg;
+            total.count++;
+        }
+        if (ring->written - start < ring->size)
+            break;
+    }
+    if (attempt == HISTORY_READ_ATTEMPTS || total.count == 0)
+        return false;
+
+    summary->min = total.min;
+    summary->max = total.max;
+    summary->avg = (uint8_t) ((total.sum + total.count / 2) / total.count);
+    return true;
+}
+
+/*!
+ * \brief print minimum, maximum and average of the last minute, hour and day of every sensor
+ */
+void history_printSummary(void)
+{
+    uint8_t sensor;
+
+    for (sensor = 0; sensor < HEARTRATE_SENSOR_COUNT; sensor++)
+    {
+        System_printf("History sensor %u (min/max/avg bpm):\n", sensor);
+        printRange("minute", sensor, HISTORY_SECONDS, HISTORY_SECONDS_PER_MINUTE);
+        printRange("hour", sensor, HISTORY_SECONDS, HISTORY_SECONDS_SIZE);
+        printRange("day", sensor, HISTORY_MINUTES, HISTORY_MINUTES_SIZE);
+    }
+    System_flush();
+}
+
+/*!
+ * \brief close the second buckets of all sensors, every minute the minute buckets as well
+ */
+static void tickFunction(UArg arg)
+{
+    uint8_t sensor;
+
+    secondsInMinute++;
+    for (sensor = 0; sensor < HEARTRATE_SENSOR_COUNT; sensor++)
+    {
+        closeBucket(&rings[sensor][HISTORY_SECONDS]);
+        if (secondsInMinute == HISTORY_SECONDS_PER_MINUTE)
+            closeBucket(&rings[sensor][HISTORY_MINUTES]);
+    }
+    if (secondsInMinute == HISTORY_SECONDS_PER_MINUTE)
+        secondsInMinute = 0;
+}
+
+static void accumulate(historyAccumulator *open, uint8_t bpm)
+{
+    if (open->count == 0 || bpm < open->min)
+        open->min = bpm;
+    if (bpm > open->max)
+        open->max = bpm;
+    open->sum += bpm;
+    open->count++;
+}
+
+/*!
+ * \brief store the open bucket in the ring and start a new one, an interval without estimate
+ * is stored as empty bucket so the buckets stay aligned to time
+ */
+static void closeBucket(historyRing *ring)
+{
+    historyBucket *bucket = &ring->buckets[ring->written % ring->size];
+    historyAccumulator *open = &ring->open;
+
+    if (open->count == 0)
+    {
+        bucket->min = 0;
+        bucket->max = 0;
+        bucket->avg = 0;
+    }
+    else
+    {
+        bucket->min = open->min;
+        bucket->max = open->max;
+        bucket->avg = (uint8_t) ((open->sum + open->count / 2) / open->count);
+    }
+    // publish only after the bucket is complete
+    ring->written++;
+    memset(open, 0, sizeof(*open));
+}
+
+/*!
+ * \brief limit a requested range to the buckets that are stored and safe to read
+ * The oldest slot is the one the writer fills next, so it is left out.
+ * \param start first bucket number of the range
+ * \return amount of buckets in the range
+ */
+static uint16_t clipRange(const historyRing *ring, uint32_t written, uint32_t ago, uint16_t count, uint32_t *start)
+{
+    uint32_t stored = written < ring->size ? written : ring->size - 1;
+
+    *start = written;
+    if (ago >= stored)
+        return 0;
+    if (count > stored - ago)
+        count = (uint16_t) (stored - ago);
+    *start = written - ago - count;
+    return count;
+}
+
+static void printRange(const char *label, uint8_t sensor, historyTier tier, uint16_t count)
+{
+    historyBucket summary;
+
+    if (history_summarize(sensor, tier, 0, count, &summary))
+        System_printf("  last %s: %u/%u/%u\n", label, summary.min, summary.max, summary.avg);
+    else
+        System_printf("  last %s: no data\n", label);
+}
+// End Doxygen group
+//! @}
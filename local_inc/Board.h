@@ -44,6 +44,7 @@ extern "C" {
 #define Board_initGPIO              EK_TM4C1294XL_initGPIO
 #define Board_initI2C               EK_TM4C1294XL_initI2C
 #define Board_initSDSPI             EK_TM4C1294XL_initSDSPI
+#define Board_initSDSPI1            EK_TM4C1294XL_initSDSPI1
 #define Board_initSPI               EK_TM4C1294XL_initSPI
 #define Board_initUART              EK_TM4C1294XL_initUART
 #define Board_initUSB               EK_TM4C1294XL_initUSB
@@ -54,8 +54,9 @@ extern "C" {
  * To enable or disable them set the respective macro to 1 or 0 respectively. */
 
 /*i2c configuration*/
+#define I2CM_0 1    /* second heartrate click, BoosterPack 1 I2C (PB2/PB3) */
 #define I2CM_7 0
-#define I2CM_8 1
+#define I2CM_8 1    /* first heartrate click, BoosterPack 2 I2C (PA2/PA3) */
 
 /*spi configuration*/
 #define SSIM_2 1
@@ -93,6 +94,7 @@ typedef enum EK_TM4C1294XL_GPIOName {
     EK_TM4C1294XL_USR_SW1 = 0,
     EK_TM4C1294XL_USR_SW2,
     EK_TM4C1294XL_CLICK_2,
+    EK_TM4C1294XL_CLICK_1,
     EK_TM4C1294XL_D1,
     EK_TM4C1294XL_D2,
 
@@ -104,6 +106,9 @@ typedef enum EK_TM4C1294XL_GPIOName {
  *  @brief  Enum of I2C names on the EK_TM4C1294XL dev board
  */
 typedef enum EK_TM4C1294XL_I2CName {
+#if I2CM_0
+    EK_TM4C1294XL_I2C0,
+#endif
 #if I2CM_7
     EK_TM4C1294XL_I2C7,
 #endif
@@ -263,6 +268,14 @@ extern void EK_TM4C1294XL_initPWM(void);
  */
 extern void EK_TM4C1294XL_initSDSPI(void);
 
+/*!
+ *  @brief  Initialize only the SDSPI1 port (SSI3, chip select PP4)
+ *
+ *  Unlike EK_TM4C1294XL_initSDSPI it leaves SSI2, PH2 and PA2/PA3 alone,
+ *  they belong to the OLED and to the I2C8 bus.
+ */
+extern void EK_TM4C1294XL_initSDSPI1(void);
+
 /*!
  *  @brief  Initialize board specific SPI settings
  *
@@ -21,6 +21,7 @@
 
 // ---------------------------------------------------------------------------- functions ---
 void outputTestcaseChange(uint8_t testcase);
+void UART_printStatistics(void);
 /*!
  *  \brief Execute UART Task
  *  \param arg0 void
@@ -0,0 +1,39 @@
+/*!
+ * \file boot.h
+ * \brief boot stages and their readiness, the subsystems start concurrently and wait only for what they need
+ * main creates everything that is shared (mailboxes, clocks, the stage gates) before BIOS_start,
+ * so the tasks have no order among each other. Every subsystem signals its stage as soon as it
+ * is up, a task that depends on another stage waits for it with boot_wait, any amount of tasks
+ * may wait for the same stage. The time of every stage since the boot is kept, the last one is
+ * the time until the first valid heart rate.
+ */
+
+#ifndef BOOT_H_
+#define BOOT_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include <stdint.h>
+#include <stdbool.h>
+
+//! \addtogroup group_comm
+//! @{
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief boot stages in the order they are usually reached
+typedef enum bootStage {
+    BOOT_UART = 0,      //!< UART is open, commands are received
+    BOOT_DISPLAY,       //!< OLED is powered and initialized
+    BOOT_SENSORS,       //!< every heart rate sensor is initialized or known to be missing
+    BOOT_HEARTRATE,     //!< the first valid heart rate arrived at the broker
+    BOOT_STAGES         //!< amount of stages
+} bootStage;
+
+// ---------------------------------------------------------------------------- functions ---
+extern void boot_init(void);
+extern void boot_signal(bootStage stage);
+extern bool boot_wait(bootStage stage, uint32_t timeout);
+extern bool boot_isReady(bootStage stage);
+extern void boot_printStatistics(void);
+
+#endif /* BOOT_H_ */
+// End Doxygen group
+//! @}
@@ -12,27 +12,107 @@
 #include "common.h"
 #include "UART_Task.h"
 #include "oled_display.h"
+#include "timestamp.h"
+#include "queue.h"
 
 //! \addtogroup group_comm
 //! @{
 // ----------------------------------------------------------------------------- typedefs ---
+//! \brief heart rate variability over the last minute of RR intervals, all 0 while unknown
+typedef struct hrvMetrics {
+    uint16_t rmssd;         //!< root mean square of the successive differences in ms
+    uint16_t sdnn;          //!< standard deviation of the intervals in ms
+    uint8_t pnn50;          //!< share of the successive differences above 50 ms in percent
+} hrvMetrics;
+
+//! \brief message from the heartrate module to the broker
+typedef struct heartrateMessage {
+    timestamp_t timestamp;  //!< acquisition time of the newest sample the value is based on
+    uint8_t sensor;         //!< number of the sensor the value comes from
+    uint8_t bpm;            //!< heart rate in beats per minute, 0 if no beat was detected
+    uint8_t quality;        //!< signal quality in percent, share of the beat candidates that passed the quality checks
+    hrvMetrics hrv;         //!< heart rate variability, 0 without a heart rate
+} heartrateMessage;
+
+//! \brief one RR interval from the heartrate module to the broker, sent with every accepted beat
+typedef struct rrMessage {
+    timestamp_t timestamp;  //!< time of the beat that ends the interval
+    uint8_t sensor;         //!< number of the sensor the beat comes from
+    uint16_t interval;      //!< ms since the previous beat
+} rrMessage;
+
+//! \brief kinds of messages to the OLED
+typedef enum oledMessageType {
+    OLED_MESSAGE_VALUE,     //!< received char, the heart rates come from the bus
+    OLED_MESSAGE_POWER,     //!< value 0 shuts the display down, 1 switches it on again
+    OLED_MESSAGE_WAKE,      //!< user activity, lights a dimmed display up again
+    OLED_MESSAGE_TESTCASE   //!< value is the new testcase, the screen is cleared and shows what it selects
+} oledMessageType;
+
+//! \brief control message from the broker to the OLED
+typedef struct oledMessage {
+    timestamp_t timestamp;  //!< time the message was sent
+    uint8_t type;           //!< oledMessageType
+    uint8_t sensor;         //!< unused, 0
+    uint8_t value;          //!< depends on the type
+} oledMessage;
+
+
+// ------------------------------------------------------------------------------ defines ---
+//! \brief size of a message from broker to UART, 0-terminated string
+#define BROKER_WRITE_SIZE 24
+//! \brief events of the broker task, posted by its mailboxes and its bus queue
+#define BROKER_EVENT_BUS Event_Id_00
+#define BROKER_EVENT_UART Event_Id_01
+#define BROKER_EVENT_COMMAND Event_Id_02
+//! \brief events of the UART task, a received char, a message and an acknowledgement of the broker
+#define UART_EVENT_READ Event_Id_00
+#define UART_EVENT_WRITE Event_Id_01
+#define UART_EVENT_ACK Event_Id_02
+//! \brief events of the OLED task, a message of the broker and one from its bus queue
+#define OLED_EVENT_MESSAGE Event_Id_00
+#define OLED_EVENT_BUS Event_Id_01
+//! \brief depth and policy of every queue of the broker, tuned with the counters of '#5'.
+//! The UART task never waits for the broker, or a keystroke could hold up the acknowledgements
+//! the broker waits to hand over. The broker waits for the UART and the OLED instead of losing output.
+#define BROKER_READ_DEPTH 16
+#define BROKER_READ_POLICY QUEUE_DROP_NEWEST
+#define BROKER_COMMAND_DEPTH 2
+#define BROKER_COMMAND_POLICY QUEUE_DROP_NEWEST
+#define BROKER_WRITE_DEPTH 5
+#define BROKER_WRITE_POLICY QUEUE_BLOCK
+#define BROKER_ACK_DEPTH 2
+#define BROKER_ACK_POLICY QUEUE_BLOCK
+#define BROKER_OLED_DEPTH 5
+#define BROKER_OLED_POLICY QUEUE_BLOCK
+//! \brief bus queue of the broker, the newest heart rates and RR intervals count
+#define BROKER_BUS_DEPTH 8
+#define BROKER_BUS_POLICY QUEUE_DROP_OLDEST
 
 // ------------------------------------------------------------------------------ globals ---
-//! \brief semaphore for IPC communication between Broker and input, whether heartrate module or UART
-Mailbox_Handle heartrateMailbox;
 //! \brief semaphore for IPC communication between Broker and OLED
-Mailbox_Handle oledMailbox;
+queue oledMailbox;
 //! \brief semaphore for writing from broker to UART;
-Mailbox_Handle brokerWrite;
+queue brokerWrite;
 //! \brief semaphore for reading from UART to broker
-Mailbox_Handle brokerRead;
+queue brokerRead;
+//! \brief complete command frames from the UART to the broker, see command.h
+queue commandMailbox;
+//! \brief acknowledgement frames from the broker to the UART
+queue ackMailbox;
+//! \brief the broker task waits on this for any of its mailboxes
+Event_Handle brokerEvent;
+//! \brief the UART task waits on this for a received char or a message to write
+Event_Handle uartEvent;
+//! \brief the OLED task waits on this for a control message or a heart rate
+Event_Handle oledEvent;
 
 // ---------------------------------------------------------------------------- functions ---
 extern void setup_Broker_task(xdc_String name, uint8_t priority);
 extern void Broker_task(void);
-extern uint8_t getTestcase();
-extern bool getChanged(void);
-extern void resetChanged(void);
+extern uint8_t getHeartrate(uint8_t sensor);
+extern uint8_t getQuality(uint8_t sensor);
+extern hrvMetrics getHrv(uint8_t sensor);
 #endif /* BROKER_H_ */
 // Ende ot Doxygen group
 //! @}
@@ -0,0 +1,64 @@
+/*!
+ * \file bus.h
+ * \brief publish/subscribe bus between the producers and the consumers of the measurements
+ * A producer publishes a message on a topic without knowing who consumes it. The message is
+ * copied once into a slot of a shared pool, every subscriber of the topic gets a pointer to
+ * that slot in its own bounded queue and releases it when done. The slot is free again when
+ * the last subscriber released it, until then it is never written, so all subscribers read the
+ * same message without copies or locks. What a full queue of a subscriber does is the policy of
+ * that queue, the others still get the message. Publishers never wait, so a subscriber cannot
+ * take QUEUE_BLOCK. Subscriptions are made during the setup, before BIOS_start.
+ */
+
+#ifndef BUS_H_
+#define BUS_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include "common.h"
+#include "queue.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief messages in flight at the same time, over all topics
+#define BUS_POOL_SIZE 16
+//! \brief subscribers of all topics together
+#define BUS_MAX_SUBSCRIBERS 4
+//! \brief subscription mask of one topic
+#define BUS_TOPIC(topic) (1UL << (topic))
+
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief static topics, the payload type of each is fixed
+typedef enum busTopic {
+    BUS_TOPIC_HEARTRATE = 0,    //!< heartrateMessage of every estimator window
+    BUS_TOPIC_RR,               //!< rrMessage of every accepted beat
+    BUS_TOPICS
+} busTopic;
+
+//! \brief a published message, read only for the subscribers
+typedef struct busMessage {
+    uint8_t topic;                  //!< busTopic
+    volatile uint8_t references;    //!< subscribers that did not release it yet
+    union {
+        heartrateMessage heartrate;
+        rrMessage rr;
+    } payload;
+} busMessage;
+
+//! \brief one consumer, with its own queue
+typedef struct busSubscriber {
+    uint32_t topics;            //!< mask of BUS_TOPIC
+    queue messages;             //!< pointers to the messages, its counters are those of the subscriber
+} busSubscriber;
+
+// ---------------------------------------------------------------------------- functions ---
+extern void bus_subscribe(busSubscriber *subscriber, const char *name, uint32_t topics, uint8_t depth,
+                          queuePolicy policy, Event_Handle event, unsigned int eventId);
+extern bool bus_publish(busTopic topic, const void *payload, uint8_t size);
+extern const busMessage *bus_receive(busSubscriber *subscriber);
+extern void bus_release(const busMessage *message);
+extern void bus_printStatistics(void);
+
+#endif /* BUS_H_ */
+// End Doxygen group
+//! @}
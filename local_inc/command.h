@@ -0,0 +1,102 @@
+/*!
+ * \file command.h
+ * \brief framed command protocol over the UART, for host tools
+ * A frame carries one or more commands, the broker executes them in order and answers the whole
+ * frame with one acknowledgement frame. Frames start with a byte no terminal sends, keystrokes
+ * are 0x08..0x7F, so typing and the '#' shortcuts keep working on the same line.
+ *
+ * frame:
+ *  u8 COMMAND_START, u8 body length (1..COMMAND_BODY_SIZE), body,
+ *  u8 CRC-8 (polynomial 0x07, initial value 0) of the length and the body
+ *
+ * command body:
+ *  u8 sequence number, chosen by the host,
+ *  per command: u8 command id (commandId), u8 argument length, arguments
+ *
+ * acknowledgement body:
+ *  u8 sequence number of the command frame,
+ *  per command: u8 command id, u8 status (commandStatus), u8 result length, result
+ *
+ * Values of more than one byte are little endian. A frame with a wrong CRC, a bad length or a
+ * pause of more than COMMAND_TIMEOUT ms between two of its bytes is dropped without an answer,
+ * the host repeats it after its own timeout.
+ */
+
+#ifndef COMMAND_H_
+#define COMMAND_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include "common.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief first byte of every frame
+#define COMMAND_START 0xA5
+//! \brief largest body of a frame in bytes
+#define COMMAND_BODY_SIZE 64
+//! \brief largest frame on the line: start, length, body and CRC
+#define COMMAND_FRAME_SIZE (COMMAND_BODY_SIZE + 3)
+//! \brief ms a frame may pause between two bytes before it is dropped
+#define COMMAND_TIMEOUT 100
+//! \brief largest result of one command in bytes
+#define COMMAND_RESULT_SIZE 16
+
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief commands, with their arguments and results
+typedef enum commandId {
+    COMMAND_PING = 0x01,                //!< no arguments, only acknowledged
+    COMMAND_SET_TESTCASE = 0x02,        //!< u8 testcase 0..4, the same as #0..#4
+    COMMAND_PRINT_STATISTICS = 0x03,    //!< no arguments, statistics of every module to the console
+    COMMAND_SET_ACQUISITION = 0x04,     //!< u8 heartrateAcquisitionMode
+    COMMAND_PRINT_HISTORY = 0x05,       //!< no arguments, heart rate history to the console
+    COMMAND_SET_RECORDING = 0x06,       //!< u8 1 starts a session on the SD card, 0 stops it
+    COMMAND_SET_ESTIMATOR = 0x07,       //!< u8 heartrateEstimatorMode
+    COMMAND_SET_TELEMETRY = 0x08,       //!< u32 ms between two telemetry datagrams
+    COMMAND_GET_HEARTRATE = 0x09,       //!< u8 sensor, result: u8 bpm, u8 quality, u16 RMSSD, u16 SDNN, u8 pNN50
+    COMMAND_GET_QUEUE = 0x0A,           //!< u8 queue as numbered by #5, result: u8 queuePolicy, u8 depth,
+                                        //!< u8 high-water mark, u8 pending, u32 posted, u32 dropped, u32 waited
+    COMMAND_SET_QUEUE_POLICY = 0x0B     //!< u8 queue, u8 queuePolicy, its counters start over. Blocking is refused
+                                        //!< where the producers must not wait, the UART input and the bus
+} commandId;
+
+//! \brief result of one command in the acknowledgement
+typedef enum commandStatus {
+    COMMAND_OK = 0,
+    COMMAND_UNKNOWN,            //!< no such command id
+    COMMAND_BAD_ARGUMENT,       //!< wrong argument length or value out of range
+    COMMAND_MALFORMED           //!< the arguments reach beyond the frame, the rest of the frame is skipped
+} commandStatus;
+
+//! \brief what a byte from the UART was to the parser
+typedef enum commandReceive {
+    COMMAND_RECEIVE_NONE,       //!< not part of a frame, a keystroke
+    COMMAND_RECEIVE_BUSY,       //!< taken into the frame
+    COMMAND_RECEIVE_FRAME       //!< the last byte of a valid frame
+} commandReceive;
+
+//! \brief body of a command or an acknowledgement frame
+typedef struct commandFrame {
+    uint8_t length;
+    uint8_t body[COMMAND_BODY_SIZE];
+} commandFrame;
+
+//! \brief one command taken out of a frame
+typedef struct commandEntry {
+    uint8_t id;
+    uint8_t length;             //!< argument length
+    const uint8_t *arguments;
+    bool malformed;             //!< the arguments do not fit into the frame
+} commandEntry;
+
+// ---------------------------------------------------------------------------- functions ---
+extern commandReceive command_receive(uint8_t byte, uint32_t now, commandFrame *frame);
+extern bool command_next(const commandFrame *frame, uint8_t *offset, commandEntry *entry);
+extern void command_startAck(commandFrame *ack, const commandFrame *frame);
+extern bool command_addAck(commandFrame *ack, uint8_t id, commandStatus status, const uint8_t *result, uint8_t length);
+extern uint8_t command_encode(const commandFrame *frame, uint8_t *data);
+extern void command_printStatistics(void);
+
+#endif /* COMMAND_H_ */
+// End Doxygen group
+//! @}
@@ -34,6 +34,7 @@
 #include <ti/sysbios/knl/Task.h>        // supplies the Task
 #include <ti/sysbios/knl/Semaphore.h>   // supplies the Semaphore
 #include <ti/sysbios/knl/Mailbox.h>     // supplies the Mailbox
+#include <ti/sysbios/knl/Event.h>       // supplies the Event
 #include <ti/sysbios/knl/Clock.h>       // supplies the clock
 
 /* Instrumentation headers */
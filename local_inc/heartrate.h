@@ -8,6 +8,94 @@
 #ifndef LOCAL_INC_HEARTRATE_H_
 #define LOCAL_INC_HEARTRATE_H_
 
+#include "common.h"
+#include "timestamp.h"
+#include "heartrate_i2c.h"
+#include "heartrate_quality.h"
+#include "heartrate_fft.h"
+#include "heartrate_hrv.h"
+
+/* every sensor on its own I2C master, see local_inc/EK_TM4C1294XL.h */
+#define HEARTRATE_SENSOR_COUNT (I2CM_0 + I2CM_8)
+/* ring buffer size in samples per sensor, power of two. Holds more than one estimator window (5 s at 50 Hz) */
+#define HEARTRATE_RING_SIZE 512
+
+/* what triggers draining the sensor FIFO */
+typedef enum heartrateAcquisitionMode {
+    HEARTRATE_ACQUISITION_INTERRUPT = 0,    //data ready interrupt of the MAX30100
+    HEARTRATE_ACQUISITION_TIMER             //general purpose timer at a cadence matched to sample rate and FIFO depth
+} heartrateAcquisitionMode;
+
+/* what estimates the published heart rate, both see the same samples */
+typedef enum heartrateEstimatorMode {
+    HEARTRATE_ESTIMATOR_BEATS = 0,  //mean interval of the beats accepted by the quality stage
+    HEARTRATE_ESTIMATOR_FFT         //spectral peak of the last HEARTRATE_FFT_SIZE samples, computed by the FFT task
+} heartrateEstimatorMode;
+
+/* timing of the acquisition triggers, to compare interrupt and timer mode under load */
+typedef struct heartrateJitter {
+    uint32_t triggers;          //amount of triggers since the last reset
+    timestamp_t lastTrigger;
+    uint32_t expectedInterval;  //nominal time between two triggers in us
+    uint32_t minInterval;       //shortest time between two triggers in us
+    uint32_t maxInterval;       //longest time between two triggers in us
+    uint32_t maxJitter;         //largest deviation from the nominal interval in us
+    uint64_t sumJitter;         //sum of all deviations, for the mean
+} heartrateJitter;
+
+/* one acquired sample together with its reconstructed acquisition time */
+typedef struct heartrateSample {
+    timestamp_t time;
+    unsigned short value;
+} heartrateSample;
+
+/* state of the estimator, consumes the accepted beats of the quality stage behind the acquisition */
+typedef struct heartrateEstimator {
+    uint16_t readIndex;     //index of the next sample in the ring buffer not yet evaluated
+    uint16_t beatIndex;     //index of the next accepted beat not yet evaluated
+    uint16_t candidates;    //counters of the quality stage at the last evaluation
+    uint16_t accepted;
+    uint8_t lastBpm;        //last estimated heart rate
+    uint8_t lastQuality;    //last signal quality in percent
+    uint32_t qualityTime;   //qualityTime of the sensor at the last evaluation
+} heartrateEstimator;
+
+/* one MAX30100 on its own I2C bus with its own interrupt line, acquisition task and estimator */
+typedef struct heartrateSensor {
+    uint8_t id;                         //number of the sensor, travels with every value to the broker
+    unsigned int i2cIndex;              //board I2C peripheral (EK_TM4C1294XL_I2CName)
+    unsigned int gpioIndex;             //board GPIO of the interrupt line (EK_TM4C1294XL_GPIOName)
+    bool present;                       //false if the sensor did not answer during init
+    heartrateI2C bus;                   //non blocking I2C transaction chain
+    Semaphore_Handle dataSem;           //posted by the I2C chain for every FIFO block and on bus errors
+    heartrateSample ring[HEARTRATE_RING_SIZE];
+    volatile uint16_t writeIndex;       //index of the next free slot in the ring buffer
+    heartrateQuality quality;           //signal quality stage, every sample passes it in the task
+    uint16_t rrIndex;                   //next accepted beat of the quality stage not yet passed on as RR interval
+    heartrateHrv hrv;                   //heart rate variability of the RR intervals, task only
+    hrvMetrics variability;             //metrics of hrv after the last beat, for the estimator
+    heartrateEstimator estimator;
+    heartrateJitter jitter;
+    volatile bool ledOff;               //duty cycle of the estimator: LED off until the next probe, no finger found
+    bool ledApplied;                    //LED state the sensor is configured to, changed by the task only
+    uint8_t emptyWindows;               //estimator windows without a heart rate, or with the LED off
+    uint32_t ledOffCount;               //how often the LED went off
+    uint8_t ledCurrent;                 //IR LED current code of the LED configuration, set by the gain control
+    uint16_t gainPeak;                  //largest sample since the last gain decision
+    uint8_t gainSamples;                //samples since the last gain decision
+    uint32_t gainSteps;                 //how often the LED current changed
+    uint32_t qualityTime;               //us spent in the quality stage so far, only grows
+    latencyStats estimatorCost;         //us of the time domain path per window, quality stage and estimator
+    heartrateFft fft;                   //window of the frequency domain estimator, owned by the FFT task while fftBusy
+    volatile bool fftBusy;
+    heartrateMessage fftMessage;        //time domain result of the window in the FFT task
+} heartrateSensor;
+
 void create_heartrate_tasks(int prio);
-void clockFunction();
+void heartrate_setAcquisitionMode(heartrateAcquisitionMode mode);
+heartrateAcquisitionMode heartrate_getAcquisitionMode(void);
+void heartrate_setEstimatorMode(heartrateEstimatorMode mode);
+heartrateEstimatorMode heartrate_getEstimatorMode(void);
+void heartrate_printStatistics(void);
+const heartrateSensor *heartrate_getSensor(uint8_t id);
 #endif /* LOCAL_INC_HEARTRATE_H_ */
@@ -0,0 +1,31 @@
+/*
+ * heartrate_fft.h
+ *
+ * Frequency domain heart rate estimator, the alternative to the beats of the quality stage.
+ * A Hann windowed block of HEARTRATE_FFT_SIZE samples goes through a 16 bit fixed point real FFT
+ * (a complex FFT of half the size on the even and odd samples, split afterwards), the strongest
+ * bin in the cardiac band is the heart rate. A peak with a strong subharmonic is the second
+ * harmonic of a pulse with a pronounced dicrotic notch, the subharmonic is taken instead. The
+ * frequency is interpolated between the bins with a parabola through the peak and its neighbours.
+ * The transform runs in steps of at most one butterfly stage, heartrateFft_step does one of them,
+ * so the caller can give up the CPU between them.
+ */
+
+#ifndef LOCAL_INC_HEARTRATE_FFT_H_
+#define LOCAL_INC_HEARTRATE_FFT_H_
+
+#include "common.h"
+
+#define HEARTRATE_FFT_SIZE 512      //real samples of one window, power of two, 10.24 s at 50 Hz
+
+/* one window on its way through the transform */
+typedef struct heartrateFft {
+    int16_t data[HEARTRATE_FFT_SIZE];   //samples without their mean, oldest first, transformed in place
+    uint16_t sampleRate;                //Hz, converts the bins into heart rates
+    uint8_t step;                       //next step of the transform
+    uint8_t bpm;                        //result, 0 if there is no clear peak in the cardiac band
+} heartrateFft;
+
+void heartrateFft_start(heartrateFft *fft, uint16_t sampleRate);
+bool heartrateFft_step(heartrateFft *fft);
+#endif /* LOCAL_INC_HEARTRATE_FFT_H_ */
@@ -0,0 +1,43 @@
+/*
+ * heartrate_hrv.h
+ *
+ * Heart rate variability of the RR intervals, the intervals between the beats the quality stage
+ * accepted. The last HRV_WINDOW intervals slide through a ring, every new one replaces the oldest
+ * in running sums of the intervals, their squares and the squared successive differences, so a
+ * beat costs the same few operations however long the window is. RMSSD, SDNN and pNN50 come from
+ * these sums whenever they are needed. An interval after a rejected beat is not successive to the
+ * previous one, it only starts a new chain of differences.
+ */
+
+#ifndef LOCAL_INC_HEARTRATE_HRV_H_
+#define LOCAL_INC_HEARTRATE_HRV_H_
+
+#include "common.h"
+
+#define HRV_WINDOW 64           //RR intervals of the sliding window, power of two, about a minute
+#define HRV_MIN_INTERVALS 16    //fewer intervals give no metrics
+
+/* one RR interval of the window */
+typedef struct heartrateRr {
+    uint32_t interval;          //us
+    int32_t difference;         //us to the previous interval, only if successive
+    bool successive;            //the previous interval ended at the beat this one starts with
+} heartrateRr;
+
+/* sliding window and running sums of one sensor, written by its acquisition task only */
+typedef struct heartrateHrv {
+    heartrateRr window[HRV_WINDOW];
+    uint8_t next;               //slot of the next interval, the oldest one once the window is full
+    uint8_t count;              //intervals in the window
+    uint32_t lastInterval;      //newest interval, 0 if the chain is broken
+    uint64_t sum;               //of the intervals in us
+    uint64_t sumSquares;        //of the intervals in us^2
+    uint64_t differenceSquares; //of the successive differences in us^2
+    uint8_t differences;        //successive differences in the window
+    uint8_t nn50;               //of them larger than 50 ms
+} heartrateHrv;
+
+void heartrateHrv_reset(heartrateHrv *hrv);
+void heartrateHrv_addInterval(heartrateHrv *hrv, uint32_t interval);
+void heartrateHrv_metrics(const heartrateHrv *hrv, hrvMetrics *metrics);
+#endif /* LOCAL_INC_HEARTRATE_HRV_H_ */
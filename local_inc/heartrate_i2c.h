@@ -0,0 +1,102 @@
+/*
+ * heartrate_i2c.h
+ *
+ * Non blocking I2C layer for the MAX30100. The bus runs in I2C_MODE_CALLBACK, an interrupt
+ * starts a chain of transactions (interrupt status -> FIFO pointers -> FIFO burst) which
+ * continues from the I2C callback without any task involvement. Only a complete FIFO block
+ * wakes up the acquisition task. Failed transactions are retried, if that does not help the
+ * bus gets flagged for recovery by the task instead of aborting the system.
+ */
+
+#ifndef LOCAL_INC_HEARTRATE_I2C_H_
+#define LOCAL_INC_HEARTRATE_I2C_H_
+
+#include "common.h"
+#include "timestamp.h"
+
+#include <ti/drivers/I2C.h>
+
+#define HEARTRATE_FIFO_DEPTH 16         //samples in the MAX30100 FIFO
+#define HEARTRATE_FIFO_SAMPLE_SIZE 4    //bytes per FIFO sample (IR + red, 16 bit each)
+#define HEARTRATE_I2C_BLOCKS 2          //FIFO blocks buffered between the I2C callback and the task
+#define HEARTRATE_I2C_RETRIES 3         //retries of a failed transaction before the bus needs recovery
+
+/* MAX30100 registers used by the driver */
+#define MAX30100_INT_STATUS 0x00
+#define MAX30100_INT_ENABLE 0x01
+#define MAX30100_FIFO_WR_PTR 0x02
+#define MAX30100_OVF_COUNTER 0x03
+#define MAX30100_FIFO_RD_PTR 0x04
+#define MAX30100_FIFO_DATA 0x05
+#define MAX30100_MODE_CONFIG 0x06
+#define MAX30100_SPO2_CONFIG 0x07
+#define MAX30100_LED_CONFIG 0x09
+#define MAX30100_PART_ID 0xFF
+
+/* bits of the mode configuration register */
+#define MAX30100_MODE_SHDN 0x80         //power save, LEDs off, no samples
+#define MAX30100_MODE_HR 0x02           //heart rate only, IR LED
+
+/* IR LED current in the lower nibble of the LED configuration register, the red LED stays off */
+#define MAX30100_LED_IR_MIN 0x01        //4.4 mA
+#define MAX30100_LED_IR_MAX 0x0F        //50 mA
+
+/* bits of the interrupt status register */
+#define MAX30100_INT_HR_RDY 0x20
+#define MAX30100_INT_PWR_RDY 0x01
+
+/* step of the transaction chain the bus is currently in */
+typedef enum heartrateI2CStep {
+    HEARTRATE_I2C_IDLE = 0,
+    HEARTRATE_I2C_SYNC,         //single register access requested by the task
+    HEARTRATE_I2C_STATUS,       //reading the interrupt status
+    HEARTRATE_I2C_POINTERS,     //reading write pointer, overflow counter and read pointer in one go
+    HEARTRATE_I2C_FIFO          //burst read of all available samples
+} heartrateI2CStep;
+
+/* one drained FIFO, raw bytes as delivered by the sensor */
+typedef struct heartrateFifoBlock {
+    timestamp_t time;           //time the newest sample in the block was taken
+    uint8_t samples;            //amount of samples in data
+    uint8_t overflow;           //samples lost in the sensor since the last block
+    uint8_t data[HEARTRATE_FIFO_DEPTH * HEARTRATE_FIFO_SAMPLE_SIZE];
+} heartrateFifoBlock;
+
+/* I2C bus of one sensor together with its transaction chain */
+typedef struct heartrateI2C {
+    I2C_Handle handle;
+    unsigned int i2cIndex;
+    I2C_Transaction transaction;
+    uint8_t writeBuffer[2];
+    uint8_t status;
+    uint8_t pointers[3];
+    volatile heartrateI2CStep step;
+    uint8_t retries;            //retries of the current transaction
+    volatile bool pending;      //interrupt arrived while a chain was running, start another one afterwards
+    volatile bool paced;        //chain started by a timer, the FIFO gets read regardless of the status
+    volatile bool needsRecovery;//retries exhausted, the task has to reset bus and sensor
+    volatile bool sensorReset;  //sensor reported power ready, i.e. it lost its configuration
+    volatile bool recovering;   //the task reopens the bus and configures the sensor, no chain may start
+    volatile bool syncSuccess;
+    volatile timestamp_t chainTime;  //time of the interrupt that started the chain
+    Semaphore_Handle syncSem;   //completion of a single register access
+    Semaphore_Handle blockSem;  //posted for every complete FIFO block and when recovery is needed
+    heartrateFifoBlock blocks[HEARTRATE_I2C_BLOCKS];
+    volatile uint8_t fillBlock; //block the next chain writes to
+    volatile uint8_t readyBlocks;
+    /* statistics */
+    uint32_t transfers;
+    uint32_t retryCount;
+    uint32_t failures;
+    uint32_t recoveries;
+} heartrateI2C;
+
+bool heartrateI2C_open(heartrateI2C *bus, unsigned int i2cIndex, Semaphore_Handle blockSem);
+void heartrateI2C_close(heartrateI2C *bus);
+bool heartrateI2C_write(heartrateI2C *bus, uint8_t reg, uint8_t value);
+bool heartrateI2C_read(heartrateI2C *bus, uint8_t reg, uint8_t *value);
+void heartrateI2C_startChain(heartrateI2C *bus, timestamp_t time, bool paced);
+bool heartrateI2C_takeBlock(heartrateI2C *bus, heartrateFifoBlock **block);
+void heartrateI2C_releaseBlock(heartrateI2C *bus);
+
+#endif /* LOCAL_INC_HEARTRATE_I2C_H_ */
@@ -0,0 +1,63 @@
+/*
+ * heartrate_quality.h
+ *
+ * Streaming signal quality stage between the acquisition and the estimator. Every sample passes
+ * it once in the acquisition task, with a few integer operations: a slow baseline (DC) and the
+ * mean deviation of the pulse from it (AC) give the perfusion index, a rising crossing of the
+ * baseline is a beat candidate. QUALITY_SHAPE_SIZE samples later the candidate is judged, it only
+ * counts as a beat if the perfusion index is plausible, its interval fits the recent ones and its
+ * shape correlates with a running template of the accepted beats. Movement and ambient light
+ * fail at least one of these. The accepted beats go into a ring the estimator reads, the counters
+ * only ever grow, so the estimator takes the differences without any locking.
+ */
+
+#ifndef LOCAL_INC_HEARTRATE_QUALITY_H_
+#define LOCAL_INC_HEARTRATE_QUALITY_H_
+
+#include "common.h"
+#include "timestamp.h"
+
+#define QUALITY_SHAPE_SIZE 12   //samples of a beat compared with the template, shorter than the refractory time
+#define QUALITY_BEATS 32        //accepted beats buffered for the estimator, power of two
+
+/* a beat that passed every check */
+typedef struct heartrateBeat {
+    timestamp_t time;           //interpolated time of the rising baseline crossing
+    uint32_t interval;          //us since the previous beat, 0 if that one was rejected
+} heartrateBeat;
+
+/* state of the quality stage of one sensor, written by its acquisition task only */
+typedef struct heartrateQuality {
+    int32_t baseline;                       //DC, exponential average scaled by 2^BASELINE_SHIFT, 0 until the first sample
+    int32_t amplitude;                      //AC, mean absolute deviation from the baseline scaled by 2^AMPLITUDE_SHIFT
+    int32_t lastDeviation;                  //deviation of the previous sample from the baseline
+    uint8_t settling;                       //samples until the baseline follows the signal, no candidates meanwhile
+    timestamp_t lastTime;                   //time of the previous sample
+    bool armed;                             //the signal fell well below the baseline, the next rising crossing is a candidate
+    timestamp_t lastBeat;                   //time of the last candidate outside the refractory time, 0 before the first
+    bool lastAccepted;                      //whether that candidate was accepted
+    uint32_t meanInterval;                  //running average of the accepted intervals in us, 0 while relearning
+    timestamp_t candidateTime;              //the candidate being collected
+    uint32_t candidateInterval;
+    int16_t shape[QUALITY_SHAPE_SIZE];      //deviations following the candidate
+    uint8_t shapeCount;                     //collected deviations, QUALITY_SHAPE_SIZE if no candidate is pending
+    int16_t beatTemplate[QUALITY_SHAPE_SIZE];   //running average of the accepted shapes
+    bool hasTemplate;
+    uint8_t rejectRun;                      //consecutive rejected candidates, enough of them start a relearning
+    uint16_t perfusion;                     //perfusion index of the last judged candidate in 0.01 %
+    heartrateBeat beats[QUALITY_BEATS];
+    volatile uint16_t beatIndex;            //index of the next free slot in beats
+    volatile uint16_t candidates;           //candidates so far, including the refractory ones
+    volatile uint16_t accepted;             //accepted beats so far
+    // statistics, rejected candidates per failed check
+    uint32_t rejectedPerfusion;
+    uint32_t rejectedInterval;
+    uint32_t rejectedShape;
+} heartrateQuality;
+
+void heartrateQuality_restart(heartrateQuality *quality);
+void heartrateQuality_addSample(heartrateQuality *quality, timestamp_t time, uint16_t value);
+bool heartrateQuality_isSettled(const heartrateQuality *quality);
+uint16_t heartrateQuality_baseline(const heartrateQuality *quality);
+uint16_t heartrateQuality_amplitude(const heartrateQuality *quality);
+#endif /* LOCAL_INC_HEARTRATE_QUALITY_H_ */
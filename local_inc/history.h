@@ -0,0 +1,50 @@
+/*!
+ * \file history.h
+ * \brief fixed size in RAM history of the heart rate of every sensor
+ * Two tiers per sensor: one bucket per second for the last hour and one bucket per minute
+ * for the last day. Every bucket keeps minimum, maximum and average of the heart rates
+ * estimated in its interval. Writing is O(1) and only done from Clock (Swi) context, readers
+ * copy without any lock and detect if the writer overtook them.
+ */
+
+#ifndef HISTORY_H_
+#define HISTORY_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include <stdint.h>
+#include <stdbool.h>
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief buckets of the second tier, one hour
+#define HISTORY_SECONDS_SIZE 3600
+//! \brief buckets of the minute tier, one day
+#define HISTORY_MINUTES_SIZE 1440
+//! \brief seconds aggregated into one bucket of the minute tier
+#define HISTORY_SECONDS_PER_MINUTE 60
+
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief resolution of a history query
+typedef enum historyTier {
+    HISTORY_SECONDS = 0,    //!< one bucket per second, last hour
+    HISTORY_MINUTES         //!< one bucket per minute, last day
+} historyTier;
+
+//! \brief aggregated heart rate of one interval, avg 0 marks an interval without any estimate
+typedef struct historyBucket {
+    uint8_t min;    //!< lowest heart rate in the interval
+    uint8_t max;    //!< highest heart rate in the interval
+    uint8_t avg;    //!< average heart rate in the interval
+} historyBucket;
+
+// ---------------------------------------------------------------------------- functions ---
+extern void history_init(void);
+extern void history_record(uint8_t sensor, uint8_t bpm);
+extern uint16_t history_read(uint8_t sensor, historyTier tier, uint32_t ago, uint16_t count, historyBucket *buckets);
+extern bool history_summarize(uint8_t sensor, historyTier tier, uint32_t ago, uint16_t count, historyBucket *summary);
+extern void history_printSummary(void);
+
+#endif /* HISTORY_H_ */
+// End Doxygen group
+//! @}
@@ -14,6 +14,7 @@
 // ------------------------------------ functions ---
 extern void initSPI(uint32_t systemFrequency);
 extern void setup_OLED_task(xdc_String name, uint8_t priority);
+extern void OLED_printStatistics(void);
 
 #endif /* OLED_DISPLAY_H_ */
 
@@ -23,6 +23,7 @@ typedef struct PinAddress {
 } PinAddress;
 
 //! \brief struct color16 stores the upper and lower significant Bytes form a 16Bit color word
+//! All draw calls take this ready RGB565 color, see COLOR16 and colorFromRGB.
 typedef struct color16 {
     uint8_t upperByte;  //!< Most significant Byte of a 16Bit Color word
     uint8_t lowerByte;  //!< Least significant Byte of a 16Bit Color word
@@ -40,7 +41,7 @@ typedef struct point {
 } point;
 //! \brief struct rect stores the coordinates of a given rect
 typedef struct rect {
-    point origin;   //!< point coordinate origin lower left point
+    point origin;   //!< point coordinate origin upper left point
     uint8_t width;  //!< width of the rect
     uint8_t height; //!< height of the rect
 } rect;
@@ -79,6 +80,10 @@ typedef struct rect {
 #define OLED_COLUMN_CURRENT_R 0x40
 #define OLED_COLUMN_CURRENT_G 0x41
 #define OLED_COLUMN_CURRENT_B 0x42
+//! \brief column currents at full brightness, scaled down by OLED_setBrightness
+#define OLED_COLUMN_CURRENT_R_FULL 0x6E
+#define OLED_COLUMN_CURRENT_G_FULL 0x4F
+#define OLED_COLUMN_CURRENT_B_FULL 0x77
 #define OLED_ROW_OVERLAP 0x48
 #define OLED_SCAN_OFF_LEVEL 0x49
 #define OLED_ROW_SCAN_ON_OFF 0x17
@@ -141,32 +146,81 @@ typedef struct rect {
 #define LED_04_PORT GPIO_PORTF_BASE
 #define LED_04_PIN 0
 
+//! \brief color16 initializer from 8 bit channels by shifts, for constants. No gamma correction, exact
+//! for channels that are fully on or off, other values should go through colorFromRGB.
+#define COLOR16(red, green, blue) {((red) & 0xF8) | (green) >> 5, ((green) & 0x1C) << 3 | (blue) >> 3}
+
 //! \brief Set Bit function sets a specific bit on a given position to the given value
 #define SETBIT(PinAddress, bit) (GPIOPinWrite(PinAddress.port, (1 << PinAddress.pin), (bit << PinAddress.pin)))
 
 // ----------------------------------------------------------------------------- globals---
-extern const color24 whiteColor;
-extern const color24 blackColor;
-extern const color24 redColor;
-extern const color24 greenColor;
-extern const color24 blueColor;
+extern const color16 whiteColor;
+extern const color16 blackColor;
+extern const color16 redColor;
+extern const color16 greenColor;
+extern const color16 blueColor;
+extern const color16 yellowColor;
+extern const color16 cyanColor;
+extern const color16 magentaColor;
 // -------------------------------------------------------------------------- functions ---
+/*!
+ * \brief convert a 24Bit RGB color to the display, gamma corrected by tables
+ * Meant for colors known at run time only, e.g. received ones. Convert once and keep the result.
+ * \param rgbColor color24, the color in classic 24Bit RGB (no alpha channel)
+ * \return the color16 for the draw calls
+ */
+extern color16 colorFromRGB(color24 rgbColor);
 
 /*!
  * \brief draw a given char onto the OLED display
  * The char get printed one by one, and printed onto the screen. Font size may be choose between 3 different sizes.
  * \param c char, the character get printed onto the screen (char in ascii value)
- * \param fontSize uint8_t, the fonts size in 3 different sizes, 1 small, 2 middle, 3 large
- * \param fontColor uint32_t, the color of the printed char in classic 24Bit RGB (no alpha channel)
- * \param bgColor uint32_t, background color for the char, because no alpha channel is supported
+ * \param font const fontContainer*, one of the constant fonts fontSmall, fontMedium or fontLarge
+ * \param fontColor color16, the color of the printed char
+ * \param bgColor color16, background color for the char, because no alpha channel is supported
  * \param origin point, the lower left corner of the char in the screen coordinates
  */
-extern void drawChar(char c, fontContainer *font, color24 fontColor, color24 bgColor, point origin);
-extern void drawPixelToYPosition(uint8_t *yValues, color24 diagcol, color24 bgColor);
-extern void createBackgroundFromImage(image screenimage);
-extern void createBackgroundFromColor(color24 rgbColor);
+extern void drawChar(char c, const fontContainer *font, color16 fontColor, color16 bgColor, point origin);
+extern void drawPixelToYPosition(uint8_t *yValues, color16 diagcol, color16 bgColor);
+extern void createBackgroundFromImage(const image *screenimage);
+/*!
+ * \brief draw an image or a part of it, e.g. an icon, without touching the rest of the screen
+ * Screen coordinates as seen on the display, x to the right, y downwards. Parts outside the
+ * display are clipped.
+ * \param sprite const image*, the image generated by tools/imgconv.py
+ * \param source const rect*, part of the image in image coordinates, NULL for the whole image
+ * \param destination point, upper left corner on the display
+ * \param key int32_t, color that is not drawn, IMAGE_KEY(red, green, blue) or IMAGE_NO_KEY
+ */
+extern void drawImage(const image *sprite, const rect *source, point destination, int32_t key);
+extern void createBackgroundFromColor(color16 color);
+/*!
+ * \brief fill a rectangle with one color in a single burst
+ * Screen coordinates as seen on the display, x to the right, y downwards, clipped to the display.
+ * \param area rect, the rectangle
+ * \param color color16, the color
+ */
+extern void fillRect(rect area, color16 color);
+extern void drawHLine(point start, uint8_t length, color16 color);
+extern void drawVLine(point start, uint8_t length, color16 color);
+/*!
+ * \brief draw a line between two points, every straight span of the line is a single fill
+ * \param from point, first point of the line
+ * \param to point, last point of the line
+ * \param color color16, the color
+ */
+extern void drawLine(point from, point to, color16 color);
+/*!
+ * \brief draw the outline or the whole area of a circle, row by row in spans
+ * \param center point, center of the circle, the circle may reach over the display border
+ * \param radius uint8_t, radius in pixels
+ * \param color color16, the color
+ */
+extern void drawCircle(point center, uint8_t radius, color16 color);
+extern void fillCircle(point center, uint8_t radius, color16 color);
 extern void OLED_power_on(void);
-extern void OLED_toggle_Display_on_off(void);
+extern void OLED_setDisplayOn(bool on);
+extern void OLED_setBrightness(uint8_t percent);
 extern void toggleUpScroll(bool enable);
 
 #endif /* OLED_HAL_H_ */
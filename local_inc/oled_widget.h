@@ -0,0 +1,80 @@
+/*! \file oled_widget.h
+ *  \brief retained mode widgets for the OLED 96x96: label, numeric readout, icon and sparkline
+ *  A screen is an array of widgets. The setters only store the new content and mark a widget
+ *  dirty if it changed, widget_render draws the dirty widgets of a screen in one pass. Text is
+ *  compared glyph by glyph against what is on the display, only changed glyphs are drawn. A value
+ *  of 0 in a sparkline is a gap, like an empty bucket of the history.
+ *  All positions are screen coordinates as seen on the display, x to the right, y downwards.
+ */
+
+#ifndef OLED_WIDGET_H_
+#define OLED_WIDGET_H_
+//! \addtogroup group_oled_app
+//! @{
+// ----------------------------------------------------------------------------- includes ---
+#include "common.h"
+#include "oled_hal.h"
+
+// ------------------------------------------------------------------------------ defines ---
+//! \brief longest text of a label or readout, without the terminating 0
+#define WIDGET_TEXT_LENGTH 12
+//! \brief most values a sparkline keeps, one per column
+#define WIDGET_SPARKLINE_SIZE (OLED_DISPLAY_X_MAX + 1)
+
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief kinds of widgets
+typedef enum widgetType {
+    WIDGET_LABEL,       //!< text in one font
+    WIDGET_READOUT,     //!< unsigned number with a fixed amount of digits
+    WIDGET_ICON,        //!< image or part of it, see drawImage
+    WIDGET_SPARKLINE    //!< the latest values as a line, scaled to the box
+} widgetType;
+
+//! \brief a widget with its content, its bounding box and whether it has to be drawn again
+typedef struct widget {
+    uint8_t type;               //!< widgetType
+    bool dirty;                 //!< content changed since the last render
+    bool redraw;                //!< the display content is unknown, draw everything, not only changes
+    rect bounds;                //!< bounding box on the screen
+    color16 color;              //!< foreground color
+    color16 background;         //!< background color
+    union {
+        struct {
+            const fontContainer *font;          //!< font of the text
+            uint8_t length;                     //!< glyph cells of the box
+            uint8_t digits;                     //!< digits of a readout, 0 for a label
+            char text[WIDGET_TEXT_LENGTH + 1];  //!< text to show
+            char shown[WIDGET_TEXT_LENGTH + 1]; //!< text on the display
+        } text;                                 //!< WIDGET_LABEL and WIDGET_READOUT
+        struct {
+            const image *sprite;                //!< image to show, NULL for nothing
+            int32_t key;                        //!< transparency key of drawImage
+        } icon;                                 //!< WIDGET_ICON
+        struct {
+            uint8_t values[WIDGET_SPARKLINE_SIZE]; //!< ring of the latest values
+            uint8_t size;                       //!< slots of the ring, the width of the box
+            uint8_t count;                      //!< values in the ring
+            uint8_t next;                       //!< slot of the next value
+        } sparkline;                            //!< WIDGET_SPARKLINE
+    } content;                                  //!< content depending on the type
+} widget;
+
+// ---------------------------------------------------------------------------- functions ---
+extern void widget_label(widget *w, point origin, const fontContainer *font, uint8_t length,
+                         color16 color, color16 background);
+extern void widget_readout(widget *w, point origin, const fontContainer *font, uint8_t digits,
+                           color16 color, color16 background);
+extern void widget_icon(widget *w, point origin, const image *sprite, int32_t key, color16 background);
+extern void widget_sparkline(widget *w, rect bounds, color16 color, color16 background);
+
+extern void widget_setText(widget *w, const char *text);
+extern void widget_setValue(widget *w, uint16_t value);
+extern void widget_setIcon(widget *w, const image *sprite);
+extern void widget_pushValue(widget *w, uint8_t value);
+
+extern void widget_invalidate(widget *widgets, uint8_t count, bool cleared);
+extern uint8_t widget_render(widget *widgets, uint8_t count);
+
+#endif /* OLED_WIDGET_H_ */
+// End Doxygen group
+//! @}
@@ -0,0 +1,44 @@
+/*!
+ * \file power.h
+ * \brief power manager: user activity, display dimming policy and the sleeping idle loop
+ * Every task blocks on a semaphore, mailbox or Event, so the idle loop runs whenever nothing is
+ * to do and sleeps the CPU until the next interrupt. The Clock runs tickless (application.cfg),
+ * its timer only fires for the next timeout that is due. The OLED dims after POWER_DIM_TIME and
+ * goes dark after POWER_BLANK_TIME without a keystroke, the next keystroke lights it up again.
+ * The sensors switch their LED off between probes while no finger is found, see heartrate.c.
+ */
+
+#ifndef POWER_H_
+#define POWER_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include <stdint.h>
+#include <stdbool.h>
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief ms without a keystroke until the display dims
+#define POWER_DIM_TIME 30000
+//! \brief ms without a keystroke until the display goes dark
+#define POWER_BLANK_TIME 120000
+//! \brief brightness of the dimmed display in percent of the full column currents
+#define POWER_DIM_PERCENT 25
+
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief brightness the display should have, depending on the user activity
+typedef enum powerDisplayLevel {
+    POWER_DISPLAY_FULL = 0,     //!< full brightness
+    POWER_DISPLAY_DIM,          //!< POWER_DIM_PERCENT of the full brightness
+    POWER_DISPLAY_BLANK         //!< display off
+} powerDisplayLevel;
+
+// ---------------------------------------------------------------------------- functions ---
+extern bool power_activity(void);
+extern powerDisplayLevel power_displayLevel(uint32_t *remaining);
+extern void power_idle(void);
+extern void power_printStatistics(void);
+
+#endif /* POWER_H_ */
+// End Doxygen group
+//! @}
@@ -0,0 +1,62 @@
+/*!
+ * \file queue.h
+ * \brief bounded message queues between the tasks, with a policy for a full queue
+ * Every queue between two tasks is one of these, a Mailbox with a policy that decides what a
+ * full queue does with the next message, and counters to tune its depth against the latency
+ * under real load. The policy is set per queue at its creation and may be changed at runtime,
+ * see COMMAND_SET_QUEUE_POLICY. '#5' prints the counters of all queues, COMMAND_GET_QUEUE
+ * reads them over the UART.
+ */
+
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include "common.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief queues of all tasks together
+#define QUEUE_MAX 10
+//! \brief largest message of a queue in bytes, a dropped one is taken out into a buffer of this size
+#define QUEUE_MESSAGE_SIZE 72
+
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief what a full queue does with the next message
+typedef enum queuePolicy {
+    QUEUE_BLOCK = 0,            //!< the producer waits for room, only where it may wait, see queue_create
+    QUEUE_DROP_OLDEST,          //!< the oldest waiting message makes room for it
+    QUEUE_DROP_NEWEST,          //!< the message itself is dropped
+    QUEUE_COALESCE_LATEST,      //!< replaces all waiting messages, even in a queue that is not full
+    QUEUE_POLICIES
+} queuePolicy;
+
+//! \brief one queue, kept by its owner
+typedef struct queue {
+    const char *name;
+    Mailbox_Handle mailbox;
+    uint8_t depth;
+    bool mayWait;                       //!< producers may wait for room, only then QUEUE_BLOCK is allowed
+    volatile uint8_t policy;            //!< queuePolicy
+    void (*discard)(const void *message);   //!< called for a waiting message the policy drops, may be NULL
+    // statistics
+    uint32_t posted;                    //!< messages that went into the queue
+    uint32_t dropped;                   //!< messages lost to the policy, the new or waiting ones
+    uint32_t waited;                    //!< posts of QUEUE_BLOCK that found the queue full
+    uint8_t highWater;                  //!< most messages that were waiting at the same time
+} queue;
+
+// ---------------------------------------------------------------------------- functions ---
+extern void queue_create(queue *q, const char *name, uint16_t size, uint8_t depth, queuePolicy policy,
+                         bool mayWait, Event_Handle event, unsigned int eventId);
+extern bool queue_post(queue *q, const void *message);
+extern bool queue_take(queue *q, void *message);
+extern bool queue_setPolicy(queue *q, queuePolicy policy);
+extern queue *queue_get(uint8_t index);
+extern uint8_t queue_pending(queue *q);
+extern void queue_printStatistics(void);
+
+#endif /* QUEUE_H_ */
+// End Doxygen group
+//! @}
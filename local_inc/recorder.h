@@ -0,0 +1,28 @@
+/*!
+ * \file recorder.h
+ * \brief records raw samples and heart rates of a session to the SD card
+ * Producers append to one of two blocks without ever waiting, the recorder task writes the
+ * other block to the card. See recorder_log.h for the format.
+ */
+
+#ifndef RECORDER_H_
+#define RECORDER_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include "common.h"
+#include "timestamp.h"
+
+//! \addtogroup group_comm
+//! @{
+// ---------------------------------------------------------------------------- functions ---
+extern void setup_Recorder_task(xdc_String name, uint8_t priority);
+extern void recorder_toggle(void);
+extern void recorder_setRecording(bool record);
+extern bool recorder_isRecording(void);
+extern void recorder_addSamples(uint8_t sensor, timestamp_t time, const uint16_t *values, uint8_t count);
+extern void recorder_addBpm(uint8_t sensor, timestamp_t time, uint8_t bpm);
+extern void recorder_printStatistics(void);
+
+#endif /* RECORDER_H_ */
+// End Doxygen group
+//! @}
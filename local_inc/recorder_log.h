@@ -0,0 +1,93 @@
+/*!
+ * \file recorder_log.h
+ * \brief on-disk format of a recorded session, append-only and sector aligned
+ * A session is a sequence of 512 byte sectors. Sector 0 holds the session header, every
+ * following sector is a self-contained block: a header with sequence number, base time and
+ * checksum followed by records that never span two blocks. Blocks are written in time order,
+ * so a reader finds any point in time by a binary search over the block headers alone.
+ * All values are little endian and serialized byte by byte.
+ *
+ * session header (sector 0):
+ *  u32 RECORDER_SESSION_MAGIC, u16 RECORDER_FORMAT_VERSION, u16 RECORDER_SECTOR_SIZE,
+ *  u16 samples per second, u8 amount of sensors, 5 reserved, u64 session start in us, 0 up to the sector end
+ *
+ * block header (every further sector):
+ *  u32 RECORDER_BLOCK_MAGIC, u32 sequence number (the block is in sector sequence + 1),
+ *  u64 base time of the record offsets in us, u16 bytes of payload in use,
+ *  u16 CRC-16/CCITT over the payload in use, the payload follows, 0 behind the used part
+ * The format code only needs the C standard library, the
+ * storage behind it is a recorderDevice, so it runs on the target as well as on a host
+ * against a file-backed device.
+ */
+
+#ifndef RECORDER_LOG_H_
+#define RECORDER_LOG_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include <stdint.h>
+#include <stdbool.h>
+#include "timestamp.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief size of a sector of the storage, everything is written in whole sectors
+#define RECORDER_SECTOR_SIZE 512
+//! \brief "HRS1", first word of the session header in sector 0
+#define RECORDER_SESSION_MAGIC 0x31535248UL
+//! \brief "HRB1", first word of every block
+#define RECORDER_BLOCK_MAGIC 0x31425248UL
+//! \brief version of the format, stored in the session header
+#define RECORDER_FORMAT_VERSION 1
+//! \brief bytes of the session header, the rest of sector 0 is 0
+#define RECORDER_SESSION_HEADER_SIZE 24
+//! \brief bytes of a block header
+#define RECORDER_BLOCK_HEADER_SIZE 20
+//! \brief bytes for records in one block
+#define RECORDER_PAYLOAD_SIZE (RECORDER_SECTOR_SIZE - RECORDER_BLOCK_HEADER_SIZE)
+//! \brief bytes of a record header, samples follow as 16 bit values
+#define RECORDER_RECORD_HEADER_SIZE 8
+
+/*!
+ * \brief record types. A record is: type, sensor, sample count or heart rate, 0, signed 32 bit
+ * offset of the record time to the block base time in us, then the samples (16 bit, oldest first)
+ */
+#define RECORDER_RECORD_SAMPLES 1   //!< raw samples of one FIFO read, the newest one at the record time
+#define RECORDER_RECORD_BPM 2       //!< estimated heart rate
+
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief sector 0 of a session, as stored
+typedef struct recorderSession {
+    uint8_t sector[RECORDER_SECTOR_SIZE];
+} recorderSession;
+
+//! \brief one sector of records
+typedef struct recorderBlock {
+    uint32_t sequence;          //!< block number in the session, the block is stored in sector sequence + 1
+    timestamp_t baseTime;       //!< time the record offsets refer to in us
+    uint16_t used;              //!< bytes of payload in use
+    uint8_t sector[RECORDER_SECTOR_SIZE];   //!< as stored, the records behind the header, which recorderLog_seal fills
+} recorderBlock;
+
+/*!
+ * \brief storage of a session, sector addressed
+ * write stores one RECORDER_SECTOR_SIZE sector, sync makes everything written so far durable.
+ */
+typedef struct recorderDevice {
+    void *context;
+    bool (*write)(void *context, uint32_t sector, const void *data);
+    bool (*sync)(void *context);
+} recorderDevice;
+
+// ---------------------------------------------------------------------------- functions ---
+extern void recorderLog_session(recorderSession *session, uint16_t sampleRate, uint8_t sensorCount, timestamp_t startTime);
+extern void recorderLog_beginBlock(recorderBlock *block, uint32_t sequence);
+extern bool recorderLog_addSamples(recorderBlock *block, uint8_t sensor, timestamp_t time, const uint16_t *values, uint8_t count);
+extern bool recorderLog_addBpm(recorderBlock *block, uint8_t sensor, timestamp_t time, uint8_t bpm);
+extern void recorderLog_seal(recorderBlock *block);
+extern bool recorderLog_writeSession(const recorderDevice *device, const recorderSession *session);
+extern bool recorderLog_writeBlock(const recorderDevice *device, const recorderBlock *block);
+
+#endif /* RECORDER_LOG_H_ */
+// End Doxygen group
+//! @}
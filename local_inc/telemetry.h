@@ -0,0 +1,46 @@
+/*!
+ * \file telemetry.h
+ * \brief UDP telemetry over Ethernet: heart rate, raw samples and health of every sensor
+ * Every period one datagram is sent (more if the samples do not fit), all values little endian:
+ *
+ * header, 24 bytes:
+ *  u32 magic "HRT1", u16 version, u8 sensor count, u8 flags (bit 0: more datagrams follow),
+ *  u32 sequence number, u32 samples skipped so far because the ring buffer was overrun,
+ *  u64 send time in us
+ *
+ * one section per sensor, 36 bytes + 6 per sample:
+ *  u8 sensor, u8 flags (bit 0: present, bit 1: timer acquisition), u8 heart rate, u8 signal quality in %,
+ *  u32 I2C transfers, u32 I2C retries, u32 I2C failures, u32 recoveries,
+ *  u32 largest trigger jitter in us, u16 sample count, u16 0, u64 time of the first sample in us,
+ *  per sample: u32 offset to the first sample in us, u16 value
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include "common.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief "HRT1", first word of every datagram
+#define TELEMETRY_MAGIC 0x31545248UL
+//! \brief version of the datagram layout
+#define TELEMETRY_VERSION 2
+//! \brief default interval between two datagrams in ms
+#define TELEMETRY_DEFAULT_PERIOD 200
+//! \brief destination of the datagrams, broadcast to the local network by default
+#define TELEMETRY_HOST "255.255.255.255"
+//! \brief UDP port of the receiver
+#define TELEMETRY_PORT 5005
+
+// ---------------------------------------------------------------------------- functions ---
+extern void setup_Telemetry_task(xdc_String name, uint8_t priority);
+extern void telemetry_setPeriod(uint32_t period);
+extern void telemetry_printStatistics(void);
+extern void telemetry_ipAddrHook(unsigned int ipAddress, unsigned int ifIndex, unsigned int add);
+
+#endif /* TELEMETRY_H_ */
+// End Doxygen group
+//! @}
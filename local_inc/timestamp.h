@@ -0,0 +1,45 @@
+/*!
+ * \file timestamp.h
+ * \brief monotonic high resolution time base for the sample pipeline
+ * All timestamps are microseconds since the timestamp provider was started. The provider
+ * runs from a general purpose hardware timer (see application.cfg) and is extended to 64 bit,
+ * so it never wraps during runtime.
+ */
+
+#ifndef TIMESTAMP_H_
+#define TIMESTAMP_H_
+
+// ----------------------------------------------------------------------------- includes ---
+#include <stdint.h>
+#include <stdbool.h>
+
+//! \addtogroup group_comm
+//! @{
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief point in time in microseconds, monotonic
+typedef uint64_t timestamp_t;
+
+//! \brief running latency statistic between a timestamp and the time it gets consumed
+typedef struct latencyStats {
+    uint32_t count;     //!< amount of recorded latencies
+    uint32_t last;      //!< last recorded latency in us
+    uint32_t min;       //!< minimal latency in us
+    uint32_t max;       //!< maximal latency in us
+    uint64_t sum;       //!< sum of all latencies, used for the average
+} latencyStats;
+
+// ------------------------------------------------------------------------------ defines ---
+//! \brief microseconds per second
+#define TIMESTAMP_US_PER_SECOND 1000000UL
+
+// ---------------------------------------------------------------------------- functions ---
+extern void timestamp_init(void);
+extern timestamp_t timestamp_now(void);
+extern void latency_reset(latencyStats *stats);
+extern void latency_record(latencyStats *stats, timestamp_t origin);
+extern void latency_add(latencyStats *stats, uint32_t latency);
+extern uint32_t latency_average(const latencyStats *stats);
+
+#endif /* TIMESTAMP_H_ */
+// End Doxygen group
+//! @}
@@ -8,6 +8,12 @@
 #include "local_inc/oled_display.h"
 #include "local_inc/UART_Task.h"
 #include "local_inc/oled_hal.h"
+#include "local_inc/oled_widget.h"
+#include "local_inc/heartrate.h"
+#include "local_inc/history.h"
+#include "local_inc/boot.h"
+#include "local_inc/power.h"
+#include "local_inc/bus.h"
 
 
 //! \addtogroup group_oled_app
@@ -21,31 +27,111 @@
 #define UPPER_MARGIN 4
 //! \brief bottom margin of text window
 #define LOWER_MARGIN 4
+//! \brief amount of displayed heart rate values between two latency reports
+#define LATENCY_REPORT_INTERVAL 12
+//! \brief seconds of history in one column of the trend graph, all columns span the last hour
+#define TREND_SECONDS_PER_COLUMN (HISTORY_SECONDS_SIZE / (OLED_DISPLAY_X_MAX + 1))
+//! \brief y value of a column without heart rate, lies outside the display and is not drawn
+#define TREND_NO_VALUE 0xFF
+//! \brief widgets of the heart rate screen
+#define BPM_TITLE 0
+#define BPM_VALUE 1
+#define BPM_TREND 2
+#define BPM_STATUS 3
+#define BPM_WIDGETS 4
+//! \brief ms between two frames, the display is drawn at most at about 30 Hz
+#define OLED_FRAME_PERIOD 33
+//! \brief received chars waiting for the next frame, a queue without room for another batch of
+//! control messages is drawn at once, chars that do not fit anymore are dropped
+#define OLED_CONSOLE_QUEUE 32
+//! \brief ms the logo is shown after power on
+#define OLED_SPLASH_TIME 3000
+//! \brief ms the shutdown image is shown before the display goes off
+#define OLED_SHUTDOWN_TIME 10000
+//! \brief bus queue of the heart rates, a frame draws the newest ones only
+#define OLED_BUS_DEPTH 4
+#define OLED_BUS_POLICY QUEUE_DROP_OLDEST
+// ----------------------------------------------------------------------------- typedefs ---
+//! \brief power states of the display, the timed ones end at powerDeadline
+typedef enum oledPower {
+    OLED_SPLASH,        //!< logo is shown, the content is drawn when it ends
+    OLED_ON,            //!< content is drawn every frame
+    OLED_SHUTDOWN,      //!< shutdown image is shown, the display goes off when it ends
+    OLED_OFF            //!< display is off, nothing is drawn
+} oledPower;
 // ------------------------------------------------------------------------------ globals ---
 //! \brief contains the actual position of the cursor in window
 static volatile point currentPosition;
 //! \brief whether screen saver scrolling is enabled or disabled
 static volatile bool isScrolling;
+//! \brief cursor position the scrolling was last set for
+static point scrolledPosition;
 //! \brief used font size for next char (1-3)
 static volatile uint8_t fontsize;
 //! \brief used font needed for calculation purposes
-static fontContainer font;
-static color24 charCol;
-static color24 bgcol;
-static char oledChar[4];
+static const fontContainer *font;
+static color16 charCol;
+static color16 bgcol;
+//! \brief status line below the heart rate
+static char statusLine[10];
+//! \brief what the status line shows: the second sensor, or quality and variability of the first one
+static uint8_t secondHeartrate;
+static uint8_t firstQuality;
+static hrvMetrics firstHrv;
+//! \brief heart rates straight from the bus, the broker only sends control messages
+static busSubscriber subscription;
+//! \brief heart rate screen: title, value of the first sensor, its recent values and a status line
+static widget bpmScreen[BPM_WIDGETS];
+//! \brief latency between the acquisition of a sample and the displayed heart rate
+static latencyStats displayLatency;
+//! \brief test case the broker selected, taken over in order with the values
+static uint8_t testcase;
+//! \brief the test case changed, the screen is cleared with the next frame
+static bool clearPending;
+//! \brief the trend changed since the last frame
+static bool trendPending;
+//! \brief a new heart rate waits for the next frame, with the origin time of the newest one
+static bool heartratePending;
+static timestamp_t heartrateTimestamp;
+//! \brief received chars of the text console, drawn with the next frame
+static char consoleQueue[OLED_CONSOLE_QUEUE];
+static uint8_t consoleCount;
+//! \brief power state, a requested change and the end of the timed states in clock ticks
+static oledPower powerState;
+static int8_t powerRequest = -1;
+static uint32_t powerDeadline;
+//! \brief brightness the display is set to, follows the user activity while the display is on
+static powerDisplayLevel displayLevel;
+// statistics
+static uint32_t framesDrawn;
+static uint32_t messagesApplied;
+static uint32_t consoleDropped;
 // ---------------------------------------------------------------------------- functions ---
 static void OLED_Fxn(void);
-static void putValueFromInput(char *inputChar, char *title, char *status);
+static bool takeMessages(void);
+static bool waitMessages(uint32_t timeout);
+static void applyMessage(const oledMessage *message);
+static void applyHeartrate(const heartrateMessage *heartrate);
+static void renderFrame(void);
+static void renderConsole(void);
+static uint32_t powerTimeout(void);
+static void updatePower(void);
+static void setDisplayLevel(powerDisplayLevel level);
+static void setupHeartrateScreen(void);
+static void updateHeartrate(const heartrateMessage *heartrate);
 static bool isPrintableChar (char c);
 static void cursorUpperLeft(void);
 static void updateCurrentPosition(void);
 static void switchRow(void);
 static void setCursor(void);
 static void deleteCharAtCurrentPoint();
+static void clearChar(point origin);
 static bool isPointUpperLeft(point current);
 static bool isPointPrelastRow (point current);
 static void scrollRow (point current);
-static void convertDataToChar(uint8_t inValue, char *outchar);
+static void reportLatency(void);
+static void updateStatusLine(void);
+static void drawTrend(void);
 
 // ----------------------------------------------------------------------- implementation ---
 /*!
@@ -68,113 +154,308 @@ extern void setup_OLED_task(xdc_String name, uint8_t priority) {
     if (taskLed == NULL) {
         System_abort("TaskLed create failed");
     }
+    bus_subscribe(&subscription, "OLED bus", BUS_TOPIC(BUS_TOPIC_HEARTRATE), OLED_BUS_DEPTH, OLED_BUS_POLICY,
+                  oledEvent, OLED_EVENT_BUS);
 }
 /*!
  * \brief OLED function enables the OLED Display, creates a given background
- * In the working while loop displays all incoming char to the display
+ * In the working loop the incoming messages only change the state of the screen, the screen is
+ * drawn once per frame. An idle display draws the first message at once, while messages keep
+ * coming they are collected for OLED_FRAME_PERIOD, so several updates of the same widget cost
+ * one draw and the SPI load stays bounded whatever the input rate is.
+ * The logo after power on and the shutdown image are timed by the same loop, messages are
+ * taken over meanwhile and nobody waits for the display.
  */
 static void OLED_Fxn(void) {
     // power on OLED
     OLED_power_on();
-    createBackgroundFromImage(logo_image);
-    Task_sleep(3000);
+    boot_signal(BOOT_DISPLAY);
+    createBackgroundFromImage(&logo_image);
+    powerState = OLED_SPLASH;
+    powerDeadline = Clock_getTicks() + OLED_SPLASH_TIME;
     fontsize = 1;
     bgcol = blueColor;
     charCol = whiteColor;
-    createBackgroundFromColor(bgcol);
-    uint8_t pulse;
+    clearPending = true;
+    uint32_t lastFrame;
+    uint32_t elapsed;
 
-    initializeFont(&font, fontsize);
+    latency_reset(&displayLatency);
+    font = getFont(fontsize);
     cursorUpperLeft();
+    setupHeartrateScreen();
+    lastFrame = Clock_getTicks() - OLED_FRAME_PERIOD;
 
     while (1) {
+        if (waitMessages(powerTimeout())) {
+            // collect the changes until the frame is due, a filling console queue is drawn at once
+            while ((elapsed = Clock_getTicks() - lastFrame) < OLED_FRAME_PERIOD
+                    && OLED_CONSOLE_QUEUE - consoleCount > BROKER_OLED_DEPTH) {
+                if (!waitMessages(OLED_FRAME_PERIOD - elapsed))
+                    break;
+            }
+            takeMessages();
+        }
+        lastFrame = Clock_getTicks();
+        updatePower();
+        renderFrame();
+    }
+}
+/*!
+ * \brief print how many messages were collected into how many frames
+ */
+void OLED_printStatistics(void) {
+    System_printf("OLED: %u messages in %u frames, %u chars dropped\n", messagesApplied, framesDrawn, consoleDropped);
+    System_flush();
+}
+/*!
+ * \brief take over the waiting heart rates and control messages. The control messages are always
+ * taken, even while nothing is drawn, the broker waits for room in their queue
+ * \return whether there was any
+ */
+static bool takeMessages(void) {
+    oledMessage message;
+    const busMessage *heartrate;
+    bool taken = false;
 
-        // here code for calculating cursor position and initialize the scrolling functionality.
+    // the bus slots are shared with the other subscribers, they are released right away
+    while ((heartrate = bus_receive(&subscription)) != NULL) {
+        applyHeartrate(&heartrate->payload.heartrate);
+        bus_release(heartrate);
+        taken = true;
+    }
+    while (queue_take(&oledMailbox, &message)) {
+        applyMessage(&message);
+        taken = true;
+    }
+    return taken;
+}
+/*!
+ * \brief wait for messages from the broker or the bus and take them over
+ * \param timeout clock ticks to wait at most
+ * \return false if none came in time
+ */
+static bool waitMessages(uint32_t timeout) {
+    // the event may be left over from messages already taken, then the wait goes on
+    while (!takeMessages()) {
+        if (Event_pend(oledEvent, Event_Id_NONE, OLED_EVENT_MESSAGE | OLED_EVENT_BUS, timeout) == 0)
+            return false;
+    }
+    return true;
+}
+/*!
+ * \brief take over the content of a message into the state of the screen, nothing is drawn
+ */
+static void applyMessage(const oledMessage *message) {
+    messagesApplied++;
+    // if test case change occurred, clear screen
+    if (message->type == OLED_MESSAGE_TESTCASE) {
+        testcase = message->value;
+        clearPending = true;
+        consoleCount = 0;
+        // the trend comes from the history, it is drawn right away
+        trendPending = testcase == 4;
+    } else if (message->type == OLED_MESSAGE_POWER) {
+        powerRequest = message->value;
+    } else if (message->type == OLED_MESSAGE_WAKE) {
+        // nothing to take over, updatePower lights the display up
+    } else if (testcase != 2) {
+        // chars are only shown by testcase 2
+    } else if (consoleCount < OLED_CONSOLE_QUEUE) {
+        consoleQueue[consoleCount++] = message->value;
+    } else {
+        // the display is off or still shows the logo, the queue is not drawn meanwhile
+        consoleDropped++;
+    }
+}
+/*!
+ * \brief take over a heart rate, the screen is kept up to date in every testcase
+ */
+static void applyHeartrate(const heartrateMessage *heartrate) {
+    messagesApplied++;
+    updateHeartrate(heartrate);
+    // testcase 0 shows the value, testcase 4 redraws the trend graph with every new heart rate
+    if (testcase == 0) {
+        heartratePending = true;
+        heartrateTimestamp = heartrate->timestamp;  // keep the sample time to measure the latency
+    } else if (testcase == 4) {
+        trendPending = true;
+    }
+}
+/*!
+ * \brief draw everything that changed since the last frame
+ */
+static void renderFrame(void) {
+    // the content is kept up to date meanwhile, it is drawn when the display is on
+    if (powerState != OLED_ON) {
+        return;
+    }
+    framesDrawn++;
+    if (clearPending) {
+        createBackgroundFromColor(bgcol);
+        widget_invalidate(bpmScreen, BPM_WIDGETS, true);
+        cursorUpperLeft();
+        // a new testcase may scroll differently at the same position
         scrollRow(currentPosition);
-        // sem_timeout = Semaphore_pend(sem, BIOS_WAIT_FOREVER);
-        //        char c = charContainer;
-        Mailbox_pend(oledMailbox, &pulse, BIOS_WAIT_FOREVER);
+        clearPending = false;
+    }
+    if (testcase == 0) {
+        widget_render(bpmScreen, BPM_WIDGETS);
+        if (heartratePending) {
+            // value is on screen now, sample to display latency is complete
+            latency_record(&displayLatency, heartrateTimestamp);
+            reportLatency();
+            heartratePending = false;
+        }
+    } else if (testcase == 2) {
+        renderConsole();
+    } else if (testcase == 4 && trendPending) {
+        drawTrend();
+        trendPending = false;
+    }
+    // the scrolling follows the cursor, the controller is only told when it moved
+    if (currentPosition.x != scrolledPosition.x || currentPosition.y != scrolledPosition.y) {
+        scrollRow(currentPosition);
+    }
+}
+/*!
+ * \brief time to wait for a message until a timed power state ends
+ */
+static uint32_t powerTimeout(void) {
+    int32_t remaining = powerDeadline - Clock_getTicks();
+    uint32_t dimming;
+    if (powerState == OLED_ON) {
+        // the next step of the dimming
+        power_displayLevel(&dimming);
+        return dimming;
+    }
+    if (powerState != OLED_SPLASH && powerState != OLED_SHUTDOWN) {
+        return BIOS_WAIT_FOREVER;
+    }
+    return remaining > 0 ? remaining : BIOS_NO_WAIT;
+}
+/*!
+ * \brief power state machine, runs a requested change and ends the timed states
+ * Shutdown shows the shutdown image for OLED_SHUTDOWN_TIME, then the display goes off.
+ * Switching on again is immediate, the screen is cleared and drawn completely. While the
+ * display is on, its brightness follows the user activity, see power.h.
+ */
+static void updatePower(void) {
+    bool expired = (int32_t) (Clock_getTicks() - powerDeadline) >= 0;
 
-        uint8_t testcase = getTestcase();
-        bool isChanged = getChanged();
-        // if test case change occurred, clear screen
-        if (isChanged == true) {
-            createBackgroundFromColor(bgcol);
-            cursorUpperLeft();
-            resetChanged();
+    if (powerRequest == 0 && (powerState == OLED_SPLASH || powerState == OLED_ON)) {
+        // the shutdown image is shown at full brightness
+        setDisplayLevel(POWER_DISPLAY_FULL);
+        createBackgroundFromImage(&cool_image);
+        powerState = OLED_SHUTDOWN;
+        powerDeadline = Clock_getTicks() + OLED_SHUTDOWN_TIME;
+    } else if (powerRequest == 1 && (powerState == OLED_SHUTDOWN || powerState == OLED_OFF)) {
+        if (powerState == OLED_OFF) {
+            OLED_setDisplayOn(true);
         }
-        if (testcase == 0) {
-            convertDataToChar(pulse, &oledChar[0]);
-            putValueFromInput(oledChar, "\3Rate\0", "Stat: OK\0");
-        } else if (testcase == 2) {
-            if (isPrintableChar(pulse)) {
-                // here code for calculating cursor position and initialize the scrolling functionality.
-                // scrollRow(currentPosition);
-                drawChar(pulse, &font, charCol, bgcol, currentPosition);
-                currentPosition.x += font.fontSpacing; // Note text is drawing backwards
-                setCursor();
-            }
-            // inserting testing function for print diagram
-        } else if (testcase == 4) {
-            createBackgroundFromColor(bgcol);
-            uint8_t i;
-            uint8_t yCoordinates[96];
-            for (i = 0; i<96; i++)
-                yCoordinates[i] = i;
-            drawPixelToYPosition(yCoordinates, charCol, redColor);
+        powerState = OLED_ON;
+        clearPending = true;
+    } else if (powerState == OLED_SPLASH && expired) {
+        powerState = OLED_ON;
+    } else if (powerState == OLED_SHUTDOWN && expired) {
+        OLED_setDisplayOn(false);
+        powerState = OLED_OFF;
+    }
+    if (powerState == OLED_ON) {
+        setDisplayLevel(power_displayLevel(NULL));
+    }
+    powerRequest = -1;
+}
+/*!
+ * \brief dim, darken or light up the display, only changes are sent
+ */
+static void setDisplayLevel(powerDisplayLevel level) {
+    if (level == displayLevel) {
+        return;
+    }
+    if (level == POWER_DISPLAY_BLANK) {
+        OLED_setDisplayOn(false);
+    } else {
+        if (displayLevel == POWER_DISPLAY_BLANK) {
+            OLED_setDisplayOn(true);
         }
+        OLED_setBrightness(level == POWER_DISPLAY_DIM ? POWER_DIM_PERCENT : 100);
     }
+    displayLevel = level;
+}
+/*!
+ * \brief draw the received chars, the cursor is only drawn after the last one
+ */
+static void renderConsole(void) {
+    uint8_t i;
+    bool drawn = false;
+
+    for (i = 0; i < consoleCount; i++) {
+        // control codes draw the cursor themselves
+        if (isPrintableChar(consoleQueue[i])) {
+            drawChar(consoleQueue[i], font, charCol, bgcol, currentPosition);
+            currentPosition.x += font->fontSpacing; // Note text is drawing backwards
+            drawn = true;
+        } else {
+            drawn = false;
+        }
+    }
+    if (drawn) {
+        setCursor();
+    }
+    consoleCount = 0;
 }
 /*!
  * \brief set a cursor of type '_' at the current position to give user a visual feedback
  */
 static void setCursor(void) {
     updateCurrentPosition();
-    drawChar('_', &font, charCol, bgcol, currentPosition);
+    drawChar('_', font, charCol, bgcol, currentPosition);
 }
 /*!
- * \brief output the incoming value in a formatted form.
- * \param inputChar value (given as 0-terminated c-String) heart rate
- * \param title header for the formatted output. (c-String 0-terminated)
- * \param status a feedback to the user about the status of the measurement (0-terminated)
+ * \brief lay out the widgets of the heart rate screen, the screen is drawn with the first value
  */
-static void putValueFromInput(char *inputChar, char *title, char *status) {
-    // draw header
-    initializeFont(&font, 1);
-    currentPosition.x = font.fontWidth + 4;
-    currentPosition.y = 4;
-    uint8_t i = 0;
-    while (title[i] != 0) {
-        drawChar(title[i++], &font, charCol, bgcol, currentPosition);
-        currentPosition.x += font.fontSpacing; // Note text is drawing backwards
-    }
-    currentPosition.y += font.fontHeight;
+static void setupHeartrateScreen(void) {
+    point origin = {LEFT_MARGIN, UPPER_MARGIN};
+    rect trend = {{LEFT_MARGIN, 0}, OLED_DISPLAY_X_MAX + 1 - LEFT_MARGIN - RIGHT_MARGIN, 0};
 
-    // draw input value
-    initializeFont(&font, 2);
-    i= 0;
-    currentPosition.x = font.fontWidth + 4;
-    while (inputChar[i] != 0) {
-        drawChar(inputChar[i++], &font, charCol, bgcol, currentPosition);
-        currentPosition.x += font.fontSpacing;
-
-    }
-    //draw status
-    initializeFont(&font, 0);
-    i= 0;
-    currentPosition.x = font.fontWidth + 4;
-    currentPosition.y = OLED_DISPLAY_Y_MAX - font.fontHeight;
-    while (status[i] != 0) {
-        drawChar(status[i++], &font, charCol, bgcol, currentPosition);
-        currentPosition.x += font.fontSpacing;
+    widget_label(&bpmScreen[BPM_TITLE], origin, &fontMedium, 5, charCol, bgcol);
+    widget_setText(&bpmScreen[BPM_TITLE], "\3Rate");
+    origin.y += fontMedium.fontHeight;
+    widget_readout(&bpmScreen[BPM_VALUE], origin, &fontLarge, 3, charCol, bgcol);
+    origin.y += fontLarge.fontHeight;
+    // the trend fills the rows between the value and the status line
+    trend.origin.y = origin.y + 2;
+    trend.height = OLED_DISPLAY_Y_MAX - fontSmall.fontHeight - 2 - trend.origin.y;
+    widget_sparkline(&bpmScreen[BPM_TREND], trend, charCol, bgcol);
+    origin.y = OLED_DISPLAY_Y_MAX - fontSmall.fontHeight;
+    widget_label(&bpmScreen[BPM_STATUS], origin, &fontSmall, sizeof(statusLine) - 1, charCol, bgcol);
+    // the screen has just been cleared
+    widget_invalidate(bpmScreen, BPM_WIDGETS, true);
+}
+/*!
+ * \brief update the widgets of the heart rate screen with a new value, they are drawn with the next frame
+ * \param heartrate heart rate of one sensor from the bus
+ */
+static void updateHeartrate(const heartrateMessage *heartrate) {
+    // first sensor is shown large, the second one in the status line
+    if (heartrate->sensor == 0) {
+        widget_setValue(&bpmScreen[BPM_VALUE], heartrate->bpm);
+        widget_pushValue(&bpmScreen[BPM_TREND], heartrate->bpm);
+        firstQuality = heartrate->quality;
+        firstHrv = heartrate->hrv;
+    } else if (heartrate->sensor == 1) {
+        secondHeartrate = heartrate->bpm;
     }
+    updateStatusLine();
+    widget_setText(&bpmScreen[BPM_STATUS], statusLine);
 }
 /*!
  *  \brief set the initial starting point to the upper left corner
  *  Note: the fonts origin is fonts upper right corner.
  */
 static void cursorUpperLeft(void) {
-    currentPosition.x = font.fontWidth + LEFT_MARGIN;
+    currentPosition.x = font->fontWidth + LEFT_MARGIN;
     currentPosition.y = UPPER_MARGIN;
 }
 /*!
@@ -192,7 +473,7 @@ static void updateCurrentPosition(void) {
  * different actions are taken. in case '\b' the cursor moves on step backwards and a plain background is drawn.
  * in chase '\n' switches the current row. in case '\t' down scrolling is switched between enable/disable
  * \param c char, the given char to examined
- * \param bgcolor color24, the given background color for '\b' operation
+ * \param bgcolor color16, the given background color for '\b' operation
  * \return true, if char is printable character, false in other case.
  */
 static bool isPrintableChar (char c) {
@@ -201,7 +482,7 @@ static bool isPrintableChar (char c) {
         return true;
     }
     // delete cursor, because char is not a printable one
-    drawChar(0x20, &font, bgcol, bgcol, currentPosition);
+    clearChar(currentPosition);
 
     // switch upon incoming control code. more control codes are possible.
     switch (c) {
@@ -216,7 +497,7 @@ static bool isPrintableChar (char c) {
         // increases font size
     case 9:
         fontsize = ++fontsize % 3;
-        initializeFont(&font, fontsize);
+        font = getFont(fontsize);
         // clear screen
         createBackgroundFromColor(bgcol);
         // begin upper left
@@ -239,30 +520,38 @@ static bool isPrintableChar (char c) {
  */
 static void deleteCharAtCurrentPoint() {
     // delete cursor
-    drawChar(0x20, &font, bgcol, bgcol, currentPosition);
+    clearChar(currentPosition);
     // is cursor at begin of display?
-    if ((currentPosition.x - font.fontSpacing) <  LEFT_MARGIN) {
-        currentPosition.y -= font.fontHeading; // jump 1 row back
+    if ((currentPosition.x - font->fontSpacing) <  LEFT_MARGIN) {
+        currentPosition.y -= font->fontHeading; // jump 1 row back
         // set cursor at last position of this row
-        currentPosition.x = OLED_DISPLAY_X_MAX - ((OLED_DISPLAY_X_MAX - LEFT_MARGIN) % font.fontSpacing) - (font.fontSpacing - font.fontWidth);
-        drawChar(0x20, &font, bgcol, bgcol, currentPosition);  // draw space without char feed
+        currentPosition.x = OLED_DISPLAY_X_MAX - ((OLED_DISPLAY_X_MAX - LEFT_MARGIN) % font->fontSpacing) - (font->fontSpacing - font->fontWidth);
+        clearChar(currentPosition);  // draw space without char feed
     } else {
-        currentPosition.x -= font.fontSpacing; // Spacing is font width + extra space for the next char
-        drawChar(0x20, &font, bgcol, bgcol, currentPosition);  // draw space without char feed
+        currentPosition.x -= font->fontSpacing; // Spacing is font width + extra space for the next char
+        clearChar(currentPosition);  // draw space without char feed
     }
     setCursor();
 }
+/*!
+ * \brief fill the area of a character with the background, the glyph is not drawn at all
+ * \param origin the origin of the char as given to drawChar, its upper right corner
+ */
+static void clearChar(point origin) {
+    rect area = {{origin.x - font->fontWidth, origin.y}, font->fontWidth + 1, font->fontHeight};
+    fillRect(area, bgcol);
+}
 /*!
  * \brief switch the current working next row to the following
  * Note: fonts origin is upper right, therefore last row is twice the height of the font
  */
 static void switchRow(void) {
-    currentPosition.x = font.fontWidth + LEFT_MARGIN;
+    currentPosition.x = font->fontWidth + LEFT_MARGIN;
     // is end of last line? jump to upper left.
-    if (currentPosition.y + 2*font.fontHeading > OLED_DISPLAY_Y_MAX) {
+    if (currentPosition.y + 2*font->fontHeading > OLED_DISPLAY_Y_MAX) {
         currentPosition.y = UPPER_MARGIN;
     } else {
-        currentPosition.y += font.fontHeading;
+        currentPosition.y += font->fontHeading;
     }
 }
 /*! \brief evaluate if current point is 1 character space before first point in display.
@@ -271,13 +560,13 @@ static void switchRow(void) {
  * \return true if point is first point, false in all other cases
  */
 static bool isPointUpperLeft(point current) {
-    if ((current.x - font.fontSpacing <= LEFT_MARGIN) && (current.y <= UPPER_MARGIN))
+    if ((current.x - font->fontSpacing <= LEFT_MARGIN) && (current.y <= UPPER_MARGIN))
         return true;
     return false;
 }
 // this function is useful to detect end of display in order to scroll down, while typing is still ongoing.
 static bool isPointPrelastRow (point current) {
-    if (current.y + 3 * font.fontSpacing >= OLED_DISPLAY_Y_MAX)
+    if (current.y + 3 * font->fontSpacing >= OLED_DISPLAY_Y_MAX)
         return true;
     return false;
 }
@@ -288,8 +577,9 @@ static bool isPointPrelastRow (point current) {
  *  begin to scroll
  */
 static void scrollRow (point current) {
+    scrolledPosition = current;
     // disable scrolling when displaying heart rate
-    if (getTestcase() == 0) {
+    if (testcase == 0) {
         toggleUpScroll(false);
         return;
     }
@@ -301,14 +591,68 @@ static void scrollRow (point current) {
     toggleUpScroll(isScrolling);
 }
 
-// Compiler prints a waring because snprintf is not declared in c89 but in c99
-// see https://e2e.ti.com/support/tools/ccs/f/81/t/123841?tisearch=e2e-sitesearch&keymatch=snprintf%20header
-static void convertDataToChar(uint8_t inValue, char *outchar) {
-    uint8_t result = snprintf(outchar, 4, "%03u\0", inValue);
-    if (result == 0) {
-        System_printf("Not written any pulse value.\n");
-        System_flush();
+/*!
+ * \brief fill the status line, with more than one sensor the second sensors value is shown there,
+ * otherwise the signal quality of the first one, alternating with its RMSSD once that is known
+ */
+static void updateStatusLine(void) {
+    static bool showHrv;
+
+    showHrv = !showHrv && firstHrv.rmssd > 0;
+    if (HEARTRATE_SENSOR_COUNT > 1)
+        System_snprintf(statusLine, sizeof(statusLine), "#2: %03u", secondHeartrate);
+    else if (firstQuality == 0)
+        System_snprintf(statusLine, sizeof(statusLine), "No signal");
+    else if (showHrv)
+        System_snprintf(statusLine, sizeof(statusLine), "RMSSD %u", firstHrv.rmssd);
+    else
+        System_snprintf(statusLine, sizeof(statusLine), "Sig: %u", firstQuality);
+}
+/*!
+ * \brief print the sample to display latency every LATENCY_REPORT_INTERVAL displayed values
+ */
+static void reportLatency(void) {
+    if (displayLatency.count == 0 || displayLatency.count % LATENCY_REPORT_INTERVAL != 0)
+        return;
+    System_printf("Latency sensor->OLED [us]: last %u, min %u, max %u, avg %u\n",
+                  displayLatency.last, displayLatency.min, displayLatency.max, latency_average(&displayLatency));
+    System_flush();
+}
+/*!
+ * \brief draw the heart rate of the first sensor over the last hour, straight from the history.
+ * Every column shows the average of TREND_SECONDS_PER_COLUMN seconds, oldest left. The graph
+ * is scaled to the lowest and highest average on screen.
+ */
+static void drawTrend(void) {
+    uint8_t yCoordinates[OLED_DISPLAY_X_MAX + 1];
+    historyBucket column;
+    uint8_t low = UINT8_MAX;
+    uint8_t high = 0;
+    uint8_t x;
+
+    for (x = 0; x <= OLED_DISPLAY_X_MAX; x++) {
+        if (history_summarize(0, HISTORY_SECONDS, (uint32_t)(OLED_DISPLAY_X_MAX - x) * TREND_SECONDS_PER_COLUMN,
+                              TREND_SECONDS_PER_COLUMN, &column)) {
+            yCoordinates[x] = column.avg;
+            if (column.avg < low)
+                low = column.avg;
+            if (column.avg > high)
+                high = column.avg;
+        } else {
+            yCoordinates[x] = 0;
+        }
+    }
+    // scale the averages into the rows between the margins
+    for (x = 0; x <= OLED_DISPLAY_X_MAX; x++) {
+        if (yCoordinates[x] == 0)
+            yCoordinates[x] = TREND_NO_VALUE;
+        else if (high == low)
+            yCoordinates[x] = OLED_DISPLAY_Y_MAX / 2;
+        else
+            yCoordinates[x] = LOWER_MARGIN + (uint16_t)(yCoordinates[x] - low)
+                    * (OLED_DISPLAY_Y_MAX - LOWER_MARGIN - UPPER_MARGIN) / (high - low);
     }
+    drawPixelToYPosition(yCoordinates, charCol, bgcol);
 }
 // Close Doxygen group
 //! @}
@@ -5,13 +5,27 @@
  */
 // ----------------------------------------------------------------------------- includes ---
 #include "local_inc/oled_hal.h"
+#include "resources/color_table.h"
 
 //! \addtogroup group_oled_hal
 //! @{
 
+// ----------------------------------------------------------------------------- defines ---
+//! \brief largest single SPI transfer in bytes, limited by the uDMA of the SPI driver
+#define OLED_BURST_SIZE 1024
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+//! \brief sequential reader over the pixels of an image of any encoding
+typedef struct imageCursor {
+    const image *sprite;    //!< image to read
+    uint16_t index;         //!< next word or byte of the data
+    uint16_t run;           //!< pixels left of the current IMAGE_RLE run or literal
+    bool repeat;            //!< the current IMAGE_RLE header is a run
+} imageCursor;
 // ----------------------------------------------------------------------------- globals ---
 static volatile uint32_t ui32SysClkFreq;
 static volatile SPI_Handle handle;
+//! \brief pixels in transfer byte order, a whole glyph or a part of a compressed image is expanded here
+static uint16_t burstBuffer[FONT_MAX_GLYPH_PIXELS];
 
 //! \brief Constant Address of PIN OLED Reset
 static const PinAddress OLED_RST = {OLED_RST_PORT, OLED_RST_PIN};
@@ -35,28 +49,33 @@ static const PinAddress LED04  = {LED_04_PORT, LED_04_PIN};
 static void commandSPI(uint8_t reg, uint8_t value);
 static void writeOLED_indexRegister(uint8_t reg);
 static void writeOLED_dataRegister(uint8_t data);
-static void wait_ms(uint32_t delay);
-static color16 createColorPixelFromRGB(color24 rgbData);
+static void writeOLED_dataBurst(const void *data, uint16_t count);
+static uint16_t wireColor(color16 color);
+static void setWindow(point destination, uint8_t width, uint8_t height);
+static void fillArea(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t pixel);
+static void fillSpan(point from, point to, uint16_t pixel);
+static uint8_t circleExtent(uint8_t radius, uint8_t row);
+static void cursorSkip(imageCursor *cursor, uint16_t count);
+static uint16_t cursorNext(imageCursor *cursor);
+static uint16_t bufferPixel(uint16_t fill, uint16_t pixel);
 // ----------------------------------------------------------------------- implementations ---
 
 //! \brief predefined color white
-const color24 whiteColor = {0xFF,0xFF,0xFF};
+const color16 whiteColor = COLOR16(0xFF, 0xFF, 0xFF);
 //! \brief predefined color black
-const color24 blackColor = {0x00,0x00,0x00};
+const color16 blackColor = COLOR16(0x00, 0x00, 0x00);
 //! \brief predefined color red
-const color24 redColor = {0xFF,0x00,0x00};
+const color16 redColor = COLOR16(0xFF, 0x00, 0x00);
 //! \brief predefined color green
-const color24 greenColor = {0x00,0xFF,0x00};
+const color16 greenColor = COLOR16(0x00, 0xFF, 0x00);
 //! \brief predefined color blue
-const color24 blueColor = {0x00,0x00,0xFF};
-/*!
- * \brief dela the system for a given time
- * \param delay uint32_t delay time in milliseconds 10^-3 sec
- */
-static void wait_ms(uint32_t delay) {
-    // wait for delay in ms Frequency 120MHz
-    SysCtlDelay(ui32SysClkFreq / 3000 * delay);
-}
+const color16 blueColor = COLOR16(0x00, 0x00, 0xFF);
+//! \brief predefined color yellow
+const color16 yellowColor = COLOR16(0xFF, 0xFF, 0x00);
+//! \brief predefined color cyan
+const color16 cyanColor = COLOR16(0x00, 0xFF, 0xFF);
+//! \brief predefined color magenta
+const color16 magentaColor = COLOR16(0xFF, 0x00, 0xFF);
 /*!
  * \brief Confgure the GPIO Pins for the used peripherals
  * Pins are set correctly for following peripherals
@@ -140,55 +159,37 @@ extern void initSPI(uint32_t systemFrequency) {
  * The char get printed one by one, and printed onto the screen. Font size may be choose between 3 different sizes.
  * \param c the character get printed onto the screen (char in ascii value)
  * \param font the selected font with all associated data
- * \param fontColor the color of the printed char in classic 24Bit RGB (no alpha channel)
+ * \param fontColor the color of the printed char
  * \param bgColor background color for the char, because no alpha channel is supported
  * \param origin the lower left corner of the char in the screen coordinates
  */
-void drawChar(char c, fontContainer *font, color24 fontColor, color24 bgColor, point origin) {
-    // select middle of screen
-    // create font rectangle FONT_WIDTH x FONT_HEIGHT (7x13), Text is drawn upside down
+void drawChar(char c, const fontContainer *font, color16 fontColor, color16 bgColor, point origin) {
+    // create font rectangle FONT_WIDTH x FONT_HEIGHT, Text is drawn upside down
     // calculate from the right margin
     // set the drawing window for each char, according to the given font size
     commandSPI(OLED_MEM_X1, OLED_DISPLAY_X_MAX - origin.x);
-    commandSPI(OLED_MEM_X2, OLED_DISPLAY_X_MAX -origin.x + font->fontWidth);
+    commandSPI(OLED_MEM_X2, OLED_DISPLAY_X_MAX - origin.x + font->fontWidth);
     commandSPI(OLED_MEM_Y1, origin.y);
-    commandSPI(OLED_MEM_Y2, origin.y + font->fontHeight);
+    commandSPI(OLED_MEM_Y2, origin.y + font->fontHeight - 1);
     // write from bottom to top
     commandSPI(OLED_MEMORY_WRITE_READ, OLED_MEMORY_WRITE_READ_HORZ_INC_VERT_INC);
+
+    // the packed glyph is expanded by the font specific blitter, then it goes out in one burst
+    expandChar(font, c, wireColor(fontColor), wireColor(bgColor), burstBuffer);
     // enable DDRAM for writing
     writeOLED_indexRegister(OLED_DDRAM_DATA_ACCESS_PORT);
-    uint8_t i,j,k,value;
-
-    color16 charCol = createColorPixelFromRGB(fontColor);
-    color16 backCol = createColorPixelFromRGB(bgColor);
-    // outer loop defines the height od each char
-    for (i = 0; i < font->fontHeight * font->fontDepthByte; i+= font->fontDepthByte) {
-        // each char may wider than 8 bit
-        for (k = 0; k < font->fontDepthByte; k++) {
-            value = font->font[c * font->charArrayLength + i + k];
-            // step through each bit of the value to find if set or unset.
-            for (j = 0; j < 8; j++) {
-                if (value & 1) {
-                    writeOLED_dataRegister(charCol.upperByte);
-                    writeOLED_dataRegister(charCol.lowerByte);
-                } else {
-                    writeOLED_dataRegister(backCol.upperByte);
-                    writeOLED_dataRegister(backCol.lowerByte);
-                }
-                value >>= 1; // step bitwise through the font (8Bit)
-            }
-        }
-    }
+    writeOLED_dataBurst(burstBuffer, (font->fontWidth + 1) * font->fontHeight * OLED_DISPLAY_BYTES_PIXEL);
 }
 /* \brief draw pixel in y axis to display
  * used for building a diagram
  * \param yValue height value normalized stored in a array, amount of values to be displayed, should be as many as x -pixels size i.e. 96
- * \param lineColor the color of the diagram line in classic 24Bit RGB (no alpha channel)
+ * \param lineColor the color of the diagram line
  * \param bgColor background color for the char, because no alpha channel is supported
  */
-void drawPixelToYPosition(uint8_t *yValues, color24 lineColor, color24 bgColor) {
-    color16 lineCol = createColorPixelFromRGB(lineColor);
-    color16 backCol = createColorPixelFromRGB(bgColor);
+void drawPixelToYPosition(uint8_t *yValues, color16 lineColor, color16 bgColor) {
+    uint16_t lineCol = wireColor(lineColor);
+    uint16_t backCol = wireColor(bgColor);
+    uint16_t fill = 0;
     uint8_t x, y;
     // configure the windowsize
     commandSPI(OLED_MEM_X1, 0x00);
@@ -207,27 +208,37 @@ void drawPixelToYPosition(uint8_t *yValues, color24 lineColor, color24 bgColor)
     {
         for (y = 0; y <= OLED_DISPLAY_Y_MAX; y++) {
             if (yValues[x] == y || yValues[x] == y+1) {
-                writeOLED_dataRegister(lineCol.upperByte);
-                writeOLED_dataRegister(lineCol.lowerByte);
+                fill = bufferPixel(fill, lineCol);
             } else {
-                writeOLED_dataRegister(backCol.upperByte);
-                writeOLED_dataRegister(backCol.lowerByte);
+                fill = bufferPixel(fill, backCol);
             }
         }
     }
+    if (fill > 0) {
+        writeOLED_dataBurst(burstBuffer, fill * OLED_DISPLAY_BYTES_PIXEL);
+    }
 }
 
-/*
- * \brief shuts the OLED Display down
+/*!
+ * \brief set the brightness by the column currents, the current of the OLED scales with it
+ * \param percent 100 for the full currents, 0 for the lowest ones
+ */
+void OLED_setBrightness(uint8_t percent) {
+    if (percent > 100) {
+        percent = 100;
+    }
+    commandSPI(OLED_COLUMN_CURRENT_R, OLED_COLUMN_CURRENT_R_FULL * percent / 100);
+    commandSPI(OLED_COLUMN_CURRENT_G, OLED_COLUMN_CURRENT_G_FULL * percent / 100);
+    commandSPI(OLED_COLUMN_CURRENT_B, OLED_COLUMN_CURRENT_B_FULL * percent / 100);
+}
+/*!
+ * \brief switch the OLED Display on or off, the content of the display RAM is kept
+ * Sleeps the calling task, call it from the OLED task only.
+ * \param on true to switch the display on
  */
-void OLED_toggle_Display_on_off(void) {
-    static bool display;
-    // Set STANDBY_ON_OFF
-    createBackgroundFromImage(cool_image);
-    wait_ms(10000);           // wait 10  s
-    commandSPI(OLED_DISPLAY_ON_OFF, display);  // Display OFF
-    wait_ms(5);           // wait 5 ms
-    display ^= 1;         // toggle on off
+void OLED_setDisplayOn(bool on) {
+    commandSPI(OLED_DISPLAY_ON_OFF, on);
+    Task_sleep(5);           // wait 5 ms
 }
 
 static void adressEntireOLED(void) {
@@ -242,47 +253,337 @@ static void adressEntireOLED(void) {
 }
 /*!
  * \brief create a background with an uniform color for the display-
- * \param rgbColor color24, background color in classic 24Bit RGB (no alpha channel)
+ * \param color color16, background color
  */
-void createBackgroundFromColor(color24 rgbColor) {
+void createBackgroundFromColor(color16 color) {
     adressEntireOLED();
-    color16 color;
-    uint16_t i;
-    color = createColorPixelFromRGB(rgbColor);
-    // enable DDRAM for writing
-    writeOLED_indexRegister(OLED_DDRAM_DATA_ACCESS_PORT);
-    // loop through all pixel of oled, register is 8 bit wide, but has to be 16, so double it!
-    for (i = 0; i < OLED_DISPLAY_MAX_PIXEL; i++) {
-        writeOLED_dataRegister(color.upperByte);  // Upper Byte first Transmission S. 10/43
-        writeOLED_dataRegister(color.lowerByte);
+    fillArea(0, 0, OLED_DISPLAY_X_MAX + 1, OLED_DISPLAY_Y_MAX + 1, wireColor(color));
+}
+/*!
+ * \brief fill a rectangle with one color
+ * \param area the rectangle in screen coordinates, parts outside the display are clipped
+ * \param color the color
+ */
+void fillRect(rect area, color16 color) {
+    fillArea(area.origin.x, area.origin.y, area.width, area.height, wireColor(color));
+}
+/*!
+ * \brief draw a horizontal line from start to the right
+ */
+void drawHLine(point start, uint8_t length, color16 color) {
+    fillArea(start.x, start.y, length, 1, wireColor(color));
+}
+/*!
+ * \brief draw a vertical line from start downwards
+ */
+void drawVLine(point start, uint8_t length, color16 color) {
+    fillArea(start.x, start.y, 1, length, wireColor(color));
+}
+/*!
+ * \brief draw a line between two points with the Bresenham algorithm
+ * Pixels in a row along the major axis are collected into spans, every span is a single fill.
+ * \param from first point of the line
+ * \param to last point of the line
+ * \param color the color
+ */
+void drawLine(point from, point to, color16 color) {
+    uint16_t pixel = wireColor(color);
+    int16_t dx = abs(to.x - from.x);
+    int16_t dy = -abs(to.y - from.y);
+    int8_t sx = from.x < to.x ? 1 : -1;
+    int8_t sy = from.y < to.y ? 1 : -1;
+    bool xMajor = dx >= -dy;
+    int16_t error = dx + dy;
+    int16_t doubled;
+    bool stepX, stepY;
+    point current = from;
+    point spanStart = from;
+
+    while (current.x != to.x || current.y != to.y) {
+        doubled = 2 * error;
+        stepX = doubled >= dy;
+        stepY = doubled <= dx;
+        if (stepX) {
+            error += dy;
+        }
+        if (stepY) {
+            error += dx;
+        }
+        // the span ends as soon as the minor axis steps
+        if (xMajor ? stepY : stepX) {
+            fillSpan(spanStart, current, pixel);
+        }
+        if (stepX) {
+            current.x += sx;
+        }
+        if (stepY) {
+            current.y += sy;
+        }
+        if (xMajor ? stepY : stepX) {
+            spanStart = current;
+        }
+    }
+    fillSpan(spanStart, current, pixel);
+}
+/*!
+ * \brief draw the outline of a circle
+ * Every row of the outline is drawn as two spans, the pixels of the circle are those with
+ * x * x + y * y <= radius * radius + radius, which gives round shapes for small radii.
+ * \param center center of the circle, the circle may reach over the display border
+ * \param radius radius in pixels
+ * \param color the color
+ */
+void drawCircle(point center, uint8_t radius, color16 color) {
+    uint16_t pixel = wireColor(color);
+    int16_t row;
+    uint8_t outer, inner;
+
+    for (row = -radius; row <= radius; row++) {
+        outer = circleExtent(radius, abs(row));
+        // columns up to the extent of the next row further out are covered by that row
+        inner = abs(row) == radius ? 0 : circleExtent(radius, abs(row) + 1) + 1;
+        if (inner > outer) {
+            inner = outer;
+        }
+        if (inner == 0) {
+            fillArea(center.x - outer, center.y + row, 2 * outer + 1, 1, pixel);
+        } else {
+            fillArea(center.x - outer, center.y + row, outer - inner + 1, 1, pixel);
+            fillArea(center.x + inner, center.y + row, outer - inner + 1, 1, pixel);
+        }
+    }
+}
+/*!
+ * \brief draw a filled circle, one span per row
+ * \param center center of the circle, the circle may reach over the display border
+ * \param radius radius in pixels
+ * \param color the color
+ */
+void fillCircle(point center, uint8_t radius, color16 color) {
+    uint16_t pixel = wireColor(color);
+    int16_t row;
+    uint8_t outer;
+
+    for (row = -radius; row <= radius; row++) {
+        outer = circleExtent(radius, abs(row));
+        fillArea(center.x - outer, center.y + row, 2 * outer + 1, 1, pixel);
+    }
+}
+/*!
+ * \brief largest x of a circle pixel in the given row, x * x + row * row <= radius * radius + radius
+ */
+static uint8_t circleExtent(uint8_t radius, uint8_t row) {
+    uint16_t limit = radius * radius + radius - row * row;
+    uint8_t x = radius;
+    while (x * x > limit) {
+        x--;
+    }
+    return x;
+}
+/*!
+ * \brief fill the rectangle between two points of a line
+ */
+static void fillSpan(point from, point to, uint16_t pixel) {
+    fillArea(MIN(from.x, to.x), MIN(from.y, to.y), abs(to.x - from.x) + 1, abs(to.y - from.y) + 1, pixel);
+}
+/*!
+ * \brief fill a rectangle of the screen, clipped to the display
+ * The window is programmed once, the color is put into the burst buffer once and sent as often
+ * as needed.
+ * \param pixel color in transfer byte order
+ */
+static void fillArea(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t pixel) {
+    point origin;
+    uint16_t count, chunk, i;
+
+    if (x < 0) {
+        width += x;
+        x = 0;
+    }
+    if (y < 0) {
+        height += y;
+        y = 0;
+    }
+    width = MIN(width, OLED_DISPLAY_X_MAX + 1 - x);
+    height = MIN(height, OLED_DISPLAY_Y_MAX + 1 - y);
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    origin.x = x;
+    origin.y = y;
+    setWindow(origin, width, height);
+
+    count = width * height;
+    chunk = MIN(count, FONT_MAX_GLYPH_PIXELS);
+    for (i = 0; i < chunk; i++) {
+        burstBuffer[i] = pixel;
+    }
+    while (count > 0) {
+        chunk = MIN(count, FONT_MAX_GLYPH_PIXELS);
+        writeOLED_dataBurst(burstBuffer, chunk * OLED_DISPLAY_BYTES_PIXEL);
+        count -= chunk;
     }
 }
 /*!
  * \brief create a background from an given image.
- * \param screenimage image in bitmap format, supplied by a c-array
+ * \param screenimage image of the size of the display, generated by tools/imgconv.py
  */
-void createBackgroundFromImage(image screenimage) {
+void createBackgroundFromImage(const image *screenimage) {
+    point origin = {0, 0};
     // adress the entire screen
     adressEntireOLED();
-    uint16_t i;
+    drawImage(screenimage, NULL, origin, IMAGE_NO_KEY);
+}
+/*!
+ * \brief draw an image or a part of it, e.g. an icon, without touching the rest of the screen
+ * The window is set once and the pixels follow in one burst. Raw images go out from flash,
+ * compressed ones are expanded into the burst buffer. With a transparency key every opaque
+ * span of a row gets its own window, because the display memory can not be read back.
+ * \param sprite the image generated by tools/imgconv.py
+ * \param source part of the image in image coordinates, NULL for the whole image
+ * \param destination upper left corner on the display
+ * \param key color that is not drawn, IMAGE_KEY(red, green, blue) or IMAGE_NO_KEY
+ */
+void drawImage(const image *sprite, const rect *source, point destination, int32_t key) {
+    imageCursor cursor = {sprite, 0, 0, false};
+    rect part = {{0, 0}, sprite->width, sprite->height};
+    uint16_t fill = 0;
+    uint16_t pixel;
+    uint8_t x, y, start;
+
+    if (source != NULL) {
+        part = *source;
+    }
+    // clip to the image and to the display
+    if (part.origin.x >= sprite->width || part.origin.y >= sprite->height
+            || destination.x > OLED_DISPLAY_X_MAX || destination.y > OLED_DISPLAY_Y_MAX) {
+        return;
+    }
+    part.width = MIN(part.width, MIN(sprite->width - part.origin.x, OLED_DISPLAY_X_MAX + 1 - destination.x));
+    part.height = MIN(part.height, MIN(sprite->height - part.origin.y, OLED_DISPLAY_Y_MAX + 1 - destination.y));
+    if (part.width == 0 || part.height == 0) {
+        return;
+    }
+
+    // whole rows of a raw image are in flash as they have to be sent
+    if (key == IMAGE_NO_KEY && sprite->encoding == IMAGE_RAW && part.width == sprite->width) {
+        setWindow(destination, part.width, part.height);
+        writeOLED_dataBurst((const uint16_t *) sprite->data + part.origin.y * sprite->width,
+                            part.width * part.height * OLED_DISPLAY_BYTES_PIXEL);
+        return;
+    }
+
+    if (key == IMAGE_NO_KEY) {
+        setWindow(destination, part.width, part.height);
+    }
+    cursorSkip(&cursor, part.origin.y * sprite->width);
+    for (y = 0; y < part.height; y++) {
+        cursorSkip(&cursor, part.origin.x);
+        if (key == IMAGE_NO_KEY) {
+            for (x = 0; x < part.width; x++) {
+                fill = bufferPixel(fill, cursorNext(&cursor));
+            }
+        } else {
+            // a row is at most the display wide, the spans always fit into the buffer
+            start = 0;
+            for (x = 0; x <= part.width; x++) {
+                pixel = x < part.width ? cursorNext(&cursor) : (uint16_t) key;
+                if (pixel != (uint16_t) key) {
+                    burstBuffer[x - start] = pixel;
+                    continue;
+                }
+                if (x > start) {
+                    point span = {destination.x + start, destination.y + y};
+                    setWindow(span, x - start, 1);
+                    writeOLED_dataBurst(burstBuffer, (x - start) * OLED_DISPLAY_BYTES_PIXEL);
+                }
+                start = x + 1;
+            }
+        }
+        cursorSkip(&cursor, sprite->width - part.origin.x - part.width);
+    }
+    if (fill > 0) {
+        writeOLED_dataBurst(burstBuffer, fill * OLED_DISPLAY_BYTES_PIXEL);
+    }
+}
+/*!
+ * \brief select the display memory behind a rectangle on the screen and start writing to it
+ * The display is mirrored horizontally like the text, so the columns are written decreasing.
+ */
+static void setWindow(point destination, uint8_t width, uint8_t height) {
+    commandSPI(OLED_MEM_X1, OLED_DISPLAY_X_MAX - (destination.x + width - 1));
+    commandSPI(OLED_MEM_X2, OLED_DISPLAY_X_MAX - destination.x);
+    commandSPI(OLED_MEM_Y1, destination.y);
+    commandSPI(OLED_MEM_Y2, destination.y + height - 1);
+    commandSPI(OLED_MEMORY_WRITE_READ, OLED_MEMORY_WRITE_READ_HORZ_DEC_VERT_INC);
     // enable DDRAM for writing
     writeOLED_indexRegister(OLED_DDRAM_DATA_ACCESS_PORT);
-    // loop through all pixel of oled, register is 8 bit wide, but has to be 16, so double it!
-    for (i = 1; i < (screenimage.width * screenimage.height * screenimage.bytes_per_pixel + 1); i++) {
-        writeOLED_dataRegister(screenimage.pixel_data[i]);
+}
+/*!
+ * \brief pass over pixels of an image
+ */
+static void cursorSkip(imageCursor *cursor, uint16_t count) {
+    if (cursor->sprite->encoding != IMAGE_RLE) {
+        cursor->index += count;
+        return;
+    }
+    for (; count > 0; count--) {
+        cursorNext(cursor);
+    }
+}
+/*!
+ * \brief the next pixel of an image
+ * \return color in transfer byte order
+ */
+static uint16_t cursorNext(imageCursor *cursor) {
+    const uint16_t *words = (const uint16_t *) cursor->sprite->data;
+    uint16_t pixel;
+
+    switch (cursor->sprite->encoding) {
+        case IMAGE_PALETTE:
+            return cursor->sprite->palette[((const uint8_t *) cursor->sprite->data)[cursor->index++]];
+        case IMAGE_RLE:
+            if (cursor->run == 0) {
+                cursor->repeat = (words[cursor->index] & IMAGE_RLE_RUN) != 0;
+                cursor->run = words[cursor->index++] & ~IMAGE_RLE_RUN;
+            }
+            cursor->run--;
+            if (!cursor->repeat) {
+                return words[cursor->index++];
+            }
+            pixel = words[cursor->index];
+            if (cursor->run == 0) {
+                cursor->index++;
+            }
+            return pixel;
+        default:
+            return words[cursor->index++];
+    }
+}
+/*!
+ * \brief append a pixel to the burst buffer, a full buffer is sent
+ * \return new fill level of the buffer
+ */
+static uint16_t bufferPixel(uint16_t fill, uint16_t pixel) {
+    burstBuffer[fill++] = pixel;
+    if (fill == FONT_MAX_GLYPH_PIXELS) {
+        writeOLED_dataBurst(burstBuffer, sizeof(burstBuffer));
+        fill = 0;
     }
+    return fill;
 }
 /*!
  * \brief Convert a 24Bit(8:8:8) RGB value to 16 Bit RGB (5:6:5) Pixel value
- * \param rgbData color value of a pixel in 24bit RGB(8:8:8) no Alpha cannel
+ * Every channel is scaled and gamma corrected by a lookup in the tables of tools/colortable.py.
+ * \param rgbColor color value of a pixel in 24bit RGB(8:8:8) no Alpha cannel
  * \return converted colorvalue in 16bit RGB space (5:6:5) space, divided into 2 Byte (MSB and LSB)
  */
-static color16 createColorPixelFromRGB(color24 rgbData) {
+color16 colorFromRGB(color24 rgbColor) {
     color16 result_color;
     uint16_t result;
-    result = (rgbData.red  & 0xFF) / 5 << 11;
-    result |= (rgbData.green & 0xFF) / 6 << 5;
-    result |= (rgbData.blue & 0xFF) / 5;
+    result = colorTable5[rgbColor.red] << 11;
+    result |= colorTable6[rgbColor.green] << 5;
+    result |= colorTable5[rgbColor.blue];
     result_color.upperByte = (result >> 8) & 0xFF;
     result_color.lowerByte = result & 0xFF;
     return result_color;
@@ -317,6 +618,34 @@ static void writeOLED_dataRegister(uint8_t data) {
         System_printf("Unsuccessful SPI transfer");
     }
 }
+/*!
+ * \brief send a block of data to the DDRAM with a single chip select, split into driver sized transfers
+ * \param data bytes in transfer order
+ * \param count amount of bytes
+ */
+static void writeOLED_dataBurst(const void *data, uint16_t count) {
+    const uint8_t *bytes = (const uint8_t *) data;
+    SPI_Transaction spiTransaction;
+    spiTransaction.rxBuf = NULL;
+    SETBIT(OLED_CS, 0);
+    SETBIT(OLED_DC, 1);
+    while (count > 0) {
+        spiTransaction.count = count > OLED_BURST_SIZE ? OLED_BURST_SIZE : count;
+        spiTransaction.txBuf = (void *) bytes;
+        if (!SPI_transfer(handle, &spiTransaction)) {
+            System_printf("Unsuccessful SPI transfer");
+        }
+        bytes += spiTransaction.count;
+        count -= spiTransaction.count;
+    }
+    SETBIT(OLED_CS, 1);
+}
+/*!
+ * \brief a color as one 16 bit value, stored in memory it is sent upper byte first
+ */
+static uint16_t wireColor(color16 color) {
+    return color.upperByte | (color.lowerByte << 8);
+}
 static void writeOLED_indexRegister(uint8_t reg) {
     uint8_t transmitBuf[1], ret;
     transmitBuf[0] = reg;
@@ -351,21 +680,21 @@ static void commandSPI(uint8_t reg, uint8_t value) {
  * all necessary initial parameters are written to the corresponding register
  */
 void OLED_power_on(void) {
-    // wait for 100ms
-    wait_ms(100);
+    // wait for 100ms, the delays sleep the task, the other tasks keep running
+    Task_sleep(100);
     // Set RST to LOW
     SETBIT(OLED_RST, 0);
-    wait_ms(10); // wait 10 ms
+    Task_sleep(10); // wait 10 ms
     // Set RST to HIGH
     SETBIT(OLED_RST, 1);
-    wait_ms(10); // wait 10 ms
+    Task_sleep(10); // wait 10 ms
     /* soft Reset */
     commandSPI(OLED_SOFT_RESET, 0x00);
     /* Standby ON/OFF */
     commandSPI(OLED_STANDBY_ON_OFF, 0x01);  // Standby ON
-    wait_ms(5);           // wait 5 ms
+    Task_sleep(5);           // wait 5 ms
     commandSPI(OLED_STANDBY_ON_OFF, 0x00);  // Standby OFF
-    wait_ms(5);           // wait 5 ms
+    Task_sleep(5);           // wait 5 ms
     /* Set Oscillator operation */
     commandSPI(OLED_ANALOG_CONTROL,0x00);          // using external resistor and internal OSC
     /* Set frame rate */
@@ -390,9 +719,7 @@ void OLED_power_on(void) {
     /* Set row scan mode */
     commandSPI(OLED_ROW_SCAN_MODE,0x00);          // Alternate scan mode
     /* Set column current */
-    commandSPI(OLED_COLUMN_CURRENT_R,0x6E);
-    commandSPI(OLED_COLUMN_CURRENT_G,0x4F);
-    commandSPI(OLED_COLUMN_CURRENT_B,0x77);
+    OLED_setBrightness(100);
     /* Set row overlap */
     commandSPI(OLED_ROW_OVERLAP,0x00);            // Band gap only
     /* Set discharge time */
@@ -0,0 +1,299 @@
+/*! \file oled_widget.c
+ *  \brief retained mode widgets for the OLED 96x96, drawn by a single compositor pass
+ *  The widgets only keep their content, nothing is drawn by the setters. widget_render draws
+ *  the dirty widgets of a screen, text widgets only the glyph cells that changed.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/oled_widget.h"
+
+//! \addtogroup group_oled_app
+//! @{
+// ---------------------------------------------------------------------------- functions ---
+static void initWidget(widget *w, uint8_t type, rect bounds, color16 color, color16 background);
+static void renderText(widget *w);
+static void renderIcon(widget *w);
+static void renderSparkline(widget *w);
+static uint8_t sparklineY(const widget *w, uint8_t value, uint8_t low, uint8_t high);
+
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief a text in one font
+ * \param w the widget to initialize
+ * \param origin upper left corner
+ * \param font font of the text
+ * \param length glyph cells of the box, at most WIDGET_TEXT_LENGTH
+ * \param color color of the text
+ * \param background color of the box
+ */
+void widget_label(widget *w, point origin, const fontContainer *font, uint8_t length,
+                  color16 color, color16 background) {
+    rect bounds = {origin, 0, font->fontHeight};
+    if (length > WIDGET_TEXT_LENGTH) {
+        length = WIDGET_TEXT_LENGTH;
+    }
+    bounds.width = length * font->fontSpacing;
+    initWidget(w, WIDGET_LABEL, bounds, color, background);
+    w->content.text.font = font;
+    w->content.text.length = length;
+}
+/*!
+ * \brief an unsigned number with a fixed amount of digits, leading zeros included
+ * \param digits digits of the number, at most WIDGET_TEXT_LENGTH
+ */
+void widget_readout(widget *w, point origin, const fontContainer *font, uint8_t digits,
+                    color16 color, color16 background) {
+    widget_label(w, origin, font, digits, color, background);
+    w->type = WIDGET_READOUT;
+    w->content.text.digits = w->content.text.length;
+}
+/*!
+ * \brief an image or a part of it, the box is the size of the first image
+ * \param sprite image to show, NULL for an empty box
+ * \param key transparency key, see drawImage
+ */
+void widget_icon(widget *w, point origin, const image *sprite, int32_t key, color16 background) {
+    rect bounds = {origin, 0, 0};
+    if (sprite != NULL) {
+        bounds.width = sprite->width;
+        bounds.height = sprite->height;
+    }
+    initWidget(w, WIDGET_ICON, bounds, background, background);
+    w->content.icon.sprite = sprite;
+    w->content.icon.key = key;
+}
+/*!
+ * \brief the latest values as a line, newest on the right, scaled to the lowest and highest value
+ * \param bounds box of the line, one value per column, a box without columns keeps and draws nothing
+ */
+void widget_sparkline(widget *w, rect bounds, color16 color, color16 background) {
+    if (bounds.width > WIDGET_SPARKLINE_SIZE) {
+        bounds.width = WIDGET_SPARKLINE_SIZE;
+    }
+    initWidget(w, WIDGET_SPARKLINE, bounds, color, background);
+    w->content.sparkline.size = bounds.width;
+}
+
+/*!
+ * \brief change the text of a label, the widget only gets dirty if the text differs
+ * \param text 0 terminated, cut to the length of the label
+ */
+void widget_setText(widget *w, const char *text) {
+    char *current = w->content.text.text;
+    if (strncmp(current, text, w->content.text.length) == 0) {
+        return;
+    }
+    strncpy(current, text, w->content.text.length);
+    current[w->content.text.length] = 0;
+    w->dirty = true;
+}
+/*!
+ * \brief change the number of a readout, values too large for the digits show all nines
+ */
+void widget_setValue(widget *w, uint16_t value) {
+    char text[WIDGET_TEXT_LENGTH + 1];
+    uint8_t digits = w->content.text.digits;
+    uint8_t i;
+    uint32_t limit = 1;
+
+    for (i = 0; i < digits; i++) {
+        limit *= 10;
+    }
+    if (value >= limit) {
+        value = limit - 1;
+    }
+    text[digits] = 0;
+    for (i = digits; i > 0; i--) {
+        text[i - 1] = '0' + value % 10;
+        value /= 10;
+    }
+    widget_setText(w, text);
+}
+/*!
+ * \brief show another image in the box of an icon, e.g. the next frame of an animation
+ */
+void widget_setIcon(widget *w, const image *sprite) {
+    if (w->content.icon.sprite != sprite) {
+        w->content.icon.sprite = sprite;
+        w->dirty = true;
+    }
+}
+/*!
+ * \brief append a value to a sparkline, the oldest one drops out if the box is full
+ * \param value the value, 0 is a gap in the line
+ */
+void widget_pushValue(widget *w, uint8_t value) {
+    if (w->content.sparkline.size == 0) {
+        return;
+    }
+    w->content.sparkline.values[w->content.sparkline.next] = value;
+    w->content.sparkline.next = (w->content.sparkline.next + 1) % w->content.sparkline.size;
+    if (w->content.sparkline.count < w->content.sparkline.size) {
+        w->content.sparkline.count++;
+    }
+    w->dirty = true;
+}
+
+/*!
+ * \brief mark all widgets of a screen to be drawn completely with the next render
+ * \param widgets the widgets of the screen
+ * \param count amount of widgets
+ * \param cleared the screen was filled with the background, empty glyph cells need no drawing
+ */
+void widget_invalidate(widget *widgets, uint8_t count, bool cleared) {
+    uint8_t i;
+    for (i = 0; i < count; i++) {
+        widgets[i].dirty = true;
+        widgets[i].redraw = true;
+        if (cleared && (widgets[i].type == WIDGET_LABEL || widgets[i].type == WIDGET_READOUT)) {
+            memset(widgets[i].content.text.shown, 0, sizeof(widgets[i].content.text.shown));
+            widgets[i].redraw = false;
+        }
+    }
+}
+/*!
+ * \brief compositor pass, draws the dirty widgets of a screen
+ * \param widgets the widgets of the screen, drawn in order, later ones on top
+ * \param count amount of widgets
+ * \return amount of widgets drawn
+ */
+uint8_t widget_render(widget *widgets, uint8_t count) {
+    uint8_t drawn = 0;
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+        widget *w = &widgets[i];
+        if (!w->dirty) {
+            continue;
+        }
+        switch (w->type) {
+            case WIDGET_LABEL:
+            case WIDGET_READOUT:
+                renderText(w);
+                break;
+            case WIDGET_ICON:
+                renderIcon(w);
+                break;
+            case WIDGET_SPARKLINE:
+                renderSparkline(w);
+                break;
+        }
+        w->dirty = false;
+        w->redraw = false;
+        drawn++;
+    }
+    return drawn;
+}
+
+static void initWidget(widget *w, uint8_t type, rect bounds, color16 color, color16 background) {
+    memset(w, 0, sizeof(*w));
+    w->type = type;
+    w->bounds = bounds;
+    w->color = color;
+    w->background = background;
+    // nothing is known about the display yet
+    w->dirty = true;
+    w->redraw = true;
+}
+/*!
+ * \brief draw the glyph cells that differ from the text on the display
+ */
+static void renderText(widget *w) {
+    const fontContainer *font = w->content.text.font;
+    char *text = w->content.text.text;
+    char *shown = w->content.text.shown;
+    bool ended = false;
+    point origin;
+    rect cell;
+    uint8_t i;
+    char c;
+
+    for (i = 0; i < w->content.text.length; i++) {
+        ended = ended || text[i] == 0;
+        c = ended ? 0 : text[i];
+        if (!w->redraw && c == shown[i]) {
+            continue;
+        }
+        // the origin of drawChar is the upper right corner of the glyph
+        origin.x = w->bounds.origin.x + i * font->fontSpacing + font->fontWidth;
+        origin.y = w->bounds.origin.y;
+        if (c != 0) {
+            drawChar(c, font, w->color, w->background, origin);
+        } else {
+            cell.origin.x = origin.x - font->fontWidth;
+            cell.origin.y = origin.y;
+            cell.width = font->fontWidth + 1;
+            cell.height = font->fontHeight;
+            fillRect(cell, w->background);
+        }
+        shown[i] = c;
+    }
+}
+static void renderIcon(widget *w) {
+    const image *sprite = w->content.icon.sprite;
+    rect part = {{0, 0}, w->bounds.width, w->bounds.height};
+
+    // transparent or smaller images do not cover the whole box
+    if (sprite == NULL || w->content.icon.key != IMAGE_NO_KEY
+            || sprite->width < w->bounds.width || sprite->height < w->bounds.height) {
+        fillRect(w->bounds, w->background);
+    }
+    if (sprite != NULL) {
+        drawImage(sprite, &part, w->bounds.origin, w->content.icon.key);
+    }
+}
+/*!
+ * \brief clear the box and draw a line through the values, gaps are left out
+ */
+static void renderSparkline(widget *w) {
+    const uint8_t *values = w->content.sparkline.values;
+    uint8_t size = w->content.sparkline.size;
+    uint8_t count = w->content.sparkline.count;
+    uint8_t first;
+    uint8_t low = UINT8_MAX;
+    uint8_t high = 0;
+    uint8_t i, value, previous;
+    point from, to;
+
+    if (size == 0) {
+        return;
+    }
+    first = (w->content.sparkline.next + size - count) % size;
+    fillRect(w->bounds, w->background);
+    for (i = 0; i < count; i++) {
+        value = values[(first + i) % size];
+        if (value == 0) {
+            continue;
+        }
+        if (value < low) {
+            low = value;
+        }
+        if (value > high) {
+            high = value;
+        }
+    }
+    for (i = 1; i < count; i++) {
+        previous = values[(first + i - 1) % size];
+        value = values[(first + i) % size];
+        if (previous == 0 || value == 0) {
+            continue;
+        }
+        from.x = w->bounds.origin.x + size - count + i - 1;
+        from.y = sparklineY(w, previous, low, high);
+        to.x = from.x + 1;
+        to.y = sparklineY(w, value, low, high);
+        drawLine(from, to, w->color);
+    }
+}
+/*!
+ * \brief row of a value in the box, the highest value at the top
+ */
+static uint8_t sparklineY(const widget *w, uint8_t value, uint8_t low, uint8_t high) {
+    uint8_t bottom = w->bounds.origin.y + w->bounds.height - 1;
+    if (high == low) {
+        return w->bounds.origin.y + w->bounds.height / 2;
+    }
+    return bottom - (uint16_t) (value - low) * (w->bounds.height - 1) / (high - low);
+}
+// End Doxygen group
+//! @}
@@ -0,0 +1,85 @@
+/*!
+ * \file power.c
+ * \brief power manager, tracks the user activity and sleeps the CPU in the idle loop
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/power.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ globals ---
+//! \brief Clock tick of the last keystroke, the boot counts as one
+static volatile uint32_t lastActivity;
+// statistics
+static uint32_t activities;
+static volatile uint32_t sleeps;
+
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief a keystroke or any other user input, restarts the dimming timeouts
+ * \return true if the display was dimmed or dark, the OLED task has to be woken up
+ */
+bool power_activity(void)
+{
+    bool wake = power_displayLevel(NULL) != POWER_DISPLAY_FULL;
+
+    lastActivity = Clock_getTicks();
+    activities++;
+    return wake;
+}
+
+/*!
+ * \brief brightness of the display for the current idle time
+ * \param remaining if not NULL, Clock ticks until the level changes, BIOS_WAIT_FOREVER if it never does
+ * \return the level
+ */
+powerDisplayLevel power_displayLevel(uint32_t *remaining)
+{
+    uint32_t idle = Clock_getTicks() - lastActivity;
+    uint32_t left;
+    powerDisplayLevel level;
+
+    if (idle < POWER_DIM_TIME)
+    {
+        level = POWER_DISPLAY_FULL;
+        left = POWER_DIM_TIME - idle;
+    }
+    else if (idle < POWER_BLANK_TIME)
+    {
+        level = POWER_DISPLAY_DIM;
+        left = POWER_BLANK_TIME - idle;
+    }
+    else
+    {
+        level = POWER_DISPLAY_BLANK;
+        left = BIOS_WAIT_FOREVER;
+    }
+    if (remaining != NULL)
+        *remaining = left;
+    return level;
+}
+
+/*!
+ * \brief idle function (application.cfg), sleeps the CPU until the next interrupt
+ * The peripherals keep their clocks in sleep mode, the acquisition goes on meanwhile.
+ */
+void power_idle(void)
+{
+    sleeps++;
+    SysCtlSleep();
+}
+
+/*!
+ * \brief print the keystrokes and how often the CPU went to sleep
+ */
+void power_printStatistics(void)
+{
+    static const char *const levels[] = {"full", "dimmed", "dark"};
+
+    System_printf("Power: %u keystrokes, %u sleeps, display %s\n", activities, sleeps, levels[power_displayLevel(NULL)]);
+    System_flush();
+}
+// End Doxygen group
+//! @}
@@ -0,0 +1,179 @@
+/*!
+ * \file queue.c
+ * \brief bounded message queues with a policy for a full queue, see queue.h
+ * Producers post from tasks and Swis, a policy other than QUEUE_BLOCK never waits. The counters
+ * are statistics only, a lost increment between two producers does not matter.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/queue.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ globals ---
+//! \brief all queues in the order of their creation, the index of COMMAND_GET_QUEUE
+static queue *queues[QUEUE_MAX];
+static uint8_t queueCount;
+//! \brief names of the policies for the statistics
+static const char *const policyNames[QUEUE_POLICIES] = {"block", "drop oldest", "drop newest", "coalesce"};
+// ---------------------------------------------------------------------------- functions ---
+static bool makeRoom(queue *q);
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief create a queue, during the setup only
+ * \param q state of the queue, kept by the caller
+ * \param name shown in the statistics
+ * \param size size of a message, at most QUEUE_MESSAGE_SIZE
+ * \param depth messages the queue holds
+ * \param policy what a full queue does with the next message
+ * \param mayWait whether the producers may wait for room: all of them are tasks and the consumer
+ * never waits for them. QUEUE_BLOCK is refused otherwise, at the creation and at runtime
+ * \param event posted with eventId for every message, the consumer may wait on it together with others
+ */
+void queue_create(queue *q, const char *name, uint16_t size, uint8_t depth, queuePolicy policy,
+                  bool mayWait, Event_Handle event, unsigned int eventId)
+{
+    Mailbox_Params params;
+    Error_Block eb;
+
+    if (queueCount == QUEUE_MAX)
+        System_abort("Queues exhausted");
+    if (size > QUEUE_MESSAGE_SIZE || (policy == QUEUE_BLOCK && !mayWait))
+        System_abort("Queue configuration invalid");
+    Error_init(&eb);
+    Mailbox_Params_init(&params);
+    params.readerEvent = event;
+    params.readerEventId = eventId;
+    q->mailbox = Mailbox_create(size, depth, &params, &eb);
+    if (q->mailbox == NULL)
+        System_abort("Queue create failed");
+    q->name = name;
+    q->depth = depth;
+    q->mayWait = mayWait;
+    q->policy = policy;
+    q->discard = NULL;
+    q->posted = 0;
+    q->dropped = 0;
+    q->waited = 0;
+    q->highWater = 0;
+    queues[queueCount++] = q;
+}
+
+/*!
+ * \brief post a message, a full queue handles it by its policy
+ * \return false if the message was dropped, QUEUE_DROP_NEWEST only
+ */
+bool queue_post(queue *q, const void *message)
+{
+    uint8_t pending;
+
+    switch (q->policy)
+    {
+    case QUEUE_BLOCK:
+        if (!Mailbox_post(q->mailbox, (void *) message, BIOS_NO_WAIT))
+        {
+            q->waited++;
+            Mailbox_post(q->mailbox, (void *) message, BIOS_WAIT_FOREVER);
+        }
+        break;
+    case QUEUE_DROP_NEWEST:
+        if (!Mailbox_post(q->mailbox, (void *) message, BIOS_NO_WAIT))
+        {
+            q->dropped++;
+            return false;
+        }
+        break;
+    case QUEUE_COALESCE_LATEST:
+        // the waiting messages are outdated by this one
+        while (makeRoom(q))
+            ;
+        // another producer may have taken the room again
+        while (!Mailbox_post(q->mailbox, (void *) message, BIOS_NO_WAIT))
+            makeRoom(q);
+        break;
+    case QUEUE_DROP_OLDEST:
+    default:
+        // the consumer may take the oldest itself meanwhile, then there is room anyway
+        while (!Mailbox_post(q->mailbox, (void *) message, BIOS_NO_WAIT))
+            makeRoom(q);
+        break;
+    }
+    q->posted++;
+    pending = Mailbox_getNumPendingMsgs(q->mailbox);
+    if (pending > q->highWater)
+        q->highWater = pending;
+    return true;
+}
+
+/*!
+ * \brief take the oldest message, never blocks, the consumer waits on the event of the queue
+ * \return false if the queue is empty
+ */
+bool queue_take(queue *q, void *message)
+{
+    return Mailbox_pend(q->mailbox, message, BIOS_NO_WAIT);
+}
+
+/*!
+ * \brief change the policy at runtime, the counters start over to measure the new one alone
+ * \return false if it would block a producer that must not wait
+ */
+bool queue_setPolicy(queue *q, queuePolicy policy)
+{
+    if (policy >= QUEUE_POLICIES || (policy == QUEUE_BLOCK && !q->mayWait))
+        return false;
+    q->policy = policy;
+    q->posted = 0;
+    q->dropped = 0;
+    q->waited = 0;
+    q->highWater = 0;
+    return true;
+}
+
+/*!
+ * \brief a queue by the order of its creation, as numbered by '#5'
+ * \return NULL past the last one
+ */
+queue *queue_get(uint8_t index)
+{
+    return index < queueCount ? queues[index] : NULL;
+}
+
+/*!
+ * \brief messages waiting right now
+ */
+uint8_t queue_pending(queue *q)
+{
+    return Mailbox_getNumPendingMsgs(q->mailbox);
+}
+
+void queue_printStatistics(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < queueCount; i++)
+        System_printf("Queue %u %s: %s, %u of %u deep at most, %u posted %u dropped %u waited\n", i,
+                      queues[i]->name, policyNames[queues[i]->policy], queues[i]->highWater, queues[i]->depth,
+                      queues[i]->posted, queues[i]->dropped, queues[i]->waited);
+    System_flush();
+}
+
+/*!
+ * \brief drop the oldest waiting message, its owner may release what it refers to
+ * \return false if the queue was empty
+ */
+static bool makeRoom(queue *q)
+{
+    uint32_t discarded[QUEUE_MESSAGE_SIZE / sizeof(uint32_t)];
+
+    if (!Mailbox_pend(q->mailbox, discarded, BIOS_NO_WAIT))
+        return false;
+    q->dropped++;
+    if (q->discard != NULL)
+        q->discard(discarded);
+    return true;
+}
+
+// End Doxygen group
+//! @}
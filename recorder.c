@@ -0,0 +1,366 @@
+/*!
+ * \file recorder.c
+ * \brief session recorder, raw samples and heart rates go to a file on the SD card
+ * Two blocks of one sector each: producers (heartrate tasks and estimators) append records to
+ * the fill block with interrupts disabled for a few bytes only, a full block is handed over to
+ * the recorder task which writes it while the producers continue in the other block. If the
+ * card is still busy when the second block is full, records are dropped and counted instead
+ * of stalling the acquisition. A block that does not fill up within RECORDER_FLUSH_PERIOD is
+ * written partially filled, that bounds what gets lost on power off.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/recorder.h"
+#include "local_inc/recorder_log.h"
+#include "local_inc/heartrate.h"
+#include "local_inc/boot.h"
+#include "local_inc/oled_hal.h"
+
+#include <ti/sysbios/hal/Hwi.h>
+#include <ti/drivers/SDSPI.h>
+#include <third_party/fatfs/ff.h>
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief the SD card is on SSI3, Board_initSDSPI1 configures it. SDSPI0 is the SSI2 of the OLED
+#if !SSIM_2 || SSIM_3
+#error "The SD card needs SSI3, configure the OLED to SSI2 (SSIM_2)"
+#endif
+#define RECORDER_SDSPI Board_SDSPI1
+//! \brief FatFs drive number of the SD card
+#define RECORDER_DRIVE 0
+//! \brief ms after which a partially filled block gets written
+#define RECORDER_FLUSH_PERIOD 2000
+//! \brief written blocks between two syncs of the file system
+#define RECORDER_SYNC_BLOCKS 8
+//! \brief highest session file number, files are named HR0000.BIN ...
+#define RECORDER_MAX_SESSIONS 10000
+//! \brief sample rate of the sensors, stored in the session header
+#define RECORDER_SAMPLE_RATE 50
+// ------------------------------------------------------------------------------ globals ---
+//! \brief double buffer, producers fill one block while the task writes the other
+static recorderBlock blocks[2];
+//! \brief block the producers append to
+static uint8_t fillBlock;
+//! \brief block handed over to the task
+static uint8_t writeBlock;
+//! \brief the write block is waiting for the task
+static volatile bool writePending;
+//! \brief sequence number of the next block
+static uint32_t nextSequence;
+//! \brief producers only append while a session file is open
+static volatile bool recording;
+//! \brief requested state, the task opens and closes the session
+static volatile bool recordRequested;
+static Semaphore_Handle writeSem;
+static FIL sessionFile;
+static recorderDevice device;
+static char sessionName[16];
+// statistics
+static uint32_t blocksWritten;
+static uint32_t droppedRecords;
+static uint32_t writeErrors;
+//! \brief time the card needs for one block
+static latencyStats writeTime;
+// ---------------------------------------------------------------------------- functions ---
+static void Recorder_task(UArg arg0, UArg arg1);
+static bool startSession(void);
+static void stopSession(void);
+static bool handOver(void);
+static void writePendingBlock(void);
+static bool fileWrite(void *context, uint32_t sector, const void *data);
+static bool fileSync(void *context);
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief create the recorder task and initialize it with the necessary parameters.
+ * \param name xdc_String, identifying name of the task
+ * \param priority uint8_t initial priority of the task, below the acquisition so card latency never delays it
+ */
+extern void setup_Recorder_task(xdc_String name, uint8_t priority)
+{
+    Task_Params taskParams;
+    Task_Handle task;
+    Semaphore_Params semParams;
+    Error_Block eb;
+
+    Error_init(&eb);
+    Semaphore_Params_init(&semParams);
+    writeSem = Semaphore_create(0, &semParams, &eb);
+    if (writeSem == NULL)
+    {
+        System_abort("Recorder semaphore create failed");
+    }
+
+    Error_init(&eb);
+    Task_Params_init(&taskParams);
+    taskParams.instance->name = name;
+    taskParams.stackSize = 1024; /* stack in bytes */
+    taskParams.priority = priority; /* 0-15 (15 is highest priority on default -> see RTOS Task configuration) */
+
+    task = Task_create((Task_FuncPtr) Recorder_task, &taskParams, &eb);
+    if (task == NULL)
+    {
+        System_abort("Recordertask create failed");
+    }
+}
+
+/*!
+ * \brief start a new session or stop the running one, done by the recorder task
+ */
+void recorder_toggle(void)
+{
+    recordRequested = !recordRequested;
+    Semaphore_post(writeSem);
+}
+
+/*!
+ * \brief start a new session or stop the running one, nothing changes if it is already so
+ */
+void recorder_setRecording(bool record)
+{
+    if (recordRequested == record)
+        return;
+    recordRequested = record;
+    Semaphore_post(writeSem);
+}
+
+bool recorder_isRecording(void)
+{
+    return recording;
+}
+
+/*!
+ * \brief record the samples of one FIFO read, never blocks
+ * \param time time of the newest sample in us
+ * \param values samples, oldest first
+ */
+void recorder_addSamples(uint8_t sensor, timestamp_t time, const uint16_t *values, uint8_t count)
+{
+    bool handedOver = false;
+    unsigned int key;
+
+    if (!recording)
+        return;
+
+    key = Hwi_disable();
+    if (!recorderLog_addSamples(&blocks[fillBlock], sensor, time, values, count))
+    {
+        handedOver = handOver();
+        if (!handedOver || !recorderLog_addSamples(&blocks[fillBlock], sensor, time, values, count))
+            droppedRecords++;
+    }
+    Hwi_restore(key);
+
+    if (handedOver)
+        Semaphore_post(writeSem);
+}
+
+/*!
+ * \brief record an estimated heart rate, never blocks
+ */
+void recorder_addBpm(uint8_t sensor, timestamp_t time, uint8_t bpm)
+{
+    bool handedOver = false;
+    unsigned int key;
+
+    if (!recording)
+        return;
+
+    key = Hwi_disable();
+    if (!recorderLog_addBpm(&blocks[fillBlock], sensor, time, bpm))
+    {
+        handedOver = handOver();
+        if (!handedOver || !recorderLog_addBpm(&blocks[fillBlock], sensor, time, bpm))
+            droppedRecords++;
+    }
+    Hwi_restore(key);
+
+    if (handedOver)
+        Semaphore_post(writeSem);
+}
+
+/*!
+ * \brief print the state of the recorder and the card timing
+ */
+void recorder_printStatistics(void)
+{
+    System_printf("Recorder %s %s: blocks %u, dropped records %u, write errors %u\n",
+                  recording ? "on" : "off", sessionName, blocksWritten, droppedRecords, writeErrors);
+    System_printf("  block write [us]: min %u, max %u, avg %u\n",
+                  writeTime.min, writeTime.max, latency_average(&writeTime));
+    System_flush();
+}
+
+/*!
+ * \brief mounts the card and writes the handed over blocks, flushes partially filled blocks
+ */
+static void Recorder_task(UArg arg0, UArg arg1)
+{
+    SDSPI_Params sdParams;
+    SDSPI_Handle sdHandle;
+    bool posted;
+    unsigned int key;
+
+    device.context = &sessionFile;
+    device.write = fileWrite;
+    device.sync = fileSync;
+    latency_reset(&writeTime);
+
+    // nothing to record before the sensors run, mounting the card meanwhile only takes time from them
+    boot_wait(BOOT_SENSORS, BIOS_WAIT_FOREVER);
+    SDSPI_Params_init(&sdParams);
+    sdHandle = SDSPI_open(RECORDER_SDSPI, RECORDER_DRIVE, &sdParams);
+    if (sdHandle == NULL)
+    {
+        System_printf("SD card not available, recorder disabled\n");
+        System_flush();
+        return;
+    }
+
+    while (1)
+    {
+        posted = Semaphore_pend(writeSem, RECORDER_FLUSH_PERIOD);
+
+        if (recordRequested && !recording)
+        {
+            if (!startSession())
+                recordRequested = false;
+            continue;
+        }
+        if (!recording)
+            continue;
+
+        // nothing got full for a while, write what is there
+        if (!posted || !recordRequested)
+        {
+            key = Hwi_disable();
+            handOver();
+            Hwi_restore(key);
+        }
+        writePendingBlock();
+
+        if (!recordRequested)
+            stopSession();
+    }
+}
+
+/*!
+ * \brief open a new session file and write its header
+ */
+static bool startSession(void)
+{
+    recorderSession session;
+    uint16_t number;
+    FRESULT result = FR_EXIST;
+
+    for (number = 0; number < RECORDER_MAX_SESSIONS && result == FR_EXIST; number++)
+    {
+        System_sprintf(sessionName, "%u:HR%04u.BIN", RECORDER_DRIVE, number);
+        result = f_open(&sessionFile, sessionName, FA_CREATE_NEW | FA_WRITE);
+    }
+    if (result != FR_OK)
+    {
+        System_printf("Recorder can not create a session file (%d)\n", result);
+        System_flush();
+        return false;
+    }
+
+    recorderLog_session(&session, RECORDER_SAMPLE_RATE, HEARTRATE_SENSOR_COUNT, timestamp_now());
+    if (!recorderLog_writeSession(&device, &session))
+    {
+        f_close(&sessionFile);
+        System_printf("Recorder can not write %s\n", sessionName);
+        System_flush();
+        return false;
+    }
+
+    nextSequence = 0;
+    fillBlock = 0;
+    writePending = false;
+    recorderLog_beginBlock(&blocks[fillBlock], nextSequence++);
+    recording = true;
+
+    System_printf("Recording to %s\n", sessionName);
+    System_flush();
+    return true;
+}
+
+/*!
+ * \brief stop the producers and close the session, the remaining block has been written before
+ */
+static void stopSession(void)
+{
+    unsigned int key;
+
+    key = Hwi_disable();
+    recording = false;
+    handOver();
+    Hwi_restore(key);
+    writePendingBlock();
+
+    f_close(&sessionFile);
+    System_printf("Recording stopped, %u blocks\n", blocksWritten);
+    System_flush();
+}
+
+/*!
+ * \brief pass the fill block to the task and start a new one, called with interrupts disabled
+ * \return false if the task still writes the other block or there is nothing to pass
+ */
+static bool handOver(void)
+{
+    if (writePending || blocks[fillBlock].used == 0)
+        return false;
+
+    writeBlock = fillBlock;
+    fillBlock ^= 1;
+    recorderLog_beginBlock(&blocks[fillBlock], nextSequence++);
+    writePending = true;
+    return true;
+}
+
+/*!
+ * \brief write the handed over block, the producers do not touch it until writePending is cleared
+ */
+static void writePendingBlock(void)
+{
+    recorderBlock *block = &blocks[writeBlock];
+    timestamp_t start;
+
+    if (!writePending)
+        return;
+
+    recorderLog_seal(block);
+    start = timestamp_now();
+    if (recorderLog_writeBlock(&device, block))
+        blocksWritten++;
+    else
+        writeErrors++;
+    if (blocksWritten % RECORDER_SYNC_BLOCKS == 0 && !device.sync(device.context))
+        writeErrors++;
+    latency_record(&writeTime, start);
+
+    writePending = false;
+}
+
+/*!
+ * \brief recorderDevice on a FatFs file, sectors are placed at their offset in the file
+ */
+static bool fileWrite(void *context, uint32_t sector, const void *data)
+{
+    FIL *file = (FIL *) context;
+    UINT written;
+
+    if (f_lseek(file, sector * RECORDER_SECTOR_SIZE) != FR_OK)
+        return false;
+    return f_write(file, data, RECORDER_SECTOR_SIZE, &written) == FR_OK && written == RECORDER_SECTOR_SIZE;
+}
+
+static bool fileSync(void *context)
+{
+    return f_sync((FIL *) context) == FR_OK;
+}
+// End Doxygen group
+//! @}
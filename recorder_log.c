@@ -0,0 +1,186 @@
+/*!
+ * \file recorder_log.c
+ * \brief builds session header and blocks of the recording format, see recorder_log.h
+ * Only the C standard library is used. Headers and records are serialized byte by byte, so the
+ * layout does not depend on alignment or endianness of the machine.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include <string.h>
+#include "local_inc/recorder_log.h"
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief records of a block, behind its header
+#define PAYLOAD(block) (&(block)->sector[RECORDER_BLOCK_HEADER_SIZE])
+// ---------------------------------------------------------------------------- functions ---
+static bool addRecord(recorderBlock *block, uint8_t type, uint8_t sensor, uint8_t value, timestamp_t time, uint16_t size);
+static uint16_t crc16(const uint8_t *data, uint16_t length);
+static uint8_t *put16(uint8_t *data, uint16_t value);
+static uint8_t *put32(uint8_t *data, uint32_t value);
+static uint8_t *put64(uint8_t *data, uint64_t value);
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief fill the session header
+ * \param sampleRate samples per second of the sensors
+ * \param sensorCount amount of sensors
+ * \param startTime time of the session start in us
+ */
+void recorderLog_session(recorderSession *session, uint16_t sampleRate, uint8_t sensorCount, timestamp_t startTime)
+{
+    uint8_t *data = session->sector;
+
+    memset(session->sector, 0, RECORDER_SECTOR_SIZE);
+    data = put32(data, RECORDER_SESSION_MAGIC);
+    data = put16(data, RECORDER_FORMAT_VERSION);
+    data = put16(data, RECORDER_SECTOR_SIZE);
+    data = put16(data, sampleRate);
+    *data = sensorCount;
+    // 5 reserved bytes
+    put64(data + 6, startTime);
+}
+
+/*!
+ * \brief start an empty block, the base time is taken from the first record
+ * \param sequence block number within the session
+ */
+void recorderLog_beginBlock(recorderBlock *block, uint32_t sequence)
+{
+    block->sequence = sequence;
+    block->baseTime = 0;
+    block->used = 0;
+}
+
+/*!
+ * \brief append the samples of one FIFO read
+ * \param time time of the newest (last) sample in us
+ * \param values samples, oldest first
+ * \param count amount of samples
+ * \return false if the block has no room left, the block is unchanged then
+ */
+bool recorderLog_addSamples(recorderBlock *block, uint8_t sensor, timestamp_t time, const uint16_t *values, uint8_t count)
+{
+    uint8_t *data;
+    uint8_t i;
+
+    if (!addRecord(block, RECORDER_RECORD_SAMPLES, sensor, count, time, RECORDER_RECORD_HEADER_SIZE + 2 * count))
+        return false;
+
+    data = &PAYLOAD(block)[block->used - 2 * count];
+    for (i = 0; i < count; i++)
+    {
+        *data++ = (uint8_t) values[i];
+        *data++ = (uint8_t) (values[i] >> 8);
+    }
+    return true;
+}
+
+/*!
+ * \brief append an estimated heart rate
+ * \param time time of the estimate in us
+ * \return false if the block has no room left, the block is unchanged then
+ */
+bool recorderLog_addBpm(recorderBlock *block, uint8_t sensor, timestamp_t time, uint8_t bpm)
+{
+    return addRecord(block, RECORDER_RECORD_BPM, sensor, bpm, time, RECORDER_RECORD_HEADER_SIZE);
+}
+
+/*!
+ * \brief finish a block before writing, clears the unused payload and fills in the header
+ */
+void recorderLog_seal(recorderBlock *block)
+{
+    uint8_t *data = block->sector;
+
+    memset(&PAYLOAD(block)[block->used], 0, RECORDER_PAYLOAD_SIZE - block->used);
+    data = put32(data, RECORDER_BLOCK_MAGIC);
+    data = put32(data, block->sequence);
+    data = put64(data, block->baseTime);
+    data = put16(data, block->used);
+    put16(data, crc16(PAYLOAD(block), block->used));
+}
+
+bool recorderLog_writeSession(const recorderDevice *device, const recorderSession *session)
+{
+    return device->write(device->context, 0, session->sector) && device->sync(device->context);
+}
+
+/*!
+ * \brief store a sealed block in its sector, right behind the session header
+ */
+bool recorderLog_writeBlock(const recorderDevice *device, const recorderBlock *block)
+{
+    return device->write(device->context, block->sequence + 1, block->sector);
+}
+
+/*!
+ * \brief reserve and fill a record header
+ * \param size bytes of the whole record
+ */
+static bool addRecord(recorderBlock *block, uint8_t type, uint8_t sensor, uint8_t value, timestamp_t time, uint16_t size)
+{
+    uint8_t *data = &PAYLOAD(block)[block->used];
+    int64_t offset;
+
+    if (block->used + size > RECORDER_PAYLOAD_SIZE)
+        return false;
+    if (block->used == 0)
+        block->baseTime = time;
+
+    // records are close in time, a block that would need more than 32 bit is full
+    offset = (int64_t) (time - block->baseTime);
+    if (offset > INT32_MAX || offset < INT32_MIN)
+        return false;
+
+    data[0] = type;
+    data[1] = sensor;
+    data[2] = value;
+    data[3] = 0;
+    data[4] = (uint8_t) offset;
+    data[5] = (uint8_t) (offset >> 8);
+    data[6] = (uint8_t) (offset >> 16);
+    data[7] = (uint8_t) (offset >> 24);
+    block->used += size;
+    return true;
+}
+
+/*!
+ * \brief CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF)
+ */
+static uint16_t crc16(const uint8_t *data, uint16_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t bit;
+
+    while (length--)
+    {
+        crc ^= (uint16_t) (*data++) << 8;
+        for (bit = 0; bit < 8; bit++)
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+/*!
+ * \brief little endian values into a header
+ * \return position behind the value
+ */
+static uint8_t *put16(uint8_t *data, uint16_t value)
+{
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+    return data + 2;
+}
+
+static uint8_t *put32(uint8_t *data, uint32_t value)
+{
+    return put16(put16(data, (uint16_t) value), (uint16_t) (value >> 16));
+}
+
+static uint8_t *put64(uint8_t *data, uint64_t value)
+{
+    return put32(put32(data, (uint32_t) value), (uint32_t) (value >> 32));
+}
+// End Doxygen group
+//! @}
@@ -1,54 +1,140 @@
 /*! \file font.c
- * \brief initialization code for every font, all data are stored in the struct.
+ * \brief the three fonts with constant metrics and a glyph blitter specialized for each width.
+ * The glyphs are packed by tools/fontpack.py (see font_packed.h): only the used characters, and
+ * of each only the rows between the first and the last set pixel. Every blitter expands a whole
+ * row with straight line code, the empty rows around are filled with the background.
  *
  * \author Valentin Platzgummer - ic17b096
  * \date Jan 1, 2019
  */
 
 #include "font.h"
-#include "font_array.h"
+#include "font_packed.h"
 //! \addtogroup group_oled_res
 //! @{
+
+//! \brief expand the 8 bits of one glyph byte into 8 pixels, least significant bit first
+#define EXPAND_BYTE(pixels, bits, fg, bg) \
+    (pixels)[0] = ((bits) & 0x01) ? (fg) : (bg); \
+    (pixels)[1] = ((bits) & 0x02) ? (fg) : (bg); \
+    (pixels)[2] = ((bits) & 0x04) ? (fg) : (bg); \
+    (pixels)[3] = ((bits) & 0x08) ? (fg) : (bg); \
+    (pixels)[4] = ((bits) & 0x10) ? (fg) : (bg); \
+    (pixels)[5] = ((bits) & 0x20) ? (fg) : (bg); \
+    (pixels)[6] = ((bits) & 0x40) ? (fg) : (bg); \
+    (pixels)[7] = ((bits) & 0x80) ? (fg) : (bg)
+//! \brief amount of elements of a packed table
+#define COUNT_OF(table) (sizeof(table) / sizeof((table)[0]))
+
+static void expandGlyph8(const unsigned char *rows, uint8_t count, uint16_t foreground, uint16_t background,
+                         uint16_t *pixels);
+static void expandGlyph16(const unsigned char *rows, uint8_t count, uint16_t foreground, uint16_t background,
+                          uint16_t *pixels);
+static void expandGlyph24(const unsigned char *rows, uint8_t count, uint16_t foreground, uint16_t background,
+                          uint16_t *pixels);
+static const fontGlyph *findGlyph(const fontContainer *font, uint8_t c);
+static uint16_t *fillPixels(uint16_t *pixels, uint16_t count, uint16_t color);
+
+//! \brief Font Bitsize 1Byte 7x14, 7 effective font width, nominal 8
+const fontContainer fontSmall = {
+    7, FONT_SMALL_HEIGHT, 1, 10, 16,
+    COUNT_OF(fontSmallRanges), fontSmallRanges, fontSmallGlyphs, fontSmallBitmap, expandGlyph8
+};
+//! \brief Font Bitsize 2Byte 15x26, 15 effective font width, nominal 16
+const fontContainer fontMedium = {
+    15, FONT_MEDIUM_HEIGHT, 2, 16, 28,
+    COUNT_OF(fontMediumRanges), fontMediumRanges, fontMediumGlyphs, fontMediumBitmap, expandGlyph16
+};
+//! \brief Font Bitsize 3Byte 23x36, 23 effective font width, nominal 24
+const fontContainer fontLarge = {
+    23, FONT_LARGE_HEIGHT, 3, 25, 38,
+    COUNT_OF(fontLargeRanges), fontLargeRanges, fontLargeGlyphs, fontLargeBitmap, expandGlyph24
+};
+
 /*!
- * \brief initializes the fontContainer struct with all needed data for any given font
- * \param fc fontContainer, pointer to a fontContainer struct to be initialized
- * \param size unsigned char, size f the font, 1-3 in bit depth steps 8bit, 16bit and 24 bit.
+ * \brief select one of the fonts by size
+ * \param size unsigned char, size of the font, FONT_SMALL, FONT_MEDIUM or FONT_LARGE
+ * \return the constant font
  */
-void initializeFont(fontContainer *fc, uint8_t size) {
+const fontContainer *getFont(uint8_t size) {
     switch (size) {
-        // Font Bitsize 1Byte 7x14
-        case 0:
-            fc->fontDepthByte = 1;
-            fc->fontHeight = 14;
-            fc->fontWidth = 7;              // 7 effective font width, nominal 8
-            fc->fontSpacing = 10;
-            fc->fontHeading = 16;
-            fc->charArrayLength = 14;
-            fc->font = &font1[0];
-            break;
-            //Font Bitsize 12Byte 14x26
-        case 1:
-            fc->fontDepthByte = 2;
-            fc->fontHeight = 26;
-            fc->fontWidth = 15;             // 15 effective font width, nominal 16
-            fc->fontSpacing = 16;
-            fc->fontHeading = 28;
-            fc->charArrayLength = 52;
-            fc->font = &font2[0];
-            break;
-            // Font Bitsize 3Byte 24x36
-        case 2:
-            fc->fontDepthByte = 3;
-            fc->fontHeight = 36;
-            fc->fontWidth = 23;             // 23 effective font width, nominal 22
-            fc->fontSpacing = 25;
-            fc->fontHeading = 38;
-            fc->charArrayLength = 108;
-            fc->font = &font3[0];
-            break;
+        case FONT_SMALL:
+            return &fontSmall;
+        case FONT_MEDIUM:
+            return &fontMedium;
+        case FONT_LARGE:
+            return &fontLarge;
         default:
             System_abort("Illegal font size");
     }
+    return &fontSmall;
+}
+
+/*!
+ * \brief expand a character into the pixels of a whole glyph, characters that are not packed are blank
+ * \param font the font to draw with
+ * \param c the character
+ * \param foreground color of set bits in transfer byte order
+ * \param background color of cleared bits in transfer byte order
+ * \param pixels destination, (fontWidth + 1) * fontHeight pixels
+ */
+void expandChar(const fontContainer *font, char c, uint16_t foreground, uint16_t background, uint16_t *pixels) {
+    const fontGlyph *glyph = findGlyph(font, (uint8_t) c);
+    uint8_t rowPixels = font->fontDepthByte * 8;
+
+    if (glyph == NULL || glyph->rows == 0) {
+        fillPixels(pixels, font->fontHeight * rowPixels, background);
+        return;
+    }
+    pixels = fillPixels(pixels, glyph->top * rowPixels, background);
+    font->expandGlyph(&font->bitmap[glyph->offset], glyph->rows, foreground, background, pixels);
+    pixels += glyph->rows * rowPixels;
+    fillPixels(pixels, (font->fontHeight - glyph->top - glyph->rows) * rowPixels, background);
+}
+
+/*!
+ * \brief index entry of a character, there are only few ranges
+ * \return the glyph, NULL if the character is not packed
+ */
+static const fontGlyph *findGlyph(const fontContainer *font, uint8_t c) {
+    const fontRange *range;
+    for (range = font->ranges; range < font->ranges + font->rangeCount; range++) {
+        if (c >= range->first && c - range->first < range->count) {
+            return &font->glyphs[range->glyph + c - range->first];
+        }
+    }
+    return NULL;
+}
+
+static uint16_t *fillPixels(uint16_t *pixels, uint16_t count, uint16_t color) {
+    while (count--) {
+        *pixels++ = color;
+    }
+    return pixels;
+}
+
+static void expandGlyph8(const unsigned char *rows, uint8_t count, uint16_t foreground, uint16_t background,
+                         uint16_t *pixels) {
+    for (; count > 0; count--, rows++, pixels += 8) {
+        EXPAND_BYTE(pixels, rows[0], foreground, background);
+    }
+}
+
+static void expandGlyph16(const unsigned char *rows, uint8_t count, uint16_t foreground, uint16_t background,
+                          uint16_t *pixels) {
+    for (; count > 0; count--, rows += 2, pixels += 16) {
+        EXPAND_BYTE(pixels, rows[0], foreground, background);
+        EXPAND_BYTE(pixels + 8, rows[1], foreground, background);
+    }
+}
+
+static void expandGlyph24(const unsigned char *rows, uint8_t count, uint16_t foreground, uint16_t background,
+                          uint16_t *pixels) {
+    for (; count > 0; count--, rows += 3, pixels += 24) {
+        EXPAND_BYTE(pixels, rows[0], foreground, background);
+        EXPAND_BYTE(pixels + 8, rows[1], foreground, background);
+        EXPAND_BYTE(pixels + 16, rows[2], foreground, background);
+    }
 }
 // Close the Doxygen group.
 //! @}
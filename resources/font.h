@@ -12,18 +12,65 @@
 //! \addtogroup group_oled_res
 //! @{
 
+/*!
+ * \brief expands stored glyph rows into RGB565 pixels, ready to be sent to the display
+ * Rows from top to bottom, every row from the least significant bit on. The colors are given
+ * in transfer byte order, every pixel is a single 16 bit store.
+ * \param rows packed rows of the character
+ * \param count amount of rows
+ * \param foreground color of set bits
+ * \param background color of cleared bits
+ * \param pixels destination, (fontWidth + 1) pixels per row
+ */
+typedef void (*glyphExpander)(const unsigned char *rows, uint8_t count, uint16_t foreground, uint16_t background,
+                              uint16_t *pixels);
+
+//! \brief index entry of a packed glyph, only the rows between the first and last set pixel are stored
+typedef struct fontGlyph {
+    uint16_t offset;            //!< first stored row in the bitmap of the font
+    uint8_t top;                //!< empty rows above the stored rows
+    uint8_t rows;               //!< amount of stored rows, 0 for a blank glyph
+} fontGlyph;
+
+//! \brief consecutive character codes that are packed
+typedef struct fontRange {
+    uint8_t first;              //!< first character code of the range
+    uint8_t count;              //!< amount of characters, at most 255, fontpack.py splits longer ranges
+    uint16_t glyph;             //!< index of the first glyph of the range
+} fontRange;
+
 //! brief fontContainer struct contains all data for the used font
 typedef struct fontContainer {
-    uint8_t charArrayLength;    //!< array length array for each individual character
     uint8_t fontWidth;          //!< width of each individual characters
     uint8_t fontHeight;         //!< height of each individual characters
     uint8_t fontDepthByte;      //!< Bit depth of the characters in Bits 8, 16 or 24
     uint8_t fontSpacing;        //!< Character length plus spacing between two characters
     uint8_t fontHeading;        //!< Headroom + font height for the given font, total height
-    const unsigned char *font;        //!< Pointer to font array, font is given in 1dim char array, coded bitmap
+    uint8_t rangeCount;         //!< amount of packed character ranges
+    const fontRange *ranges;    //!< packed character ranges, generated by tools/fontpack.py
+    const fontGlyph *glyphs;    //!< index of the packed glyphs
+    const unsigned char *bitmap; //!< stored rows of all glyphs
+    glyphExpander expandGlyph;  //!< blitter specialized for the glyph width of this font
 } fontContainer;
 
-extern void initializeFont(fontContainer *fc, uint8_t size);
+//! \brief font sizes for getFont
+#define FONT_SMALL 0    //!< 7x14, 8 bit wide glyphs
+#define FONT_MEDIUM 1   //!< 15x26, 16 bit wide glyphs
+#define FONT_LARGE 2    //!< 23x36, 24 bit wide glyphs
+//! \brief amount of font sizes
+#define FONT_SIZES 3
+//! \brief glyph heights, the glyph width is the bit depth
+#define FONT_SMALL_HEIGHT 14
+#define FONT_MEDIUM_HEIGHT 26
+#define FONT_LARGE_HEIGHT 36
+//! \brief pixels of the largest glyph, size of the buffer expandGlyph writes to
+#define FONT_MAX_GLYPH_PIXELS (24 * FONT_LARGE_HEIGHT)
+
+extern const fontContainer fontSmall;
+extern const fontContainer fontMedium;
+extern const fontContainer fontLarge;
+extern const fontContainer *getFont(uint8_t size);
+extern void expandChar(const fontContainer *font, char c, uint16_t foreground, uint16_t background, uint16_t *pixels);
 #endif
 // Close the Doxygen group.
 //! @}
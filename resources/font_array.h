@@ -2,6 +2,7 @@
  *  \date Jan, 05 2019.
  *  \author Valentin Platzgummer ic17b096d
  *  \brief delaratation of the 3 used Fonts
+ *  Source of tools/fontpack.py, the firmware uses the packed glyphs in font_packed.h.
  */
 //
 
@@ -0,0 +1,617 @@
+/*! \file font_packed.h
+ * \brief packed glyphs of the three fonts, generated by tools/fontpack.py from font_array.h
+ * Do not edit, run tools/fontpack.py instead. Glyph ranges: 0x03,0x20-0x7E
+ */
+
+//! \addtogroup group_oled_res
+//! @{
+#ifndef FONT_PACKED_H_
+#define FONT_PACKED_H_
+#include "font.h"
+
+//! \brief fontSmall, 96 glyphs, 842 bytes of rows
+static const fontRange fontSmallRanges[] = {
+    {0x03, 1, 0},
+    {0x20, 95, 1},
+};
+static const fontGlyph fontSmallGlyphs[] = {
+    {0, 1, 10},  // 0x03
+    {10, 0, 0},  // 0x20
+    {10, 1, 10},  // 0x21
+    {20, 0, 4},  // 0x22
+    {24, 1, 10},  // 0x23
+    {34, 0, 12},  // 0x24
+    {46, 1, 10},  // 0x25
+    {56, 1, 10},  // 0x26
+    {66, 0, 4},  // 0x27
+    {70, 0, 13},  // 0x28
+    {83, 0, 13},  // 0x29
+    {96, 1, 6},  // 0x2A
+    {102, 4, 7},  // 0x2B
+    {109, 9, 4},  // 0x2C
+    {113, 6, 1},  // 0x2D
+    {114, 9, 2},  // 0x2E
+    {116, 0, 13},  // 0x2F
+    {129, 1, 10},  // 0x30
+    {139, 1, 10},  // 0x31
+    {149, 1, 10},  // 0x32
+    {159, 1, 10},  // 0x33
+    {169, 1, 10},  // 0x34
+    {179, 1, 10},  // 0x35
+    {189, 1, 10},  // 0x36
+    {199, 1, 10},  // 0x37
+    {209, 1, 10},  // 0x38
+    {219, 1, 10},  // 0x39
+    {229, 4, 7},  // 0x3A
+    {236, 4, 9},  // 0x3B
+    {245, 4, 7},  // 0x3C
+    {252, 5, 4},  // 0x3D
+    {256, 4, 7},  // 0x3E
+    {263, 1, 10},  // 0x3F
+    {273, 1, 10},  // 0x40
+    {283, 2, 9},  // 0x41
+    {292, 2, 9},  // 0x42
+    {301, 2, 9},  // 0x43
+    {310, 2, 9},  // 0x44
+    {319, 2, 9},  // 0x45
+    {328, 2, 9},  // 0x46
+    {337, 2, 9},  // 0x47
+    {346, 2, 9},  // 0x48
+    {355, 2, 9},  // 0x49
+    {364, 2, 9},  // 0x4A
+    {373, 2, 9},  // 0x4B
+    {382, 2, 9},  // 0x4C
+    {391, 2, 9},  // 0x4D
+    {400, 2, 9},  // 0x4E
+    {409, 2, 9},  // 0x4F
+    {418, 2, 9},  // 0x50
+    {427, 2, 11},  // 0x51
+    {438, 2, 9},  // 0x52
+    {447, 2, 9},  // 0x53
+    {456, 2, 9},  // 0x54
+    {465, 2, 9},  // 0x55
+    {474, 2, 9},  // 0x56
+    {483, 2, 9},  // 0x57
+    {492, 2, 9},  // 0x58
+    {501, 2, 9},  // 0x59
+    {510, 2, 9},  // 0x5A
+    {519, 0, 13},  // 0x5B
+    {532, 0, 13},  // 0x5C
+    {545, 0, 13},  // 0x5D
+    {558, 1, 8},  // 0x5E
+    {566, 11, 1},  // 0x5F
+    {567, 0, 2},  // 0x60
+    {569, 4, 7},  // 0x61
+    {576, 0, 11},  // 0x62
+    {587, 4, 7},  // 0x63
+    {594, 0, 11},  // 0x64
+    {605, 4, 7},  // 0x65
+    {612, 0, 11},  // 0x66
+    {623, 4, 10},  // 0x67
+    {633, 0, 11},  // 0x68
+    {644, 0, 11},  // 0x69
+    {655, 0, 14},  // 0x6A
+    {669, 0, 11},  // 0x6B
+    {680, 0, 11},  // 0x6C
+    {691, 4, 7},  // 0x6D
+    {698, 4, 7},  // 0x6E
+    {705, 4, 7},  // 0x6F
+    {712, 4, 10},  // 0x70
+    {722, 4, 10},  // 0x71
+    {732, 4, 7},  // 0x72
+    {739, 4, 7},  // 0x73
+    {746, 2, 9},  // 0x74
+    {755, 4, 7},  // 0x75
+    {762, 4, 7},  // 0x76
+    {769, 4, 7},  // 0x77
+    {776, 4, 7},  // 0x78
+    {783, 4, 10},  // 0x79
+    {793, 4, 7},  // 0x7A
+    {800, 0, 13},  // 0x7B
+    {813, 0, 13},  // 0x7C
+    {826, 0, 13},  // 0x7D
+    {839, 5, 3},  // 0x7E
+};
+static const unsigned char fontSmallBitmap[] = {
+    0x66,0xFF,0xFF,0xFF,0xFF,0x7E,0x7E,0x3C,0x3C,0x18,  // 0x03
+    0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x10,0x10,  // 0x21
+    0x24,0x24,0x24,0x24,  // 0x22
+    0x09,0x09,0x12,0x7F,0x12,0x24,0xFF,0x24,0x48,0x48,  // 0x23
+    0x10,0x3C,0x50,0x50,0x50,0x30,0x18,0x14,0x14,0x14,0x78,0x10,  // 0x24
+    0x61,0x92,0x94,0x94,0x68,0x16,0x29,0x29,0x49,0x86,  // 0x25
+    0x18,0x24,0x24,0x28,0x30,0xD1,0x89,0x8E,0xC6,0x7F,  // 0x26
+    0x10,0x10,0x10,0x10,  // 0x27
+    0x06,0x0C,0x10,0x10,0x20,0x20,0x20,0x20,0x20,0x10,0x10,0x0C,0x06,  // 0x28
+    0x60,0x30,0x08,0x08,0x04,0x04,0x04,0x04,0x04,0x08,0x08,0x30,0x60,  // 0x29
+    0x10,0x10,0x66,0x28,0x34,0x24,  // 0x2A
+    0x10,0x10,0x10,0xFE,0x10,0x10,0x10,  // 0x2B
+    0x18,0x18,0x08,0x10,  // 0x2C
+    0x7E,  // 0x2D
+    0x18,0x18,  // 0x2E
+    0x02,0x04,0x04,0x04,0x08,0x08,0x18,0x10,0x10,0x20,0x20,0x20,0x40,  // 0x2F
+    0x18,0x24,0x42,0x42,0x42,0x42,0x42,0x42,0x24,0x18,  // 0x30
+    0x08,0x78,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x7F,  // 0x31
+    0x78,0x04,0x04,0x04,0x08,0x08,0x10,0x20,0x40,0x7C,  // 0x32
+    0x3C,0x02,0x02,0x02,0x1C,0x02,0x02,0x02,0x02,0x3C,  // 0x33
+    0x04,0x0C,0x14,0x14,0x24,0x44,0x7E,0x04,0x04,0x04,  // 0x34
+    0x3E,0x20,0x20,0x20,0x38,0x06,0x02,0x02,0x02,0x3C,  // 0x35
+    0x1C,0x20,0x40,0x40,0x5C,0x62,0x42,0x42,0x22,0x1C,  // 0x36
+    0x7E,0x02,0x04,0x04,0x08,0x10,0x10,0x10,0x20,0x20,  // 0x37
+    0x3C,0x42,0x42,0x44,0x38,0x24,0x42,0x42,0x42,0x3C,  // 0x38
+    0x38,0x44,0x42,0x42,0x46,0x3A,0x02,0x02,0x04,0x38,  // 0x39
+    0x18,0x18,0x00,0x00,0x00,0x18,0x18,  // 0x3A
+    0x18,0x18,0x00,0x00,0x00,0x18,0x18,0x08,0x10,  // 0x3B
+    0x02,0x0C,0x10,0x60,0x10,0x0C,0x02,  // 0x3C
+    0x7E,0x00,0x00,0x7E,  // 0x3D
+    0x40,0x30,0x08,0x06,0x08,0x30,0x40,  // 0x3E
+    0x7C,0x42,0x02,0x04,0x08,0x10,0x10,0x00,0x10,0x10,  // 0x3F
+    0x3C,0x62,0x4E,0x92,0x92,0x92,0x96,0xDB,0x44,0x3C,  // 0x40
+    0x08,0x18,0x14,0x24,0x24,0x42,0x7E,0x42,0x81,  // 0x41
+    0x7C,0x42,0x42,0x44,0x78,0x44,0x42,0x42,0x7C,  // 0x42
+    0x3E,0x40,0x80,0x80,0x80,0x80,0x80,0x40,0x3E,  // 0x43
+    0xF8,0x84,0x82,0x82,0x82,0x82,0x82,0x84,0xF8,  // 0x44
+    0x7E,0x40,0x40,0x40,0x7C,0x40,0x40,0x40,0x7E,  // 0x45
+    0x7E,0x40,0x40,0x40,0x7C,0x40,0x40,0x40,0x40,  // 0x46
+    0x3E,0x40,0x80,0x80,0x80,0x8E,0x82,0x42,0x3E,  // 0x47
+    0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,  // 0x48
+    0x7C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x7C,  // 0x49
+    0x3C,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x78,  // 0x4A
+    0x42,0x44,0x48,0x50,0x60,0x50,0x48,0x44,0x42,  // 0x4B
+    0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,  // 0x4C
+    0xC6,0xC6,0xC6,0xAA,0xAA,0xAA,0x92,0x82,0x82,  // 0x4D
+    0x42,0x62,0x62,0x52,0x52,0x4A,0x4A,0x46,0x42,  // 0x4E
+    0x38,0x44,0x82,0x82,0x82,0x82,0x82,0x44,0x38,  // 0x4F
+    0x7C,0x42,0x42,0x42,0x46,0x78,0x40,0x40,0x40,  // 0x50
+    0x38,0x44,0x82,0x82,0x82,0x82,0x82,0x44,0x38,0x06,0x03,  // 0x51
+    0x78,0x44,0x44,0x44,0x78,0x48,0x4C,0x44,0x42,  // 0x52
+    0x3E,0x40,0x40,0x60,0x18,0x06,0x02,0x02,0x7C,  // 0x53
+    0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,  // 0x54
+    0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,  // 0x55
+    0x81,0x42,0x42,0x44,0x24,0x28,0x28,0x10,0x10,  // 0x56
+    0x81,0x81,0x93,0x9A,0x5A,0x5A,0x66,0x66,0x24,  // 0x57
+    0x81,0x42,0x24,0x18,0x18,0x18,0x24,0x42,0x81,  // 0x58
+    0x81,0x42,0x44,0x28,0x18,0x10,0x10,0x10,0x10,  // 0x59
+    0xFE,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0xFE,  // 0x5A
+    0x1E,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1E,  // 0x5B
+    0x40,0x20,0x20,0x20,0x10,0x10,0x18,0x08,0x08,0x04,0x04,0x04,0x02,  // 0x5C
+    0x78,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x78,  // 0x5D
+    0x08,0x08,0x18,0x14,0x14,0x24,0x22,0x42,  // 0x5E
+    0xFF,  // 0x5F
+    0x08,0x04,  // 0x60
+    0x3C,0x02,0x02,0x3E,0x42,0x42,0x3F,  // 0x61
+    0x40,0x40,0x40,0x40,0x5C,0x62,0x42,0x42,0x42,0x62,0x5C,  // 0x62
+    0x1E,0x20,0x40,0x40,0x40,0x20,0x1E,  // 0x63
+    0x02,0x02,0x02,0x02,0x3A,0x46,0x42,0x42,0x42,0x46,0x3A,  // 0x64
+    0x3C,0x22,0x42,0x7E,0x40,0x40,0x3E,  // 0x65
+    0x0E,0x10,0x10,0x10,0x7E,0x10,0x10,0x10,0x10,0x10,0x10,  // 0x66
+    0x3E,0x46,0x42,0x42,0x42,0x46,0x3A,0x02,0x02,0x3C,  // 0x67
+    0x40,0x40,0x40,0x40,0x5C,0x62,0x42,0x42,0x42,0x42,0x42,  // 0x68
+    0x18,0x18,0x00,0x00,0x78,0x08,0x08,0x08,0x08,0x08,0x08,  // 0x69
+    0x0C,0x0C,0x00,0x00,0x3C,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x78,  // 0x6A
+    0x40,0x40,0x40,0x40,0x44,0x48,0x50,0x60,0x58,0x44,0x42,  // 0x6B
+    0x78,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,  // 0x6C
+    0xB6,0xDA,0x92,0x92,0x92,0x92,0x92,  // 0x6D
+    0x5C,0x62,0x42,0x42,0x42,0x42,0x42,  // 0x6E
+    0x38,0x44,0x82,0x82,0x82,0x44,0x38,  // 0x6F
+    0x5C,0x62,0x42,0x42,0x42,0x62,0x5C,0x40,0x40,0x40,  // 0x70
+    0x3A,0x46,0x42,0x42,0x42,0x46,0x3A,0x02,0x02,0x02,  // 0x71
+    0x5C,0x64,0x40,0x40,0x40,0x40,0x40,  // 0x72
+    0x3C,0x40,0x60,0x18,0x04,0x04,0x78,  // 0x73
+    0x20,0x20,0xFE,0x20,0x20,0x20,0x20,0x20,0x1E,  // 0x74
+    0x42,0x42,0x42,0x42,0x42,0x46,0x3A,  // 0x75
+    0x81,0x42,0x42,0x44,0x28,0x28,0x10,  // 0x76
+    0x81,0x89,0x5A,0x5A,0x66,0x24,0x24,  // 0x77
+    0x42,0x24,0x18,0x18,0x18,0x24,0x42,  // 0x78
+    0x81,0x42,0x42,0x24,0x24,0x18,0x18,0x10,0x30,0xE0,  // 0x79
+    0xFE,0x04,0x08,0x10,0x20,0x40,0xFE,  // 0x7A
+    0x0E,0x10,0x10,0x10,0x10,0x10,0x60,0x10,0x10,0x10,0x10,0x10,0x0E,  // 0x7B
+    0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,  // 0x7C
+    0x70,0x08,0x08,0x08,0x08,0x08,0x06,0x08,0x08,0x08,0x08,0x08,0x70,  // 0x7D
+    0x61,0x99,0x86,  // 0x7E
+};
+
+//! \brief fontMedium, 96 glyphs, 3130 bytes of rows
+static const fontRange fontMediumRanges[] = {
+    {0x03, 1, 0},
+    {0x20, 95, 1},
+};
+static const fontGlyph fontMediumGlyphs[] = {
+    {0, 2, 19},  // 0x03
+    {38, 0, 0},  // 0x20
+    {38, 2, 19},  // 0x21
+    {76, 1, 7},  // 0x22
+    {90, 2, 19},  // 0x23
+    {128, 0, 23},  // 0x24
+    {174, 2, 19},  // 0x25
+    {212, 2, 19},  // 0x26
+    {250, 1, 7},  // 0x27
+    {264, 1, 24},  // 0x28
+    {312, 1, 24},  // 0x29
+    {360, 2, 11},  // 0x2A
+    {382, 7, 14},  // 0x2B
+    {410, 17, 8},  // 0x2C
+    {426, 12, 2},  // 0x2D
+    {430, 17, 4},  // 0x2E
+    {438, 1, 24},  // 0x2F
+    {486, 2, 19},  // 0x30
+    {524, 2, 19},  // 0x31
+    {562, 2, 19},  // 0x32
+    {600, 2, 19},  // 0x33
+    {638, 2, 19},  // 0x34
+    {676, 2, 19},  // 0x35
+    {714, 2, 19},  // 0x36
+    {752, 2, 19},  // 0x37
+    {790, 2, 19},  // 0x38
+    {828, 2, 19},  // 0x39
+    {866, 7, 14},  // 0x3A
+    {894, 7, 18},  // 0x3B
+    {930, 7, 14},  // 0x3C
+    {958, 10, 7},  // 0x3D
+    {972, 7, 14},  // 0x3E
+    {1000, 2, 19},  // 0x3F
+    {1038, 2, 19},  // 0x40
+    {1076, 5, 16},  // 0x41
+    {1108, 5, 16},  // 0x42
+    {1140, 5, 16},  // 0x43
+    {1172, 5, 16},  // 0x44
+    {1204, 5, 16},  // 0x45
+    {1236, 5, 16},  // 0x46
+    {1268, 5, 16},  // 0x47
+    {1300, 5, 16},  // 0x48
+    {1332, 5, 16},  // 0x49
+    {1364, 5, 16},  // 0x4A
+    {1396, 5, 16},  // 0x4B
+    {1428, 5, 16},  // 0x4C
+    {1460, 5, 16},  // 0x4D
+    {1492, 5, 16},  // 0x4E
+    {1524, 5, 16},  // 0x4F
+    {1556, 5, 16},  // 0x50
+    {1588, 5, 20},  // 0x51
+    {1628, 5, 16},  // 0x52
+    {1660, 5, 16},  // 0x53
+    {1692, 5, 16},  // 0x54
+    {1724, 5, 16},  // 0x55
+    {1756, 5, 16},  // 0x56
+    {1788, 5, 16},  // 0x57
+    {1820, 5, 16},  // 0x58
+    {1852, 5, 16},  // 0x59
+    {1884, 5, 16},  // 0x5A
+    {1916, 1, 24},  // 0x5B
+    {1964, 1, 24},  // 0x5C
+    {2012, 1, 24},  // 0x5D
+    {2060, 2, 15},  // 0x5E
+    {2090, 21, 2},  // 0x5F
+    {2094, 0, 3},  // 0x60
+    {2100, 7, 14},  // 0x61
+    {2128, 1, 20},  // 0x62
+    {2168, 7, 14},  // 0x63
+    {2196, 1, 20},  // 0x64
+    {2236, 7, 14},  // 0x65
+    {2264, 1, 20},  // 0x66
+    {2304, 7, 19},  // 0x67
+    {2342, 1, 20},  // 0x68
+    {2382, 1, 20},  // 0x69
+    {2422, 1, 25},  // 0x6A
+    {2472, 1, 20},  // 0x6B
+    {2512, 1, 20},  // 0x6C
+    {2552, 7, 14},  // 0x6D
+    {2580, 7, 14},  // 0x6E
+    {2608, 7, 14},  // 0x6F
+    {2636, 7, 19},  // 0x70
+    {2674, 7, 19},  // 0x71
+    {2712, 7, 14},  // 0x72
+    {2740, 7, 14},  // 0x73
+    {2768, 5, 16},  // 0x74
+    {2800, 7, 14},  // 0x75
+    {2828, 7, 14},  // 0x76
+    {2856, 7, 14},  // 0x77
+    {2884, 7, 14},  // 0x78
+    {2912, 7, 19},  // 0x79
+    {2950, 7, 14},  // 0x7A
+    {2978, 1, 24},  // 0x7B
+    {3026, 1, 24},  // 0x7C
+    {3074, 1, 24},  // 0x7D
+    {3122, 12, 4},  // 0x7E
+};
+static const unsigned char fontMediumBitmap[] = {
+    0x3C,0x3C,0x7E,0x7E,0xFE,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x7F,0xFE,0x7F,0xFC,0x3F,0xFC,0x3F,0xF8,0x1F,0xF0,0x0F,0xF0,0x0F,0xE0,0x07,0xC0,0x03,0x80,0x01,  // 0x03
+    0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0x00,0x00,0x00,0x00,0xC0,0x01,0xC0,0x01,0xC0,0x01,  // 0x21
+    0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x20,0x08,0x20,0x08,  // 0x22
+    0x8C,0x01,0x8C,0x01,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0xFE,0x3F,0xFE,0x3F,0x30,0x06,0x60,0x06,0x60,0x0C,0xFC,0x7F,0xFC,0x7F,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0x80,0x31,0x80,0x31,  // 0x23
+    0xC0,0x00,0xC0,0x00,0xF8,0x03,0xFC,0x0F,0xC4,0x0E,0xC0,0x1C,0xC0,0x1C,0xC0,0x1C,0xC0,0x1E,0xC0,0x0F,0xC0,0x07,0xE0,0x01,0xF8,0x00,0xF8,0x00,0xDC,0x00,0xDC,0x00,0xDC,0x00,0xDC,0x00,0xD8,0x18,0xF8,0x1F,0xF0,0x07,0xC0,0x00,0xC0,0x00,  // 0x24
+    0x03,0x3C,0x06,0x66,0x0C,0xC3,0x18,0xC3,0x18,0xC3,0x30,0xC3,0x60,0xC3,0xC0,0x66,0xC0,0x3C,0x80,0x01,0x3C,0x03,0x66,0x03,0xC3,0x06,0xC3,0x0C,0xC3,0x18,0xC3,0x18,0xC3,0x30,0x66,0x60,0x3C,0xC0,  // 0x25
+    0xC0,0x07,0xE0,0x0F,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x60,0x1C,0xE0,0x0E,0x80,0x0F,0x00,0x1F,0x07,0x3F,0x87,0x73,0xC7,0xE3,0xC6,0xE1,0xE6,0xE0,0x7E,0xE0,0x7C,0xF0,0x3C,0x78,0xFE,0x3F,0xCF,0x0F,  // 0x26
+    0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x00,0x01,0x00,0x01,  // 0x27
+    0x18,0x00,0x78,0x00,0xF0,0x00,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x07,0x00,0x07,0x00,0x07,0x80,0x03,0xC0,0x01,0xF0,0x00,0x78,0x00,0x18,0x00,  // 0x28
+    0x00,0x30,0x00,0x3C,0x00,0x1E,0x00,0x07,0x80,0x03,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xC0,0x01,0xC0,0x01,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x1E,0x00,0x3C,0x00,0x30,  // 0x29
+    0xC0,0x01,0xC0,0x01,0xC0,0x01,0xD8,0x19,0x7C,0x3E,0x30,0x0C,0x40,0x02,0xE0,0x07,0x70,0x0E,0x38,0x1C,0x20,0x04,  // 0x2A
+    0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xFE,0x7F,0xFE,0x7F,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,  // 0x2B
+    0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x00,0xC0,0x01,0x80,0x01,0x00,0x03,  // 0x2C
+    0xF8,0x1F,0xF8,0x1F,  // 0x2D
+    0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,  // 0x2E
+    0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,  // 0x2F
+    0xC0,0x07,0xE0,0x0F,0x70,0x1C,0x38,0x38,0x38,0x38,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x38,0x38,0x38,0x38,0x70,0x1C,0xE0,0x0F,0xC0,0x07,  // 0x30
+    0xC0,0x00,0xC0,0x07,0xC0,0x3F,0xC0,0x31,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xFE,0x3F,0xFE,0x3F,  // 0x31
+    0xC0,0x0F,0xE0,0x3F,0x70,0x30,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x70,0x00,0x70,0x00,0xE0,0x00,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x0C,0x00,0x1C,0x00,0x38,0xF8,0x3F,0xF8,0x3F,  // 0x32
+    0xC0,0x0F,0xF0,0x1F,0x78,0x10,0x38,0x00,0x38,0x00,0x38,0x00,0x30,0x00,0x60,0x00,0xC0,0x07,0xE0,0x07,0xF0,0x00,0x78,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x78,0x00,0xF0,0x10,0xE0,0x1F,0xC0,0x1F,  // 0x33
+    0x70,0x00,0xF0,0x00,0xF0,0x01,0xF0,0x01,0x70,0x03,0x70,0x07,0x70,0x06,0x70,0x0C,0x70,0x18,0x70,0x18,0x70,0x30,0x70,0x60,0xFE,0x7F,0xFE,0x7F,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,  // 0x34
+    0xFC,0x0F,0xFC,0x0F,0xFC,0x0F,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0xC0,0x0F,0xF0,0x0F,0x78,0x00,0x3C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x3C,0x00,0x78,0x08,0xF0,0x0F,0xC0,0x0F,  // 0x35
+    0xF8,0x01,0xFC,0x07,0x04,0x0F,0x00,0x0E,0x00,0x1C,0x00,0x1C,0x00,0x38,0xF0,0x39,0xF8,0x3B,0x3C,0x3E,0x1E,0x3C,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x1C,0x1C,0x1C,0x1C,0x0E,0xF8,0x0F,0xE0,0x03,  // 0x36
+    0xFC,0x1F,0xFC,0x1F,0xFC,0x1F,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x0E,0x00,0x0C,0x00,0x0C,  // 0x37
+    0xE0,0x03,0xF0,0x0F,0x78,0x1E,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x30,0x1E,0xF0,0x0F,0xC0,0x07,0xF0,0x0F,0xF8,0x1C,0x78,0x18,0x3C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x38,0x1C,0xF0,0x0F,0xE0,0x07,  // 0x38
+    0xE0,0x03,0xF8,0x0F,0x38,0x1C,0x1C,0x1C,0x1C,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x1E,0x3C,0x3E,0x1E,0xEE,0x0F,0xCE,0x07,0x0E,0x00,0x1C,0x00,0x1C,0x00,0x38,0x00,0x78,0x10,0xF0,0x1F,0xC0,0x0F,  // 0x39
+    0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,  // 0x3A
+    0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x00,0xC0,0x01,0x80,0x01,0x00,0x03,  // 0x3B
+    0x02,0x00,0x0E,0x00,0x3C,0x00,0xF0,0x00,0xC0,0x03,0x00,0x0F,0x00,0x3C,0x00,0x3C,0x00,0x0F,0xC0,0x03,0xF0,0x00,0x3C,0x00,0x0E,0x00,0x02,0x00,  // 0x3C
+    0xFE,0x7F,0xFE,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0xFE,0x7F,  // 0x3D
+    0x00,0x40,0x00,0x70,0x00,0x3C,0x00,0x0F,0xC0,0x03,0xF0,0x00,0x3C,0x00,0x3C,0x00,0xF0,0x00,0xC0,0x03,0x00,0x0F,0x00,0x3C,0x00,0x70,0x00,0x40,  // 0x3E
+    0xE0,0x1F,0xF8,0x3F,0x3C,0x30,0x1C,0x30,0x1C,0x00,0x1C,0x00,0x38,0x00,0x78,0x00,0xF0,0x00,0xE0,0x01,0xC0,0x01,0x80,0x03,0x80,0x03,0x80,0x03,0x00,0x00,0x00,0x00,0x80,0x03,0x80,0x03,0x80,0x03,  // 0x3F
+    0xF0,0x03,0xF8,0x07,0x1C,0x0E,0x0C,0x18,0x7C,0x38,0x8C,0x30,0x8C,0x71,0x0C,0x63,0x0C,0x63,0x1C,0x63,0x1C,0x63,0x3C,0x63,0x2C,0x63,0xEF,0x71,0xCF,0x31,0x00,0x38,0x10,0x1C,0xF0,0x0F,0xE0,0x03,  // 0x40
+    0x80,0x03,0xC0,0x03,0xC0,0x07,0xE0,0x06,0xE0,0x06,0x60,0x0E,0x70,0x0C,0x70,0x1C,0x38,0x1C,0x38,0x18,0xFC,0x3F,0xFC,0x3F,0x1C,0x70,0x0E,0x70,0x0E,0x70,0x07,0xE0,  // 0x41
+    0xE0,0x3F,0xF0,0x3F,0x78,0x38,0x38,0x38,0x38,0x38,0x70,0x38,0xE0,0x3F,0xE0,0x3F,0x78,0x38,0x3C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x3C,0x38,0xF8,0x3F,0xE0,0x3F,  // 0x42
+    0xF8,0x03,0xFC,0x0F,0x0C,0x1E,0x00,0x3C,0x00,0x38,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x38,0x00,0x3C,0x04,0x1E,0xFC,0x0F,0xF8,0x03,  // 0x43
+    0xE0,0x3F,0xF0,0x3F,0x3C,0x38,0x1C,0x38,0x1E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x1C,0x38,0x1C,0x38,0x78,0x38,0xF0,0x3F,0xC0,0x3F,  // 0x44
+    0xFC,0x1F,0xFC,0x1F,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0xF8,0x1F,0xF8,0x1F,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0xFE,0x1F,0xFE,0x1F,  // 0x45
+    0xFE,0x1F,0xFE,0x1F,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0xFC,0x1F,0xFC,0x1F,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,  // 0x46
+    0xF8,0x03,0xFC,0x0F,0x0C,0x1E,0x00,0x3C,0x00,0x38,0x00,0x70,0x00,0x70,0x00,0x70,0xFC,0x70,0xFC,0x70,0x1C,0x70,0x1C,0x38,0x1C,0x3C,0x1C,0x1E,0xFC,0x0F,0xF8,0x03,  // 0x47
+    0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0xFC,0x3F,0xFC,0x3F,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,  // 0x48
+    0xF8,0x3F,0xF8,0x3F,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xF8,0x3F,0xF8,0x3F,  // 0x49
+    0xF0,0x1F,0xF0,0x1F,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0xE0,0x20,0xC0,0x3F,0x80,0x3F,  // 0x4A
+    0x1E,0x38,0x3C,0x38,0x78,0x38,0xF0,0x38,0xE0,0x38,0xC0,0x39,0x80,0x3B,0x00,0x3F,0x80,0x3B,0xC0,0x3B,0xE0,0x39,0xF0,0x38,0x78,0x38,0x3C,0x38,0x1E,0x38,0x1F,0x38,  // 0x4B
+    0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0xFC,0x1F,0xFC,0x1F,  // 0x4C
+    0x1C,0x70,0x3C,0x78,0x3C,0x78,0x3C,0x78,0x6C,0x6C,0x6C,0x6C,0x6C,0x6C,0x4C,0x66,0xCC,0x66,0xCC,0x66,0x8C,0x63,0x8C,0x63,0x8C,0x63,0x0C,0x60,0x0C,0x60,0x0C,0x60,  // 0x4D
+    0x0C,0x38,0x0C,0x38,0x0C,0x3C,0x0C,0x3E,0x0C,0x3E,0x0C,0x3F,0x8C,0x37,0x8C,0x33,0xCC,0x33,0xEC,0x31,0xFC,0x30,0x7C,0x30,0x7C,0x30,0x3C,0x30,0x1C,0x30,0x1C,0x30,  // 0x4E
+    0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x1C,0x38,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x1C,0x38,0x1C,0x38,0x38,0x1C,0xF0,0x0F,0xE0,0x07,  // 0x4F
+    0xF8,0x1F,0xFC,0x1F,0x1E,0x1C,0x0E,0x1C,0x0E,0x1C,0x0E,0x1C,0x1E,0x1C,0x3C,0x1C,0xF8,0x1F,0xE0,0x1F,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,  // 0x50
+    0xE0,0x07,0xF0,0x0F,0x38,0x1C,0x1C,0x38,0x1C,0x38,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x1C,0x38,0x1C,0x38,0x38,0x1C,0xF0,0x0F,0xE0,0x07,0x78,0x00,0x1E,0x00,0x0F,0x00,0x02,0x00,  // 0x51
+    0xE0,0x3F,0xF0,0x3F,0x78,0x38,0x38,0x38,0x38,0x38,0x38,0x38,0x70,0x38,0xE0,0x3F,0xC0,0x3F,0xE0,0x39,0xE0,0x38,0xF0,0x38,0x78,0x38,0x3C,0x38,0x1C,0x38,0x1E,0x38,  // 0x52
+    0xF0,0x07,0xF8,0x1F,0x18,0x3C,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x1F,0xE0,0x0F,0xF8,0x03,0x7C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x38,0x30,0xF8,0x3F,0xE0,0x0F,  // 0x53
+    0xFE,0xFF,0xFE,0xFF,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,  // 0x54
+    0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x1E,0x3C,0x1C,0x1C,0xF8,0x0F,0xF0,0x07,  // 0x55
+    0x07,0xE0,0x0E,0x70,0x0E,0x70,0x0E,0x38,0x1C,0x38,0x1C,0x3C,0x1C,0x1C,0x38,0x1C,0x38,0x0E,0x30,0x0E,0x70,0x07,0x70,0x07,0xE0,0x07,0xE0,0x03,0xE0,0x03,0xC0,0x01,  // 0x56
+    0x03,0xC0,0x03,0xC0,0x03,0xE0,0x86,0x61,0xC6,0x63,0xC6,0x63,0xC6,0x63,0xC6,0x63,0x6E,0x72,0x6C,0x36,0x6C,0x36,0x6C,0x36,0x7C,0x34,0x3C,0x3C,0x38,0x3C,0x38,0x3C,  // 0x57
+    0x07,0x78,0x0E,0x3C,0x1C,0x1E,0x38,0x1E,0x70,0x0F,0xE0,0x07,0xC0,0x03,0xC0,0x03,0xE0,0x03,0xE0,0x07,0xF0,0x06,0x78,0x0C,0x3C,0x18,0x1C,0x38,0x1E,0x70,0x0F,0xE0,  // 0x58
+    0x07,0xE0,0x0E,0x70,0x0C,0x38,0x18,0x38,0x38,0x1C,0x70,0x1E,0xE0,0x0E,0xC0,0x07,0xC0,0x07,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,  // 0x59
+    0xFC,0x3F,0xFC,0x3F,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x00,0xC0,0x01,0x80,0x01,0x00,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x70,0xFC,0x7F,0xFC,0x7F,  // 0x5A
+    0xFC,0x03,0xFC,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xFC,0x03,0xFC,0x03,  // 0x5B
+    0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x80,0x01,0x80,0x01,0xC0,0x00,0xC0,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,  // 0x5C
+    0xC0,0x3F,0xC0,0x3F,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x3F,0xC0,0x3F,  // 0x5D
+    0x80,0x00,0x80,0x00,0xC0,0x01,0xC0,0x01,0xC0,0x03,0x60,0x03,0x60,0x07,0x30,0x06,0x30,0x0C,0x18,0x0C,0x18,0x18,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,  // 0x5E
+    0xFF,0xFF,0xFF,0xFF,  // 0x5F
+    0x80,0x03,0xC0,0x01,0xE0,0x00,  // 0x60
+    0xE0,0x07,0xF0,0x1F,0x78,0x18,0x38,0x00,0x38,0x00,0xF8,0x07,0xF8,0x0F,0x38,0x1C,0x38,0x38,0x38,0x38,0x38,0x38,0x78,0x3C,0xDE,0x1F,0x1E,0x0F,  // 0x61
+    0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0xE0,0x39,0xF8,0x3B,0x38,0x3E,0x1C,0x3C,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x38,0x38,0x78,0x3C,0xF0,0x3F,0xE0,0x33,  // 0x62
+    0xF8,0x03,0xFC,0x0F,0x04,0x1E,0x00,0x1C,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x3C,0x00,0x1C,0x04,0x1F,0xFC,0x0F,0xF8,0x03,  // 0x63
+    0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0xCE,0x03,0xFE,0x0F,0x3E,0x1E,0x0E,0x1C,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x1E,0x3C,0x3E,0x1C,0xEE,0x0F,0xCE,0x07,  // 0x64
+    0xE0,0x03,0xF0,0x0F,0x38,0x1E,0x1C,0x1C,0x1C,0x38,0x1C,0x38,0xFC,0x3F,0xFC,0x3F,0x00,0x38,0x00,0x38,0x00,0x1C,0x04,0x1E,0xFC,0x0F,0xF8,0x03,  // 0x65
+    0xFF,0x00,0xFF,0x01,0xC0,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xFE,0x3F,0xFE,0x3F,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,  // 0x66
+    0xCE,0x03,0xFE,0x0F,0x3E,0x1E,0x0E,0x1C,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x1E,0x3C,0x3E,0x1C,0xEE,0x0F,0xCE,0x07,0x0E,0x00,0x1C,0x00,0x3C,0x18,0xF8,0x1F,0xE0,0x0F,  // 0x67
+    0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0xF0,0x38,0xF8,0x3B,0x3C,0x3E,0x1C,0x3C,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,  // 0x68
+    0xC0,0x01,0xC0,0x01,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x3F,0xC0,0x3F,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,  // 0x69
+    0x70,0x00,0x70,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x1F,0xF0,0x1F,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0xE0,0x20,0xE0,0x3F,0x80,0x1F,  // 0x6A
+    0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x3C,0x1C,0x78,0x1C,0x70,0x1C,0xF0,0x1C,0xE0,0x1D,0xC0,0x1D,0xC0,0x1F,0xC0,0x1D,0xE0,0x1D,0xF0,0x1C,0x70,0x1C,0x78,0x1C,0x3C,0x1C,0x1E,0x1C,  // 0x6B
+    0xE0,0x1F,0xE0,0x1F,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,  // 0x6C
+    0x8C,0x73,0x9E,0x77,0xFE,0x7F,0xEE,0x79,0xCE,0x79,0xCE,0x71,0xCE,0x71,0xCE,0x71,0xCE,0x71,0xCE,0x71,0xCE,0x71,0xCE,0x71,0xCE,0x71,0xCE,0x71,  // 0x6D
+    0xF0,0x38,0xF8,0x3B,0x3C,0x3E,0x1C,0x3C,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,  // 0x6E
+    0xC0,0x07,0xF0,0x1F,0x78,0x3C,0x38,0x38,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x38,0x38,0x78,0x3C,0xF0,0x1F,0xC0,0x07,  // 0x6F
+    0xE0,0x39,0xF8,0x3B,0x38,0x3E,0x1C,0x3C,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x38,0x38,0x78,0x3C,0xF0,0x3F,0xE0,0x39,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x38,  // 0x70
+    0x9C,0x07,0xFC,0x1F,0x7C,0x3C,0x1C,0x38,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x3C,0x78,0x7C,0x38,0xDC,0x1F,0x1C,0x0F,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,  // 0x71
+    0x7C,0x0E,0xFC,0x0E,0x8C,0x0F,0x0C,0x0F,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,  // 0x72
+    0xF0,0x07,0xF8,0x0F,0x08,0x1E,0x00,0x1C,0x00,0x1C,0x80,0x1F,0xE0,0x0F,0xF8,0x01,0x3C,0x00,0x1C,0x00,0x1C,0x00,0x3C,0x18,0xF8,0x1F,0xE0,0x0F,  // 0x73
+    0x00,0x07,0x00,0x07,0xFC,0x3F,0xFC,0x3F,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x80,0x07,0xFC,0x03,0xFC,0x01,  // 0x74
+    0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x3C,0x38,0x7C,0x3C,0xDC,0x1F,0x1C,0x0F,  // 0x75
+    0x0E,0x78,0x1C,0x38,0x1C,0x38,0x1C,0x3C,0x18,0x1C,0x38,0x1C,0x38,0x0E,0x30,0x0E,0x70,0x07,0x70,0x07,0x60,0x07,0xE0,0x03,0xE0,0x03,0xC0,0x01,  // 0x76
+    0x03,0xC0,0xC3,0xE1,0xC2,0xE1,0xC6,0x63,0xC6,0x63,0x46,0x62,0x66,0x76,0x64,0x76,0x6C,0x36,0x6C,0x34,0x3C,0x3C,0x3C,0x3C,0x38,0x3C,0x38,0x18,  // 0x77
+    0x0C,0x78,0x18,0x3C,0x30,0x1E,0x70,0x0E,0x60,0x0F,0xC0,0x07,0xC0,0x03,0xC0,0x03,0xE0,0x07,0xF0,0x0E,0x70,0x0C,0x78,0x1C,0x3C,0x38,0x1E,0x70,  // 0x78
+    0x0E,0x78,0x0C,0x38,0x1C,0x38,0x18,0x1C,0x38,0x1C,0x38,0x1E,0x70,0x0E,0x70,0x0F,0xE0,0x07,0xE0,0x07,0xC0,0x03,0xC0,0x03,0x80,0x03,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x07,0x00,0x3E,0x00,0x3C,  // 0x79
+    0xFC,0x3F,0xFC,0x3F,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x00,0xC0,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0xFC,0x3F,0xFC,0x3F,  // 0x7A
+    0xF8,0x00,0xF8,0x01,0xC0,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0x80,0x03,0x00,0x1F,0x00,0x1F,0x80,0x03,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0x80,0x03,0x80,0x03,0x80,0x03,0xC0,0x03,0xF8,0x01,0xF8,0x00,  // 0x7B
+    0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,  // 0x7C
+    0x00,0x3E,0x00,0x3F,0x80,0x07,0x80,0x03,0x80,0x03,0x80,0x03,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x80,0x03,0xF0,0x01,0xF0,0x01,0x80,0x03,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x07,0x00,0x3F,0x00,0x3E,  // 0x7D
+    0x06,0x1E,0xC6,0x3F,0xFC,0x63,0x78,0x60,  // 0x7E
+};
+
+//! \brief fontLarge, 96 glyphs, 6528 bytes of rows
+static const fontRange fontLargeRanges[] = {
+    {0x03, 1, 0},
+    {0x20, 95, 1},
+};
+static const fontGlyph fontLargeGlyphs[] = {
+    {0, 2, 26},  // 0x03
+    {78, 0, 0},  // 0x20
+    {78, 2, 26},  // 0x21
+    {156, 0, 10},  // 0x22
+    {186, 2, 26},  // 0x23
+    {264, 0, 30},  // 0x24
+    {354, 2, 26},  // 0x25
+    {432, 2, 26},  // 0x26
+    {510, 0, 10},  // 0x27
+    {540, 0, 33},  // 0x28
+    {639, 0, 33},  // 0x29
+    {738, 2, 15},  // 0x2A
+    {783, 9, 19},  // 0x2B
+    {840, 23, 11},  // 0x2C
+    {873, 15, 3},  // 0x2D
+    {882, 23, 5},  // 0x2E
+    {897, 0, 33},  // 0x2F
+    {996, 2, 26},  // 0x30
+    {1074, 2, 26},  // 0x31
+    {1152, 2, 26},  // 0x32
+    {1230, 2, 26},  // 0x33
+    {1308, 2, 26},  // 0x34
+    {1386, 2, 26},  // 0x35
+    {1464, 2, 26},  // 0x36
+    {1542, 2, 26},  // 0x37
+    {1620, 2, 26},  // 0x38
+    {1698, 2, 26},  // 0x39
+    {1776, 9, 19},  // 0x3A
+    {1833, 9, 25},  // 0x3B
+    {1908, 9, 19},  // 0x3C
+    {1965, 13, 10},  // 0x3D
+    {1995, 9, 19},  // 0x3E
+    {2052, 2, 26},  // 0x3F
+    {2130, 2, 26},  // 0x40
+    {2208, 5, 23},  // 0x41
+    {2277, 5, 23},  // 0x42
+    {2346, 5, 23},  // 0x43
+    {2415, 5, 23},  // 0x44
+    {2484, 5, 23},  // 0x45
+    {2553, 5, 23},  // 0x46
+    {2622, 5, 23},  // 0x47
+    {2691, 5, 23},  // 0x48
+    {2760, 5, 23},  // 0x49
+    {2829, 5, 23},  // 0x4A
+    {2898, 5, 23},  // 0x4B
+    {2967, 5, 23},  // 0x4C
+    {3036, 5, 23},  // 0x4D
+    {3105, 5, 23},  // 0x4E
+    {3174, 5, 23},  // 0x4F
+    {3243, 5, 23},  // 0x50
+    {3312, 5, 28},  // 0x51
+    {3396, 5, 23},  // 0x52
+    {3465, 5, 23},  // 0x53
+    {3534, 5, 23},  // 0x54
+    {3603, 5, 23},  // 0x55
+    {3672, 5, 23},  // 0x56
+    {3741, 5, 23},  // 0x57
+    {3810, 5, 23},  // 0x58
+    {3879, 5, 23},  // 0x59
+    {3948, 5, 23},  // 0x5A
+    {4017, 0, 33},  // 0x5B
+    {4116, 0, 33},  // 0x5C
+    {4215, 0, 33},  // 0x5D
+    {4314, 2, 21},  // 0x5E
+    {4377, 28, 3},  // 0x5F
+    {4386, 0, 4},  // 0x60
+    {4398, 9, 19},  // 0x61
+    {4455, 0, 28},  // 0x62
+    {4539, 9, 19},  // 0x63
+    {4596, 0, 28},  // 0x64
+    {4680, 9, 19},  // 0x65
+    {4737, 0, 28},  // 0x66
+    {4821, 9, 26},  // 0x67
+    {4899, 0, 28},  // 0x68
+    {4983, 1, 27},  // 0x69
+    {5064, 1, 34},  // 0x6A
+    {5166, 0, 28},  // 0x6B
+    {5250, 0, 28},  // 0x6C
+    {5334, 9, 19},  // 0x6D
+    {5391, 9, 19},  // 0x6E
+    {5448, 9, 19},  // 0x6F
+    {5505, 9, 26},  // 0x70
+    {5583, 9, 26},  // 0x71
+    {5661, 9, 19},  // 0x72
+    {5718, 9, 19},  // 0x73
+    {5775, 5, 23},  // 0x74
+    {5844, 9, 19},  // 0x75
+    {5901, 9, 19},  // 0x76
+    {5958, 9, 19},  // 0x77
+    {6015, 9, 19},  // 0x78
+    {6072, 9, 26},  // 0x79
+    {6150, 9, 19},  // 0x7A
+    {6207, 0, 33},  // 0x7B
+    {6306, 0, 33},  // 0x7C
+    {6405, 0, 33},  // 0x7D
+    {6504, 14, 8},  // 0x7E
+};
+static const unsigned char fontLargeBitmap[] = {
+    0xF8,0xC0,0x07,0xFC,0xE1,0x0F,0xFE,0xF3,0x1F,0xFE,0xFF,0x1F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFE,0xFF,0x1F,0xFE,0xFF,0x1F,0xFE,0xFF,0x1F,0xFC,0xFF,0x0F,0xFC,0xFF,0x0F,0xF8,0xFF,0x07,0xF8,0xFF,0x07,0xF0,0xFF,0x03,0xE0,0xFF,0x01,0xE0,0xFF,0x01,0xC0,0xFF,0x00,0x80,0x7F,0x00,0x00,0x3F,0x00,0x00,0x1E,0x00,0x00,0x0C,0x00,  // 0x03
+    0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,  // 0x21
+    0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,0xC0,0x80,0x01,  // 0x22
+    0x38,0x1C,0x00,0x38,0x1C,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0x70,0x38,0x00,0xE0,0x70,0x00,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xC0,0xE1,0x00,0xC0,0xE1,0x00,0xC0,0xE1,0x00,0xC0,0xE1,0x00,0xC0,0xE1,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x80,0xC3,0x01,0x00,0x87,0x03,0x00,0x87,0x03,0x00,0x87,0x03,0x00,0x87,0x03,0x00,0x87,0x03,0x00,0x0E,0x07,0x00,0x0E,0x07,  // 0x23
+    0x00,0x0C,0x00,0x00,0x0C,0x00,0x80,0x3F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x01,0x60,0xEC,0x01,0x00,0xCC,0x03,0x00,0x8C,0x03,0x00,0x8C,0x03,0x00,0x8C,0x03,0x00,0xCC,0x03,0x00,0xEC,0x01,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x80,0x1F,0x00,0xC0,0x0F,0x00,0xE0,0x0F,0x00,0xE0,0x0C,0x00,0xF0,0x0C,0x00,0x70,0x0C,0x00,0x70,0x0C,0x00,0x70,0x0C,0x00,0xF0,0x0C,0x04,0xE0,0x0D,0x07,0xE0,0xFF,0x07,0xC0,0xFF,0x07,0x00,0xFF,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,  // 0x24
+    0x07,0xC0,0x07,0x0E,0xE0,0x0F,0x1C,0x70,0x1C,0x38,0x38,0x38,0x38,0x38,0x38,0x70,0x38,0x38,0xE0,0x38,0x38,0xE0,0x38,0x38,0xC0,0x39,0x38,0x80,0x73,0x1C,0x00,0xE7,0x0F,0x00,0xC7,0x07,0x00,0x0E,0x00,0x00,0x1C,0x00,0xF8,0x38,0x00,0xFC,0x39,0x00,0x8E,0x73,0x00,0x07,0xE7,0x00,0x07,0xC7,0x01,0x07,0xC7,0x01,0x07,0x87,0x03,0x07,0x07,0x07,0x07,0x07,0x07,0x8E,0x03,0x0E,0xFC,0x01,0x1C,0xF8,0x00,0x38,  // 0x25
+    0x00,0x3E,0x00,0x80,0x7F,0x00,0x80,0xFF,0x00,0xC0,0xE3,0x01,0xC0,0xC1,0x01,0xC0,0xC1,0x01,0xC0,0xC1,0x01,0x80,0xC3,0x01,0x80,0xE7,0x00,0x00,0xFF,0x00,0x00,0xFC,0x00,0x00,0xF8,0x01,0x07,0xF8,0x07,0x07,0x38,0x0F,0x07,0x1C,0x1E,0x07,0x1E,0x1C,0x06,0x0F,0x38,0x0E,0x0F,0x38,0x8E,0x07,0x38,0xDC,0x03,0x38,0xFC,0x01,0x3C,0xF8,0x01,0x1E,0xF8,0x80,0x1F,0xFC,0xFF,0x0F,0xFC,0xFF,0x07,0x1E,0xFE,0x00,  // 0x26
+    0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,  // 0x27
+    0x18,0x00,0x00,0xF8,0x00,0x00,0xE0,0x03,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xE0,0x03,0x00,0xF8,0x00,0x00,0x18,0x00,0x00,  // 0x28
+    0x00,0x00,0x07,0x00,0xC0,0x07,0x00,0xF0,0x01,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0x00,0x06,  // 0x29
+    0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x30,0x1C,0x03,0xF8,0xC8,0x07,0xF8,0xE1,0x07,0xE0,0xE1,0x01,0x00,0x00,0x00,0x00,0x33,0x00,0x80,0x7F,0x00,0xC0,0xF3,0x00,0xE0,0xE1,0x01,0xE0,0xC0,0x01,0x80,0x40,0x00,  // 0x2A
+    0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0xFE,0xFF,0x0F,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,  // 0x2B
+    0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x30,0x00,  // 0x2C
+    0xF0,0xFF,0x03,0xF0,0xFF,0x03,0xF0,0xFF,0x03,  // 0x2D
+    0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,  // 0x2E
+    0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,  // 0x2F
+    0x00,0x3E,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x01,0xE0,0xC1,0x03,0xE0,0x80,0x03,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0xE0,0x80,0x03,0xE0,0xC1,0x03,0xC0,0xFF,0x01,0x80,0xFF,0x00,0x00,0x3E,0x00,  // 0x30
+    0x00,0x06,0x00,0x00,0x3E,0x00,0x00,0xFE,0x01,0x00,0xFE,0x07,0x00,0x8E,0x07,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0xFC,0xFF,0x07,0xFC,0xFF,0x07,0xFC,0xFF,0x07,  // 0x31
+    0x00,0x7E,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0x83,0x03,0xE0,0x01,0x02,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x07,0xE0,0xFF,0x07,0xE0,0xFF,0x07,0xE0,0xFF,0x07,  // 0x32
+    0x00,0xFE,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x03,0xE0,0x03,0x03,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x07,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x80,0xFF,0x00,0xC0,0x07,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x03,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFE,0x01,  // 0x33
+    0xC0,0x01,0x00,0xC0,0x03,0x00,0xC0,0x07,0x00,0xC0,0x07,0x00,0xC0,0x0F,0x00,0xC0,0x1D,0x00,0xC0,0x1D,0x00,0xC0,0x39,0x00,0xC0,0x71,0x00,0xC0,0x71,0x00,0xC0,0xE1,0x00,0xC0,0xC1,0x01,0xC0,0x81,0x03,0xC0,0x81,0x03,0xC0,0x01,0x07,0xC0,0x01,0x0E,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,  // 0x34
+    0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xFC,0x01,0x00,0xFF,0x01,0x80,0xFF,0x01,0xC0,0x07,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x83,0x01,0x80,0xFF,0x01,0x00,0xFF,0x01,0x00,0xFC,0x00,  // 0x35
+    0xC0,0x0F,0x00,0xF0,0x3F,0x00,0xF0,0x7F,0x00,0x30,0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x1F,0x07,0xC0,0x3F,0x07,0xE0,0x7F,0x07,0xF0,0xE1,0x07,0x70,0x80,0x07,0x78,0x80,0x07,0x38,0x80,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x80,0x03,0x38,0x80,0x03,0x70,0xC0,0x03,0xF0,0xE0,0x01,0xE0,0xFF,0x00,0xC0,0x7F,0x00,0x00,0x3F,0x00,  // 0x36
+    0xFC,0xFF,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x03,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,  // 0x37
+    0x80,0x3F,0x00,0xC0,0xFF,0x00,0xE0,0xFF,0x01,0xF0,0xC1,0x01,0x70,0x80,0x03,0x70,0x80,0x03,0x70,0x80,0x03,0x70,0xC0,0x03,0xE0,0xC0,0x01,0xC0,0xF1,0x01,0x80,0xFB,0x00,0x00,0x7F,0x00,0x80,0x7F,0x00,0xC0,0xEF,0x01,0xE0,0xC3,0x01,0xF0,0x81,0x03,0x78,0x00,0x07,0x78,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x78,0x80,0x07,0xF0,0xE0,0x03,0xE0,0xFF,0x01,0xC0,0xFF,0x00,0x00,0x3F,0x00,  // 0x38
+    0x00,0x3F,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x01,0xE0,0xC1,0x03,0xF0,0x80,0x03,0x70,0x00,0x07,0x70,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x78,0x00,0x07,0x78,0x80,0x07,0xF8,0x80,0x03,0xF8,0xE1,0x03,0xB8,0xFF,0x01,0x38,0xFF,0x00,0x38,0x7E,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0x03,0x80,0xFF,0x03,0x00,0xFF,0x03,0x00,0xFC,0x00,  // 0x39
+    0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,  // 0x3A
+    0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x30,0x00,  // 0x3B
+    0x04,0x00,0x00,0x1C,0x00,0x00,0x7C,0x00,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,0x3E,0x00,0x00,0xF8,0x00,0x00,0xF0,0x03,0x00,0xC0,0x0F,0x00,0xE0,0x03,0x00,0xF8,0x00,0x00,0x3E,0x00,0x80,0x0F,0x00,0xE0,0x07,0x00,0xF8,0x01,0x00,0x7C,0x00,0x00,0x1C,0x00,0x00,0x04,0x00,0x00,  // 0x3C
+    0xFC,0xFF,0x0F,0xFC,0xFF,0x0F,0xFC,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x0F,0xFC,0xFF,0x0F,0xFC,0xFF,0x0F,  // 0x3D
+    0x00,0x00,0x08,0x00,0x00,0x0E,0x00,0x80,0x0F,0x00,0xE0,0x07,0x00,0xF8,0x01,0x00,0x7C,0x00,0x00,0x1F,0x00,0xC0,0x07,0x00,0xF0,0x03,0x00,0xFC,0x00,0x00,0xF0,0x01,0x00,0xC0,0x07,0x00,0x00,0x1F,0x00,0x00,0x7C,0x00,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,0x0E,0x00,0x00,0x08,  // 0x3E
+    0x00,0xFF,0x01,0xE0,0xFF,0x07,0xF0,0xFF,0x07,0xF8,0x00,0x07,0x78,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,  // 0x3F
+    0xC0,0x1F,0x00,0xF0,0x7F,0x00,0x78,0xF0,0x00,0x38,0xC0,0x01,0x1C,0x80,0x03,0xFC,0x03,0x07,0xFC,0x07,0x07,0x1C,0x0E,0x0E,0x1C,0x1C,0x0E,0x1C,0x1C,0x1E,0x1C,0x18,0x1C,0x1C,0x38,0x1C,0x3C,0x38,0x1C,0x3C,0x38,0x1C,0x7C,0x38,0x1C,0x7C,0x38,0x1C,0xDC,0x38,0x1C,0xDC,0x3D,0x1C,0x9C,0x1F,0x0E,0x9F,0x1F,0x0E,0x1F,0x0F,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x60,0xE0,0x01,0xE0,0xFF,0x00,0x80,0x3F,0x00,  // 0x40
+    0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x77,0x00,0x80,0x77,0x00,0x80,0xE3,0x00,0xC0,0xE3,0x00,0xC0,0xE1,0x00,0xC0,0xC1,0x01,0xE0,0xC1,0x01,0xE0,0x80,0x03,0xF0,0x80,0x03,0x70,0x80,0x03,0xF0,0xFF,0x07,0xF8,0xFF,0x07,0xF8,0xFF,0x07,0x3C,0x00,0x0E,0x1C,0x00,0x0E,0x1E,0x00,0x1E,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x07,0x00,0x38,  // 0x41
+    0x00,0xFF,0x07,0xC0,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x01,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0xE0,0x00,0x07,0xE0,0x03,0x07,0x80,0xFF,0x07,0x00,0xFE,0x07,0xC0,0xFF,0x07,0xE0,0x03,0x07,0xF0,0x00,0x07,0x78,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0xF0,0x00,0x07,0xF0,0xFF,0x07,0xE0,0xFF,0x07,0x80,0xFF,0x07,  // 0x42
+    0xF8,0x0F,0x00,0xFE,0x3F,0x00,0xFE,0xFF,0x00,0x0E,0xF8,0x01,0x00,0xE0,0x03,0x00,0x80,0x03,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x07,0x00,0xE0,0x03,0x0E,0xF8,0x01,0xFE,0xFF,0x00,0xFE,0x3F,0x00,0xF0,0x0F,0x00,  // 0x43
+    0x00,0xFC,0x0F,0x80,0xFF,0x0F,0xC0,0xFF,0x0F,0xE0,0x03,0x0E,0xF0,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x78,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0xF0,0x00,0x0E,0xE0,0x01,0x0E,0xE0,0x07,0x0E,0xC0,0xFF,0x0F,0x00,0xFF,0x0F,0x00,0xFC,0x0F,  // 0x44
+    0xF8,0xFF,0x03,0xF8,0xFF,0x03,0xF8,0xFF,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x03,  // 0x45
+    0xFC,0xFF,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0xF0,0xFF,0x03,0xF0,0xFF,0x03,0xF0,0xFF,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,  // 0x46
+    0xF0,0x1F,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x01,0x1C,0xF0,0x03,0x00,0xC0,0x07,0x00,0x00,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0xFC,0x03,0x1C,0xFC,0x03,0x1C,0xFC,0x03,0x1C,0x1C,0x00,0x1E,0x1C,0x00,0x0E,0x1C,0x00,0x0F,0x1C,0x80,0x0F,0x1C,0xC0,0x07,0x1C,0xF8,0x03,0xFC,0xFF,0x01,0xFC,0x7F,0x00,0xF0,0x1F,0x00,  // 0x47
+    0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0xF8,0xFF,0x07,0xF8,0xFF,0x07,0xF8,0xFF,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,  // 0x48
+    0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,  // 0x49
+    0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x07,0x04,0x00,0xFF,0x07,0x00,0xFE,0x07,0x00,0xF8,0x03,  // 0x4A
+    0x78,0x00,0x07,0xF0,0x00,0x07,0xE0,0x01,0x07,0xC0,0x03,0x07,0x80,0x07,0x07,0x00,0x07,0x07,0x00,0x0F,0x07,0x00,0x1E,0x07,0x00,0x3C,0x07,0x00,0x78,0x07,0x00,0x70,0x07,0x00,0xF8,0x07,0x00,0x78,0x07,0x00,0x3C,0x07,0x00,0x1E,0x07,0x00,0x0F,0x07,0x80,0x07,0x07,0xC0,0x03,0x07,0xE0,0x01,0x07,0xF0,0x00,0x07,0x78,0x00,0x07,0x3C,0x00,0x07,0x3E,0x00,0x07,  // 0x4B
+    0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x03,0xFC,0xFF,0x03,  // 0x4C
+    0x3E,0x80,0x0F,0x3E,0x80,0x0F,0x3E,0xC0,0x0F,0x7E,0xC0,0x0F,0x7E,0xC0,0x0F,0x6E,0xE0,0x0E,0xEE,0xE0,0x0E,0xEE,0xE0,0x0E,0xCE,0x70,0x0E,0xCE,0x71,0x0E,0x8E,0x71,0x0E,0x8E,0x39,0x0E,0x8E,0x3B,0x0E,0x0E,0x3B,0x0E,0x0E,0x1F,0x0E,0x0E,0x1F,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x0E,  // 0x4D
+    0x1C,0x80,0x07,0x1C,0x80,0x07,0x1C,0xC0,0x07,0x1C,0xE0,0x07,0x1C,0xE0,0x07,0x1C,0xF0,0x07,0x1C,0x70,0x07,0x1C,0x38,0x07,0x1C,0x3C,0x07,0x1C,0x1C,0x07,0x1C,0x1E,0x07,0x1C,0x0E,0x07,0x1C,0x0F,0x07,0x1C,0x07,0x07,0x9C,0x03,0x07,0xDC,0x03,0x07,0xDC,0x01,0x07,0xFC,0x01,0x07,0xFC,0x00,0x07,0x7C,0x00,0x07,0x7C,0x00,0x07,0x3C,0x00,0x07,0x3C,0x00,0x07,  // 0x4E
+    0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0x70,0x00,0x07,0x38,0x00,0x0E,0x38,0x00,0x0E,0x3C,0x00,0x1E,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x3C,0x00,0x1E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x70,0x00,0x07,0xF0,0xC1,0x07,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x00,0x7F,0x00,  // 0x4F
+    0xC0,0xFF,0x03,0xF0,0xFF,0x03,0xF8,0xFF,0x03,0x78,0x80,0x03,0x3C,0x80,0x03,0x1C,0x80,0x03,0x1C,0x80,0x03,0x1C,0x80,0x03,0x1C,0x80,0x03,0x38,0x80,0x03,0xF8,0x80,0x03,0xF0,0xFF,0x03,0xC0,0xFF,0x03,0x00,0xFF,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,  // 0x50
+    0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0x70,0x00,0x07,0x38,0x00,0x0E,0x38,0x00,0x0E,0x3C,0x00,0x1E,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x38,0x00,0x1E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x70,0x00,0x07,0xF0,0xC1,0x07,0xE0,0xFF,0x03,0x80,0xFF,0x00,0x80,0x7F,0x00,0xE0,0x01,0x00,0xFC,0x00,0x00,0x7F,0x00,0x00,0x1E,0x00,0x00,0x04,0x00,0x00,  // 0x51
+    0x00,0xFE,0x07,0x80,0xFF,0x07,0xC0,0xFF,0x07,0xE0,0x03,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x00,0x07,0xE0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x07,0x07,0x80,0xFF,0x07,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0x0F,0x07,0x00,0x0F,0x07,0x80,0x07,0x07,0xC0,0x03,0x07,0xE0,0x01,0x07,0xF0,0x00,0x07,0x70,0x00,0x07,0x78,0x00,0x07,0x3C,0x00,0x07,  // 0x52
+    0x80,0x7F,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x03,0x70,0xC0,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0xC0,0x07,0x00,0xF8,0x03,0x00,0xFF,0x01,0xC0,0x7F,0x00,0xE0,0x0F,0x00,0xF0,0x03,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x78,0x00,0x04,0xF0,0x80,0x07,0xE0,0xFF,0x07,0xC0,0xFF,0x07,0x00,0xFF,0x00,  // 0x53
+    0xFE,0xFF,0x3F,0xFE,0xFF,0x3F,0xFE,0xFF,0x3F,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,  // 0x54
+    0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x78,0x80,0x07,0x70,0x80,0x03,0xF0,0xC1,0x03,0xE0,0xFF,0x01,0xC0,0xFF,0x00,0x00,0x3F,0x00,  // 0x55
+    0x07,0x00,0x3C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x1C,0x00,0x1E,0x1C,0x00,0x0E,0x3C,0x00,0x0F,0x38,0x00,0x07,0x38,0x00,0x07,0x70,0x80,0x07,0x70,0x80,0x03,0xE0,0xC0,0x03,0xE0,0xC0,0x03,0xE0,0xC1,0x01,0xC0,0xE1,0x01,0xC0,0xE3,0x00,0x80,0xF3,0x00,0x80,0xF3,0x00,0x00,0x77,0x00,0x00,0x7F,0x00,0x00,0x3F,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,  // 0x56
+    0x07,0x00,0x38,0x07,0x00,0x38,0x07,0x00,0x38,0x06,0x00,0x1C,0x06,0x00,0x1C,0x0E,0x1E,0x1C,0x0E,0x1E,0x1C,0x0E,0x1E,0x1C,0x0E,0x1F,0x1C,0x0C,0x3F,0x1C,0x0C,0x3F,0x0E,0x0C,0x37,0x0E,0x9C,0x33,0x0E,0x9C,0x33,0x0E,0x9C,0x73,0x0E,0x98,0x73,0x0E,0xD8,0x61,0x07,0xD8,0x61,0x07,0xD8,0x61,0x07,0xF8,0xE1,0x07,0xF8,0xC0,0x07,0xF0,0xC0,0x07,0xF0,0xC0,0x07,  // 0x57
+    0x0F,0x00,0x1E,0x1E,0x00,0x0F,0x3C,0x80,0x07,0x78,0x80,0x03,0xF0,0xC0,0x03,0xE0,0xE0,0x01,0xE0,0xF1,0x00,0xC0,0x73,0x00,0x80,0x7F,0x00,0x00,0x3F,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x3F,0x00,0x80,0x7F,0x00,0xC0,0x73,0x00,0xC0,0xE1,0x00,0xE0,0xE1,0x01,0xF0,0xC0,0x03,0x78,0x80,0x03,0x38,0x00,0x07,0x3C,0x00,0x0E,0x1E,0x00,0x1E,0x0F,0x00,0x3C,  // 0x58
+    0x0F,0x00,0x1E,0x0E,0x00,0x0F,0x1C,0x80,0x07,0x3C,0x80,0x07,0x38,0xC0,0x03,0x70,0xC0,0x01,0xF0,0xE0,0x01,0xE0,0xF0,0x00,0xC0,0x71,0x00,0xC0,0x7B,0x00,0x80,0x3F,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,  // 0x59
+    0xFC,0xFF,0x07,0xFC,0xFF,0x07,0xFC,0xFF,0x07,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0F,0xFC,0xFF,0x0F,0xFC,0xFF,0x0F,0xFC,0xFF,0x0F,  // 0x5A
+    0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,  // 0x5B
+    0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,  // 0x5C
+    0x00,0xFF,0x07,0x00,0xFF,0x07,0x00,0xFF,0x07,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0xFF,0x07,0x00,0xFF,0x07,0x00,0xFF,0x07,  // 0x5D
+    0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x80,0x63,0x00,0x80,0xE3,0x00,0xC0,0xE1,0x00,0xC0,0xC1,0x01,0xE0,0xC0,0x01,0xE0,0x80,0x01,0x70,0x80,0x03,0x70,0x80,0x03,0x70,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x1C,0x00,0x0E,  // 0x5E
+    0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,0xFF,0xFF,0x3F,  // 0x5F
+    0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x80,0x03,0x00,  // 0x60
+    0x00,0x7F,0x00,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xE0,0x81,0x03,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x7F,0x00,0xE0,0xFF,0x01,0xE0,0xC0,0x03,0xE0,0x00,0x07,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x01,0x0E,0xE0,0x07,0x0F,0x7C,0xFF,0x07,0x7C,0xFE,0x03,0x3C,0xF8,0x01,  // 0x61
+    0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x80,0x0F,0x07,0xC0,0x3F,0x07,0xE0,0x7F,0x07,0xF0,0xE0,0x07,0x70,0xC0,0x07,0x78,0x80,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x70,0x00,0x07,0xF0,0x80,0x07,0xE0,0xE1,0x07,0xE0,0xFF,0x07,0xC0,0x7F,0x07,0x00,0x1F,0x06,  // 0x62
+    0xF0,0x0F,0x00,0xFC,0x7F,0x00,0xFC,0xFF,0x00,0x1C,0xF0,0x01,0x00,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x80,0x03,0x00,0xC0,0x03,0x0C,0xF0,0x01,0xFC,0xFF,0x00,0xFC,0x7F,0x00,0xF0,0x0F,0x00,  // 0x63
+    0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x7C,0x00,0x70,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xC3,0x03,0xF0,0x80,0x07,0x70,0x00,0x07,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0xF0,0x00,0x0F,0xF0,0x01,0x07,0xF0,0x83,0x07,0x70,0xFF,0x03,0x70,0xFE,0x01,0x70,0xF8,0x00,  // 0x64
+    0x00,0x3F,0x00,0xC0,0xFF,0x00,0xC0,0xFF,0x01,0xE0,0xC1,0x03,0xE0,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x0E,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x00,0x07,0x00,0x80,0x07,0x70,0xE0,0x03,0xF0,0xFF,0x03,0xF0,0xFF,0x00,0x80,0x3F,0x00,  // 0x65
+    0xFE,0x03,0x00,0xFF,0x0F,0x00,0xFF,0x1F,0x00,0x01,0x1E,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0xFE,0xFF,0x07,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,  // 0x66
+    0x70,0x7C,0x00,0x70,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xC3,0x03,0xF0,0x80,0x07,0x70,0x00,0x07,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0xF0,0x00,0x0F,0xF0,0x01,0x07,0xF0,0x83,0x07,0x70,0xFF,0x03,0x70,0xFE,0x01,0x70,0xF8,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x81,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFE,0x00,  // 0x67
+    0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x80,0x0F,0x07,0xE0,0x3F,0x07,0xE0,0x7F,0x07,0xF0,0xF0,0x07,0x70,0xC0,0x07,0x70,0x80,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,  // 0x68
+    0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,  // 0x69
+    0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x07,0x00,0x00,0x07,0x06,0x00,0xFF,0x07,0x00,0xFE,0x07,0x00,0xF8,0x01,  // 0x6A
+    0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x7C,0x80,0x03,0xF8,0x80,0x03,0xF0,0x81,0x03,0xE0,0x83,0x03,0xC0,0x87,0x03,0x80,0x8F,0x03,0x00,0x9F,0x03,0x00,0x9E,0x03,0x00,0xBC,0x03,0x00,0xF8,0x03,0x00,0xBC,0x03,0x00,0x9E,0x03,0x00,0x8F,0x03,0x80,0x87,0x03,0xC0,0x83,0x03,0xE0,0x81,0x03,0xF0,0x80,0x03,0x78,0x80,0x03,0x3C,0x80,0x03,  // 0x6B
+    0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0xFE,0x07,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,  // 0x6C
+    0x78,0x38,0x0E,0xF8,0x7C,0x0E,0xFC,0xFC,0x0E,0x9C,0xCF,0x0F,0x1C,0x8F,0x0F,0x1C,0x0F,0x0F,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,  // 0x6D
+    0x80,0x0F,0x07,0xE0,0x3F,0x07,0xE0,0x7F,0x07,0xF0,0xF0,0x07,0x70,0xC0,0x07,0x70,0x80,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,  // 0x6E
+    0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xC1,0x03,0xF0,0x80,0x07,0x70,0x00,0x07,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0E,0x70,0x00,0x07,0xF0,0x80,0x07,0xE0,0xC1,0x03,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x00,0x7F,0x00,  // 0x6F
+    0x80,0x0F,0x07,0xC0,0x3F,0x07,0xE0,0x7F,0x07,0xF0,0xE0,0x07,0x70,0xC0,0x07,0x78,0x80,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x70,0x00,0x07,0xF0,0x80,0x07,0xE0,0xE1,0x07,0xE0,0xFF,0x07,0xC0,0x7F,0x07,0x00,0x1F,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,  // 0x70
+    0x70,0x7E,0x00,0x70,0xFF,0x01,0xF0,0xFF,0x03,0xF0,0xC3,0x03,0xF0,0x80,0x07,0x70,0x00,0x07,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0xF0,0x00,0x0F,0xF0,0x01,0x07,0xF0,0x83,0x07,0x70,0xFF,0x03,0x70,0xFE,0x01,0x70,0xF8,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,  // 0x71
+    0xF8,0xC3,0x01,0xF8,0xCF,0x01,0xF8,0xDF,0x01,0x38,0xFC,0x01,0x38,0xF0,0x01,0x38,0xE0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,  // 0x72
+    0x80,0x3F,0x00,0xE0,0xFF,0x00,0xE0,0xFF,0x01,0x60,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x03,0x00,0xF8,0x01,0x00,0xFF,0x00,0xC0,0x7F,0x00,0xE0,0x0F,0x00,0xF0,0x01,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x02,0xF0,0x81,0x03,0xE0,0xFF,0x03,0xC0,0xFF,0x03,0x00,0x7F,0x00,  // 0x73
+    0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x7C,0x00,0xF8,0x3F,0x00,0xF8,0x3F,0x00,0xF8,0x0F,0x00,  // 0x74
+    0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0xF0,0x00,0x07,0xF0,0x01,0x07,0xF0,0x87,0x07,0x70,0xFF,0x03,0x70,0xFE,0x03,0x70,0xF8,0x00,  // 0x75
+    0x1E,0x00,0x1C,0x1C,0x00,0x0E,0x1C,0x00,0x0E,0x38,0x00,0x0F,0x38,0x00,0x07,0x70,0x80,0x07,0x70,0x80,0x03,0xE0,0x80,0x03,0xE0,0xC0,0x01,0xE0,0xC1,0x01,0xC0,0xE1,0x01,0xC0,0xE3,0x00,0x80,0xF3,0x00,0x80,0x73,0x00,0x00,0x77,0x00,0x00,0x3F,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,  // 0x76
+    0x07,0x00,0x38,0x07,0x00,0x3C,0x06,0x1E,0x3C,0x06,0x1E,0x1C,0x0E,0x1F,0x1C,0x0E,0x1F,0x1C,0x0E,0x3F,0x1C,0x0C,0x33,0x1E,0x8C,0x33,0x0E,0x9C,0x73,0x0E,0x9C,0x73,0x0E,0x9C,0x61,0x0E,0xD8,0x61,0x0F,0xD8,0xE1,0x07,0xD8,0xC1,0x07,0xF8,0xC0,0x07,0xF8,0xC0,0x07,0xF0,0xC0,0x07,0xF0,0x80,0x03,  // 0x77
+    0x3C,0x00,0x0F,0x38,0x80,0x07,0x70,0xC0,0x03,0xF0,0xE0,0x01,0xE0,0xE0,0x00,0xC0,0xF1,0x00,0xC0,0x7B,0x00,0x80,0x3F,0x00,0x00,0x1F,0x00,0x00,0x1F,0x00,0x00,0x3F,0x00,0x80,0x3F,0x00,0xC0,0x73,0x00,0xE0,0xF1,0x00,0xE0,0xE0,0x01,0xF0,0xC0,0x01,0x78,0x80,0x03,0x3C,0x80,0x07,0x1E,0x00,0x0F,  // 0x78
+    0x0E,0x00,0x1E,0x1C,0x00,0x0E,0x1C,0x00,0x0E,0x38,0x00,0x07,0x38,0x00,0x07,0x70,0x80,0x03,0x70,0x80,0x03,0x70,0xC0,0x03,0xE0,0xC0,0x01,0xE0,0xE0,0x01,0xC0,0xE1,0x00,0xC0,0xF1,0x00,0x80,0x73,0x00,0x80,0x73,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x0F,0x00,0xE0,0x0F,0x00,0x80,0x0F,  // 0x79
+    0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0x80,0x0F,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,0xF8,0xFF,0x0F,  // 0x7A
+    0xF0,0x03,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x3C,0x00,0x00,0xF8,0x03,0x00,0xE0,0x03,0x00,0xF8,0x03,0x00,0x3C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0xF0,0x0F,0x00,0xF0,0x07,0x00,0xF0,0x03,0x00,  // 0x7B
+    0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,  // 0x7C
+    0x00,0xF0,0x03,0x00,0xF8,0x03,0x00,0xFC,0x03,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0F,0x00,0xF0,0x07,0x00,0xF0,0x01,0x00,0xF0,0x07,0x00,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1E,0x00,0x00,0xFC,0x03,0x00,0xFC,0x03,0x00,0xF0,0x03,  // 0x7D
+    0x00,0xC0,0x03,0x06,0xF0,0x07,0x06,0xF8,0x0F,0x0E,0x3E,0x0C,0x0C,0x1F,0x1C,0xFC,0x07,0x18,0xF8,0x03,0x18,0xF0,0x00,0x00,  // 0x7E
+};
+
+#endif /* FONT_PACKED_H_ */
+// Close the Doxygen group.
+//! @}
@@ -1,5 +1,8 @@
 /*! \file image.h
  *  \brief header for image declare image struct
+ *  The images are generated by tools/imgconv.py. Pixels are RGB565 words in transfer byte order,
+ *  the upper byte of the color in the lower byte of the word, so they go to the display straight
+ *  from flash. Rows from top to bottom, every row from left to right as seen on the display.
  *  \date Jan 1, 2019
  *  \author Valentin Platzgummer
 */
@@ -10,14 +13,32 @@
 */
 #ifndef RESOURCES_IMAGE_H_
 #define RESOURCES_IMAGE_H_
+#include "common.h"
+
+//! \brief storage of the pixels of an image
+typedef enum imageEncoding {
+    IMAGE_RAW,      //!< one word per pixel
+    IMAGE_RLE,      //!< runs: 0x8000 | n followed by the word, literals: n followed by n words
+    IMAGE_PALETTE   //!< one byte per pixel, index into the palette
+} imageEncoding;
+//! \brief IMAGE_RLE header word of a run, the lower bits are the length
+#define IMAGE_RLE_RUN 0x8000
+//! \brief no transparent pixels for drawImage
+#define IMAGE_NO_KEY (-1)
+//! \brief transparency key for drawImage from 8 bit channels, rounded like tools/imgconv.py does
+#define IMAGE_KEY(red, green, blue) ((int32_t) (((red) & 0xF8) | ((green) >> 5) \
+                                                | (((green) & 0x1C) << 3 | (blue) >> 3) << 8))
 
 //! \brief image struct for use with oled 96x96
 typedef const struct image {
-    unsigned char       width;      ///< width in pixels of image
-    unsigned char       height;     ///< height in pixels of image
-    unsigned char       bytes_per_pixel; ///< Bytes per pixels 2:RGB16, 3:RGB, 4:RGBA */
-    char          *comment;         ///< name of image
-    unsigned char *pixel_data;      ///< image data ascii format octal, coded bitmap
+    uint8_t width;              ///< width in pixels of image
+    uint8_t height;             ///< height in pixels of image
+    uint8_t encoding;           ///< imageEncoding of the data
+    uint16_t paletteSize;       ///< colors in the palette, IMAGE_PALETTE only
+    const char *comment;        ///< name of image
+    const uint16_t *palette;    ///< colors in transfer byte order, IMAGE_PALETTE only
+    const void *data;           ///< pixels, words for IMAGE_RAW and IMAGE_RLE, bytes for IMAGE_PALETTE
+    uint16_t length;            ///< length of data in words, bytes for IMAGE_PALETTE
 } image;
 #endif /* RESOURCES_IMAGE_H_ */
 
@@ -1,1227 +1,607 @@
-/* GIMP RGBA C-Source image dump (logo.c) */
+/*! \file logo.c
+ * \brief images of the display, generated by tools/imgconv.py, do not edit
+ * The encoding of the arrays is described in image.h.
+ */
 #include "image.h"
 //! \addtogroup group_oled_res
 //! @{
-/*! brief logo in bitmap format with all necessary data
- * \param logo_image struct defined in image.h
- */
+
+static const uint16_t logoImageData[] = {
+    0x0060,0x120B,0x4FFF,0x130B,0x4FFF,0x120C,0x4FFF,0x130B,0x4FFF,0x120C,0x4EFF,0x120B,
+    0x4FFF,0x120B,0x4FFF,0x130B,0x4EFF,0x130B,0x4FFF,0x120B,0x4FFF,0x130C,0x4FFF,0x130B,
+    0x4EFF,0x120B,0x4FFF,0x120B,0x4FFF,0x120B,0x4FFF,0x120B,0x4EFF,0x120C,0x4FFF,0x120B,
+    0x4EFF,0x130B,0x4FFF,0x120B,0x4FFF,0x120B,0x4FFF,0x120B,0x4EFF,0x120B,0x4FFF,0x120B,
+    0x4EFF,0x120B,0x4FFF,0x120C,0x4FFF,0x120C,0x4FFF,0x130B,0x4EFF,0x130B,0x4FFF,0x120B,
+    0x4EFF,0x120B,0x4FFF,0x130B,0x4FFF,0x120B,0x4FFF,0x120C,0x4FFF,0x130C,0x4EFF,0x120B,
+    0x4FFF,0x130B,0x4FFF,0x130B,0x4FFF,0x120B,0x4FFF,0x120B,0x4FFF,0x120B,0x4FFF,0x130B,
+    0x4FFF,0x130B,0x4FFF,0x120B,0x4FFF,0x130B,0x4FFF,0x130B,0x4FFF,0x120B,0x4EFF,0x120B,
+    0x4EFF,0x8160,0x1500,0x0001,0x1400,0x8008,0x1500,0x8003,0x1400,0x0004,0x1500,0x1500,
+    0x1400,0x1500,0x8003,0x1400,0x0001,0x1500,0x8006,0x1400,0x000A,0x1500,0x1400,0x1500,
+    0x1500,0x1400,0x1400,0x1500,0x1500,0x1400,0x1400,0x8005,0x1500,0x0009,0x1400,0x1500,
+    0x1500,0x1400,0x1400,0x1500,0x1500,0x1400,0x1500,0x8004,0x1400,0x0007,0x1500,0x1500,
+    0x1400,0x1500,0x1400,0x1500,0x1500,0x8003,0x1400,0x0001,0x1500,0x81B4,0x1400,0x0007,
+    0x3442,0x768C,0x77AD,0xF7BD,0x97B5,0xB694,0xB431,0x8059,0x1400,0x0008,0x57AD,0x97B5,
+    0x556B,0x5429,0xF55A,0x97B5,0x97B5,0x3421,0x8035,0x1400,0x0001,0x1300,0x8011,0x1400,
+    0x8003,0x1300,0x0003,0x1400,0x1300,0x1300,0x8005,0x1400,0x0003,0x1300,0x1400,0x1300,
+    0x8003,0x1400,0x0002,0x558C,0x5429,0x8003,0x1400,0x0005,0x1463,0xF7BD,0xD57B,0x1400,
+    0x1300,0x8004,0x1400,0x0003,0x1300,0x1400,0x1300,0x8003,0x1400,0x8003,0x1300,0x0001,
+    0x1400,0x8004,0x1300,0x0007,0x1400,0x1300,0x1300,0x1400,0x1300,0x1400,0x1400,0x8004,
+    0x1300,0x0002,0x1400,0x1400,0x803C,0x1300,0x0003,0x1442,0xF7BD,0x568C,0x805D,0x1300,
+    0x0003,0xD57B,0xF7BD,0xD57B,0x805C,0x1300,0x0004,0xD339,0xB7B5,0xB7B5,0x3329,0x805B,
+    0x1300,0x0004,0xF318,0x56AD,0xF7BD,0x3463,0x805B,0x1300,0x0004,0x7310,0xF69C,0xF7BD,
+    0xB573,0x8013,0x1300,0x000A,0x3342,0x3584,0x36A5,0xB7B5,0xF7BD,0xF7BD,0xD7BD,0x57AD,
+    0x758C,0x534A,0x8009,0x1300,0x000A,0xB331,0xF57B,0x16A5,0x97B5,0xD7BD,0xF7BD,0xB7B5,
+    0x57AD,0x558C,0x9452,0x802C,0x1300,0x0003,0x9594,0xF7BD,0x1584,0x800A,0x1300,0x0001,
+    0xF339,0x8004,0xF7BD,0x0005,0x57AD,0x1300,0x1300,0xB339,0xD69C,0x800A,0xF7BD,0x0002,
+    0x9594,0xD318,0x8005,0x1300,0x0003,0xF318,0x758C,0xD7BD,0x8009,0xF7BD,0x0002,0x9594,
+    0x3321,0x8009,0x1300,0x0001,0xF45A,0x8004,0xF7BD,0x0002,0xD7BD,0xD318,0x8009,0x1300,
+    0x0009,0x1200,0x1200,0x1300,0x1300,0x1200,0x1200,0x1300,0x5329,0xD7BD,0x8004,0xF7BD,
+    0x0007,0x9352,0x1200,0x1200,0x558C,0xF7BD,0x558C,0x1200,0x8003,0x1300,0x8003,0x1200,
+    0x0005,0x1300,0x1300,0x1200,0x1300,0xF339,0x8004,0xF7BD,0x0004,0x56AD,0x1300,0xB452,
+    0xB7B5,0x800C,0xF7BD,0x0002,0x56AD,0x3321,0x8003,0x1200,0x0002,0x3342,0x77AD,0x800C,
+    0xF7BD,0x0002,0x56AD,0x5329,0x8009,0x1200,0x0001,0x97B5,0x8004,0xF7BD,0x0002,0x746B,
+    0x3200,0x800C,0x1200,0x0004,0x3200,0x1200,0x1200,0xB473,0x8004,0xF7BD,0x0006,0x76AD,
+    0x1200,0x1200,0xF57B,0xF7BD,0x9594,0x800C,0x1200,0x0001,0xF339,0x8004,0xF7BD,0x0003,
+    0x56AD,0x734A,0xD7BD,0x800E,0xF7BD,0x0005,0x16A5,0x1200,0x1200,0x3342,0xB7B5,0x800E,
+    0xF7BD,0x0001,0xF69C,0x8005,0x1200,0x0005,0x3200,0x1200,0x3200,0x1200,0x558C,0x8004,
+    0xF7BD,0x0003,0xF69C,0x1200,0x3200,0x8007,0x1200,0x0001,0x3200,0x8004,0x1200,0x0003,
+    0x3200,0x1200,0x36A5,0x8004,0xF7BD,0x0004,0x1584,0x1200,0x3200,0x97B5,0x8006,0xF7BD,
+    0x0004,0xB594,0x1200,0x1200,0x3200,0x8004,0x1200,0x0001,0xF339,0x8004,0xF7BD,0x0002,
+    0x77AD,0x77AD,0x8003,0xF7BD,0x0007,0x16A5,0xB473,0x534A,0x5229,0x9331,0xD35A,0x758C,
+    0x8006,0xF7BD,0x0003,0x9473,0xF220,0x77AD,0x8003,0xF7BD,0x0008,0x56AD,0xF57B,0x734A,
+    0x9331,0x5229,0x9352,0x3584,0xD7BD,0x8005,0xF7BD,0x0001,0x546B,0x8003,0x1200,0x0001,
+    0x3200,0x8004,0x1200,0x0002,0x3342,0xF8BD,0x8004,0xF7BD,0x0004,0xB231,0x1200,0x1200,
+    0x3200,0x8008,0x1200,0x0004,0x3200,0x1200,0x1200,0xF339,0x8005,0xF7BD,0x0009,0xB239,
+    0x1200,0x1200,0x3200,0x1200,0x3200,0x1200,0x1200,0x3200,0x8005,0x1200,0x0001,0x3200,
+    0x8003,0x1200,0x0001,0xF339,0x8007,0xF7BD,0x0003,0xD7BD,0x3463,0x3200,0x8004,0x1200,
+    0x0004,0x3200,0x3200,0x734A,0xB7B5,0x8004,0xF7BD,0x0002,0x77AD,0x758C,0x8003,0xF7BD,
+    0x0001,0xB473,0x8003,0x1200,0x0006,0x3200,0x3200,0x1200,0x3200,0xF339,0x97B5,0x8004,
+    0xF7BD,0x0002,0x56AD,0x1200,0x8004,0x3200,0x8003,0x1200,0x0002,0x3200,0x36A5,0x8004,
+    0xF7BD,0x0001,0xF47B,0x8004,0x3200,0x0001,0x1200,0x8009,0x3200,0x0001,0x3584,0x8004,
+    0xF7BD,0x0001,0x16A5,0x8004,0x3200,0x8003,0x1200,0x0001,0x3200,0x8003,0x1200,0x8004,
+    0x3200,0x0004,0x1200,0x3200,0x1200,0xF339,0x8006,0xF7BD,0x0003,0xD7BD,0x9352,0x1200,
+    0x8003,0x3200,0x8003,0x1200,0x0003,0x3200,0x3200,0x3463,0x8005,0xF7BD,0x0007,0xF8BD,
+    0xF7BD,0xF7BD,0x1363,0x1200,0x1200,0x3200,0x8003,0x1200,0x0004,0x3200,0x3200,0x1200,
+    0x9352,0x8005,0xF7BD,0x0002,0x734A,0x1200,0x8007,0x3200,0x0001,0xD47B,0x8004,0xF7BD,
+    0x0003,0x56AD,0x3200,0x1200,0x8004,0x3200,0x8003,0x1200,0x8005,0x3200,0x0001,0x77AD,
+    0x8004,0xF7BD,0x0001,0x9473,0x8008,0x3200,0x8005,0x1200,0x0006,0x3200,0x1200,0x1200,
+    0x3200,0x3200,0xF341,0x8006,0xF7BD,0x0006,0xB473,0x3200,0x1200,0x3200,0x3200,0x1200,
+    0x8006,0x3200,0x0001,0x56AD,0x8006,0xF7BD,0x0001,0x3584,0x8006,0x3200,0x0001,0x1200,
+    0x8004,0x3200,0x0001,0xF69C,0x8004,0xF7BD,0x0001,0x3584,0x8004,0x3200,0x0006,0x1200,
+    0x3200,0x3200,0x1200,0x3221,0xD7BD,0x8004,0xF7BD,0x0003,0x534A,0x3200,0x1200,0x8003,
+    0x3200,0x0001,0x1200,0x8006,0x3200,0x0001,0xB352,0x8004,0xF7BD,0x0007,0xD7BD,0xF218,
+    0x3200,0x3200,0x1200,0x3200,0x3200,0x8003,0x1200,0x0005,0x3200,0x1200,0x3200,0x3200,
+    0x1200,0x8003,0x3200,0x0003,0x1200,0x3200,0xF241,0x8005,0xF7BD,0x0001,0x76AD,0x8005,
+    0x3200,0x0001,0x1200,0x8006,0x3200,0x0001,0x3484,0x8005,0xF7BD,0x0002,0xB7B5,0xF218,
+    0x8005,0x3200,0x0001,0x1200,0x8005,0x3200,0x0001,0x9473,0x8004,0xF7BD,0x0001,0xF69C,
+    0x8009,0x3200,0x0001,0xD59C,0x8004,0xF7BD,0x0004,0x758C,0x3200,0x3200,0x1200,0x8006,
+    0x3200,0x0004,0x1100,0x3200,0x3200,0x9594,0x8004,0xF7BD,0x0002,0xB594,0x3100,0x8004,
+    0x3200,0x0003,0x3100,0x3200,0x3200,0x8003,0x3100,0x0001,0x3200,0x8003,0x3100,0x0005,
+    0x3200,0x3100,0x3200,0x3200,0xF241,0x8005,0xF7BD,0x000A,0xF47B,0x1100,0x3200,0x3200,
+    0x3100,0x3200,0x3200,0x1100,0x3100,0x3200,0x8003,0x3100,0x0001,0x1363,0x8005,0xF7BD,
+    0x0001,0x758C,0x8003,0x3100,0x0003,0x3200,0x3100,0x3200,0x8004,0x3100,0x0003,0x3200,
+    0x1100,0x3242,0x8004,0xF7BD,0x0001,0x77AD,0x8009,0x3100,0x0001,0x3363,0x8004,0xF7BD,
+    0x0001,0xB7B5,0x800B,0x3100,0x0002,0x9110,0xB7B5,0x8004,0xF7BD,0x0001,0xF35A,0x8013,
+    0x3100,0x0001,0xF241,0x8005,0xF7BD,0x0001,0x524A,0x800C,0x3100,0x0001,0xF241,0x8005,
+    0xF7BD,0x0001,0x3363,0x800C,0x3100,0x0001,0x9110,0x8004,0xF7BD,0x0001,0xB7B5,0x8009,
+    0x3100,0x0002,0x9110,0xB7B5,0x8004,0xF7BD,0x0001,0x1363,0x800A,0x3100,0x0001,0x536B,
+    0x8004,0xF7BD,0x0001,0x97B5,0x8014,0x3100,0x0001,0xF241,0x8004,0xF7BD,0x0001,0xD7BD,
+    0x800D,0x3100,0x0001,0x5229,0x8005,0xF7BD,0x0001,0x9231,0x800D,0x3100,0x0001,0xD7BD,
+    0x8004,0xF7BD,0x800A,0x3100,0x0001,0x758C,0x8004,0xF7BD,0x0001,0xB59C,0x800A,0x3100,
+    0x0001,0xF69C,0x8004,0xF7BD,0x0001,0x548C,0x8014,0x3100,0x0001,0xF241,0x8004,0xF7BD,
+    0x0001,0x97B5,0x800E,0x3100,0x0001,0xF8BD,0x8004,0xF7BD,0x800E,0x3100,0x0001,0xB7B5,
+    0x8004,0xF7BD,0x0001,0x5108,0x8009,0x3100,0x0001,0x724A,0x8004,0xF7BD,0x0002,0xD7BD,
+    0xF120,0x8007,0x3100,0x0002,0x3108,0x7129,0x8004,0xF7BD,0x0002,0xF8BD,0x3242,0x8007,
+    0x3100,0x0002,0x3108,0x3108,0x800B,0x3100,0x0001,0xF241,0x8004,0xF7BD,0x0001,0x76AD,
+    0x8009,0x3100,0x0001,0x3108,0x8004,0x3100,0x8004,0xF7BD,0x0001,0xD7BD,0x8004,0x3100,
+    0x0007,0x3108,0x3100,0x3100,0x3108,0x3100,0x3100,0x3108,0x8003,0x3100,0x0001,0x97B5,
+    0x8004,0xF7BD,0x0001,0xD118,0x800A,0x3100,0x0001,0x56AD,0x8004,0xF7BD,0x0001,0xB373,
+    0x8008,0x3100,0x0001,0xD47B,0x8004,0xF7BD,0x0004,0x36A5,0x3100,0x3100,0x3108,0x8007,
+    0x3100,0x000C,0x3108,0x3108,0x3100,0x3108,0x3100,0x3100,0x3108,0x3100,0x3108,0x3100,
+    0x3100,0xF241,0x8004,0xF7BD,0x0001,0x56AD,0x8003,0x3100,0x0001,0x3108,0x8003,0x3100,
+    0x0002,0x3108,0x3100,0x8003,0x3108,0x0002,0x3100,0x3108,0x8004,0xF7BD,0x0001,0xB7B5,
+    0x8003,0x3100,0x0001,0x3108,0x8007,0x3100,0x0004,0x3108,0x3100,0x3108,0x97B5,0x8004,
+    0xF7BD,0x0001,0xD118,0x8007,0x3100,0x0004,0x3108,0x3100,0x3100,0xF47B,0x8004,0xF7BD,
+    0x0003,0x16A5,0x3108,0x3100,0x8004,0x3108,0x0003,0x3100,0x3108,0x36A5,0x8004,0xF7BD,
+    0x0002,0xD47B,0x3108,0x8005,0x3100,0x0001,0x3108,0x8005,0x3100,0x0002,0x3108,0x3108,
+    0x8004,0x3100,0x0004,0x3108,0x3100,0x3100,0xF141,0x8004,0xF7BD,0x0001,0x56AD,0x8004,
+    0x3100,0x8003,0x3108,0x0002,0x3100,0x3100,0x8003,0x3108,0x0002,0x3100,0x3108,0x8004,
+    0xF7BD,0x0003,0xB7B5,0x3108,0x3108,0x8003,0x3100,0x0001,0x3108,0x8005,0x3100,0x0004,
+    0x3108,0x3100,0x3108,0x97B5,0x8004,0xF7BD,0x0002,0xD118,0x3100,0x8009,0x3108,0x0001,
+    0xB131,0x8005,0xF7BD,0x0001,0xD139,0x8003,0x3100,0x0005,0x3108,0x3100,0x3100,0x3242,
+    0xF8BD,0x8003,0xF7BD,0x0004,0xD7BD,0x5129,0x3008,0x3100,0x8003,0x3108,0x0011,0x3008,
+    0x3100,0x3008,0x3108,0x3008,0x3108,0x3008,0x3000,0x3108,0x3108,0x3008,0x3008,0x3108,
+    0x3100,0x3008,0x3000,0xF141,0x8004,0xF7BD,0x0006,0x56AD,0x3108,0x3108,0x3008,0x3100,
+    0x3108,0x8003,0x3008,0x0006,0x3108,0x3000,0x3008,0x3008,0x3108,0x3008,0x8004,0xF7BD,
+    0x0002,0xB7B5,0x3108,0x8004,0x3008,0x0001,0x3108,0x8006,0x3008,0x0003,0x3108,0x3000,
+    0x97B5,0x8004,0xF7BD,0x0001,0xD118,0x8003,0x3008,0x0001,0x3000,0x8004,0x3008,0x0004,
+    0x3000,0x3008,0x3000,0x15A5,0x8004,0xF7BD,0x0001,0x1484,0x8006,0x3008,0x0001,0x548C,
+    0x8004,0xF7BD,0x0001,0xD59C,0x8003,0x3008,0x0001,0x3000,0x800F,0x3008,0x0004,0x3000,
+    0x3008,0x3000,0xF141,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x3008,0x8004,0xF7BD,0x0001,
+    0xB7B5,0x800E,0x3008,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xD018,0x800B,0x3008,0x0001,
+    0x736B,0x8004,0xF7BD,0x0001,0x76AD,0x8006,0x3008,0x0001,0x96B5,0x8004,0xF7BD,0x0001,
+    0x3263,0x8016,0x3008,0x0001,0xF141,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x3008,0x8004,
+    0xF7BD,0x0001,0xB7B5,0x800E,0x3008,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xD018,0x800B,
+    0x3008,0x0002,0xD018,0xD7BD,0x8004,0xF7BD,0x0001,0xB252,0x8004,0x3008,0x0001,0xF25A,
+    0x8004,0xF7BD,0x0002,0xB7B5,0x9010,0x8016,0x3008,0x0001,0xF141,0x8004,0xF7BD,0x0001,
+    0x56AD,0x800E,0x3008,0x8004,0xF7BD,0x0001,0xB7B5,0x800E,0x3008,0x0001,0x97B5,0x8004,
+    0xF7BD,0x0001,0xD018,0x800C,0x3008,0x0001,0x9594,0x8004,0xF7BD,0x0001,0x9494,0x8004,
+    0x3008,0x0001,0xB594,0x8004,0xF7BD,0x0001,0x748C,0x8017,0x3008,0x0001,0xF141,0x8004,
+    0xF7BD,0x0001,0x56AD,0x800E,0x3008,0x8004,0xF7BD,0x0001,0xB7B5,0x800E,0x3008,0x0001,
+    0x97B5,0x8004,0xF7BD,0x0001,0xD018,0x800C,0x3008,0x0001,0xD25A,0x8004,0xF7BD,0x0006,
+    0xB7B5,0x5008,0x3008,0x3008,0xF020,0xD7BD,0x8004,0xF7BD,0x0001,0x9152,0x8017,0x3008,
+    0x0001,0xF141,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x3008,0x8004,0xF7BD,0x0001,0xB7B5,
+    0x800E,0x3008,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xD018,0x800D,0x3008,0x0001,0x76AD,
+    0x8004,0xF7BD,0x0004,0x526B,0x3008,0x3008,0x726B,0x8004,0xF7BD,0x0001,0x56AD,0x8018,
+    0x3008,0x0001,0xF141,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x3008,0x8004,0xF7BD,0x0001,
+    0xB7B5,0x800E,0x3008,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xD018,0x800D,0x3008,0x0001,
+    0x3484,0x8004,0xF7BD,0x0004,0xF59C,0x3008,0x3008,0x15A5,0x8004,0xF7BD,0x000F,0x1384,
+    0x3008,0x3008,0x2F08,0x3008,0x3008,0x2F08,0x3008,0x3008,0x2F08,0x3008,0x3008,0x2F08,
+    0x3008,0x3008,0x8004,0x2F08,0x8006,0x3008,0x0001,0xF141,0x8004,0xF7BD,0x0001,0x56AD,
+    0x8005,0x3008,0x0002,0x2F08,0x3008,0x8003,0x2F08,0x0004,0x3008,0x2F08,0x2F08,0x3008,
+    0x8004,0xF7BD,0x000B,0xB7B5,0x3008,0x2F08,0x2F08,0x3008,0x3008,0x2F08,0x3008,0x2F08,
+    0x2F08,0x3008,0x8003,0x2F08,0x0002,0x3008,0x97B5,0x8004,0xF7BD,0x0001,0xD018,0x800D,
+    0x2F08,0x0001,0x1042,0x8004,0xF7BD,0x0003,0xD7BD,0x7029,0xB039,0x8005,0xF7BD,0x0001,
+    0xB031,0x8018,0x2F08,0x0001,0x1042,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x2F08,0x8004,
+    0xF7BD,0x0001,0xB7B5,0x800E,0x2F08,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xCF18,0x800E,
+    0x2F08,0x0001,0x36A5,0x8004,0xF7BD,0x0002,0xD37B,0xF383,0x8004,0xF7BD,0x0001,0x15A5,
+    0x8019,0x2F08,0x0001,0x1042,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x2F08,0x8004,0xF7BD,
+    0x0001,0xB7B5,0x800E,0x2F08,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xCF18,0x800E,0x2F08,
+    0x0001,0xB373,0x8004,0xF7BD,0x0002,0x36A5,0x56AD,0x8004,0xF7BD,0x0001,0x726B,0x8019,
+    0x2F08,0x0001,0x1042,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x2F08,0x8004,0xF7BD,0x0001,
+    0xB7B5,0x800E,0x2F08,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xCF18,0x800E,0x2F08,0x0002,
+    0x2F21,0xD7BD,0x8003,0xF7BD,0x0001,0xF8BD,0x8004,0xF7BD,0x0002,0xD7BD,0xEF20,0x8019,
+    0x2F08,0x0001,0x1042,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x2F08,0x8004,0xF7BD,0x0001,
+    0xB7B5,0x800E,0x2F08,0x0001,0x97B5,0x8004,0xF7BD,0x0001,0xCF18,0x800F,0x2F08,0x0001,
+    0xD59C,0x8008,0xF7BD,0x0001,0xB494,0x801A,0x2F08,0x0001,0x1042,0x8004,0xF7BD,0x0001,
+    0x56AD,0x800E,0x2F08,0x8004,0xF7BD,0x0001,0xB7B5,0x800E,0x2F08,0x0001,0x96B5,0x8004,
+    0xF7BD,0x0001,0xCF18,0x800F,0x2F08,0x0001,0x3163,0x8008,0xF7BD,0x0001,0xD15A,0x801A,
+    0x2F08,0x0001,0x1042,0x8004,0xF7BD,0x0001,0x56AD,0x800E,0x2F08,0x8004,0xF7BD,0x0001,
+    0xB7B5,0x800E,0x2F08,0x0001,0x96B5,0x8004,0xF7BD,0x0001,0xCF18,0x8010,0x2F08,0x0001,
+    0xB7B5,0x8006,0xF7BD,0x0001,0x96B5,0x8004,0x2F08,0x0002,0x2E08,0x2E08,0x8005,0x2F08,
+    0x8003,0x2E08,0x8004,0x2F08,0x0001,0x2E08,0x8003,0x2F08,0x0001,0x2E08,0x8004,0x2F08,
+    0x0001,0x1042,0x8004,0xF7BD,0x0005,0x56AD,0x2F08,0x2F08,0x2E08,0x2E08,0x8004,0x2F08,
+    0x0003,0x2E08,0x2F08,0x2F08,0x8003,0x2E08,0x8004,0xF7BD,0x0001,0xB7B5,0x8003,0x2F08,
+    0x8003,0x2E08,0x0001,0x2F08,0x8005,0x2E08,0x0003,0x2F08,0x2E08,0x96B5,0x8004,0xF7BD,
+    0x0001,0xCF18,0x8009,0x2E08,0x0001,0x2F08,0x8006,0x2E08,0x0001,0x748C,0x8006,0xF7BD,
+    0x0001,0x338C,0x810D,0x2E08,0x0002,0x4E08,0x4E08,0x8005,0x2E08,0x0001,0x4E08,0x8006,
+    0x2E08,0x0001,0x4E08,0x800F,0x2E08,0x0001,0x4E08,0x801E,0x2E08,0x0001,0x4E08,0x8004,
+    0x2E08,0x0001,0x4E08,0x8008,0x2E08,0x0003,0x4E08,0x2E08,0x2E08,0x8003,0x4E08,0x0003,
+    0x2E08,0x2E08,0x4E08,0x8003,0x2E08,0x0001,0x4E08,0x800C,0x2E08,0x0005,0x4E08,0x2E08,
+    0x4E08,0x2E08,0x4E08,0x8004,0x2E08,0x0001,0x4E08,0x8004,0x2E08,0x0001,0x4E08,0x8005,
+    0x2E08,0x0002,0x4E08,0x4E08,0x8008,0x2E08,0x0002,0x4E08,0x4E08,0x8004,0x2E08,0x0003,
+    0x4E08,0x2E08,0x4E08,0x8004,0x2E08,0x0009,0x4E08,0x2E08,0x2E08,0x4E08,0x2E08,0x4E08,
+    0x2E08,0x2E08,0x4E08,0x8004,0x2E08,0x0007,0x4E08,0x2E08,0x2E08,0x4E08,0x2E08,0x2E08,
+    0x4E08,0x8004,0x2E08,0x0003,0x4E08,0x2E08,0x2E08,0x8003,0x4E08,0x8003,0x2E08,0x0002,
+    0x4E08,0x4E08,0x8007,0x2E08,0x0003,0x4E08,0x2E08,0x4E08,0x8003,0x2E08,0x8003,0x4E08,
+    0x8008,0x2E08,0x8004,0x4E08,0x8003,0x2E08,0x8003,0x4E08,0x0004,0x2E08,0x4E08,0x2E08,
+    0x4E08,0x8008,0x2E08,0x0001,0x4E08,0x8009,0x2E08,0x0002,0x4E08,0x4E08,0x8003,0x2E08,
+    0x8004,0x4E08,0x0008,0x2E08,0x2E08,0x4E08,0x4E08,0x2E08,0x2E08,0x4E08,0x4E08,0x8005,
+    0x2E08,0x0005,0x4E08,0x2E08,0x2E08,0x4E08,0x4E08,0x8005,0x2E08,0x0002,0x4E08,0x4E08,
+    0x8004,0x2E08,0x0009,0x4E08,0x4E08,0x2E08,0x2E08,0x4E08,0x2E08,0x4E08,0x2E08,0x4E08,
+    0x8004,0x2E08,0x0001,0x4E08,0x8003,0x2E08,0x0001,0x4E08,0x8009,0x2E08,0x0002,0x4E08,
+    0x2E08,0x8003,0x4E08,0x8004,0x2E08,0x0001,0x2D08,0x8003,0x2E08,0x0004,0x2D08,0x4E08,
+    0x4D08,0x2E08,0x8003,0x4E08,0x0005,0x2E08,0x2E08,0x4E08,0x2E08,0x2D08,0x8003,0x4D08,
+    0x0001,0x2D08,0x8005,0x2E08,0x8003,0x4E08,0x000D,0x4D08,0x2E08,0x2E08,0x4E08,0x4D08,
+    0x2D08,0x4E08,0x4D08,0x4D08,0x2D08,0x4D08,0x4D08,0x2E08,0x8005,0x4E08,0x000A,0x2E08,
+    0x4E08,0x4E08,0x2E08,0x2E08,0x2D08,0x2E08,0x4D08,0x4E08,0x4E08,0x8003,0x4D08,0x0003,
+    0x4E08,0x4D08,0x2D08,0x8005,0x4D08,0x000A,0x2D08,0x4D08,0x2D08,0x2E08,0x4E08,0x4D08,
+    0x4D08,0x2D08,0x2D08,0x4D08,0x8003,0x2D08,0x0011,0x4D08,0x2D08,0x2D08,0x4D08,0x2D08,
+    0x4D08,0x4D08,0x2D08,0x2D08,0x4D08,0x2D08,0x4D08,0x4D08,0x2D08,0x4D08,0x2D08,0x2D08,
+    0x8004,0x4D08,0x0002,0x2D08,0x4D08,0x8003,0x2D08,0x0004,0x4D08,0x4D08,0x2D08,0x2D08,
+    0x8008,0x4D08,0x0003,0x2D08,0x4D08,0x4D08,0x8006,0x2D08,0x0005,0x4D08,0x2D08,0x2D08,
+    0x4D08,0x4D08,0x8005,0x2D08,0x0005,0x4D08,0x2D08,0x4D08,0x2D08,0x2D08,0x8005,0x4D08,
+    0x0003,0x2D08,0x4D08,0x2D08,0x8009,0x4D08,0x000D,0x2D08,0xB052,0x3384,0x15A5,0x96B5,
+    0xD7BD,0xF7BD,0xD7BD,0x96B5,0xF59C,0xD27B,0x4E29,0x2D08,0x800A,0x4D08,0x0001,0x2D08,
+    0x8004,0x4D08,0x0001,0x2D08,0x8006,0x4D08,0x8003,0x2D08,0x0003,0x4D08,0x4D08,0x2D08,
+    0x8004,0x4D08,0x0004,0x2D08,0x4D08,0x4D08,0x2D08,0x8003,0x4D08,0x000E,0x2D08,0x2D08,
+    0x4D08,0x4D08,0x2D08,0x4D08,0x2D08,0x4D08,0x4D08,0x2D08,0x2D08,0x4D08,0x4D08,0x2D08,
+    0x8005,0x4D08,0x0001,0x2D08,0x8008,0x4D08,0x0004,0x2D08,0x4D08,0x4D08,0x2D08,0x8003,
+    0x4D08,0x000A,0x2D08,0x4D08,0x4D08,0x2D08,0x2D08,0x4D08,0x4D08,0x6F4A,0x738C,0xB6B5,
+    0x800A,0xF7BD,0x0006,0xD7BD,0x1384,0x8D10,0x4D08,0x2D08,0x2D08,0x8005,0x4D08,0x0006,
+    0x2D08,0x2D08,0x4D08,0x2D08,0x4D08,0x2D08,0x800F,0x4D08,0x0001,0x2D08,0x8004,0x4D08,
+    0x0001,0x2D08,0x8006,0x4D08,0x0006,0x2D08,0x4D08,0x2D08,0x4D08,0x4D08,0x2D08,0x8007,
+    0x4D08,0x0001,0x2D08,0x8003,0x4D08,0x0001,0x2D08,0x8004,0x4D08,0x0001,0x2D08,0x8010,
+    0x4D08,0x0001,0xB6B5,0x800E,0xF7BD,0x0002,0x15A5,0xED18,0x804F,0x4D08,0x0001,0xB6B5,
+    0x8003,0xF7BD,0x0008,0x56AD,0x538C,0x1063,0x0E42,0xED18,0xEE39,0x716B,0x35A5,0x8004,
+    0xF7BD,0x0001,0x15A5,0x804F,0x4D08,0x0004,0xB6B5,0xF7BD,0xF59C,0xD05A,0x8008,0x4D08,
+    0x0001,0xF283,0x8004,0xF7BD,0x0001,0x9173,0x804E,0x4D08,0x0002,0xF59C,0xF05A,0x800B,
+    0x4D08,0x0001,0x9394,0x8003,0xF7BD,0x0001,0x55AD,0x800C,0x4D08,0x0002,0x4C08,0x4C08,
+    0x8009,0x4D08,0x0010,0x4C08,0x4D08,0x4D08,0x4C08,0x4D08,0x4D08,0x4C08,0x4D08,0x4C08,
+    0x4D08,0x4C08,0x4D08,0x4C08,0x4C08,0x4D08,0x4C08,0x800A,0x4D08,0x0001,0x4C08,0x8003,
+    0x4D08,0x0003,0x4C08,0x4D08,0x4D08,0x8003,0x4C08,0x8003,0x4D08,0x0007,0x4C08,0x4D08,
+    0x4C08,0x4C08,0x4D08,0x4D08,0x4C08,0x8005,0x4D08,0x8004,0x4C08,0x0005,0x4D08,0x4C08,
+    0x4D08,0x4C08,0x4C08,0x8003,0x4D08,0x0006,0x4C08,0x4C08,0x4D08,0x4C08,0x4D08,0x6D31,
+    0x8004,0xF7BD,0x0001,0xAD31,0x805B,0x4C08,0x0001,0x56AD,0x8003,0xF7BD,0x0001,0xCF5A,
+    0x805B,0x4C08,0x0001,0x15A5,0x8003,0xF7BD,0x0001,0x506B,0x805B,0x4C08,0x0001,0x76AD,
+    0x8003,0xF7BD,0x0001,0xEF5A,0x805A,0x4C08,0x0001,0xCD39,0x8004,0xF7BD,0x0001,0xAD31,
+    0x805A,0x4C08,0x0001,0x3284,0x8003,0xF7BD,0x0001,0x55AD,0x805A,0x4C08,0x0002,0xCD39,
+    0xD7BD,0x8003,0xF7BD,0x0001,0xF27B,0x800B,0x4C08,0x0003,0x4B08,0x4C08,0x4B08,0x8006,
+    0x4C08,0x0001,0x4B08,0x8003,0x4C08,0x000C,0x4C10,0x4C08,0x4B08,0x4C08,0x4B08,0x4B08,
+    0x4C10,0x4C08,0x4C08,0x4B10,0x4C08,0x4C10,0x8005,0x4C08,0x0001,0x4C10,0x800D,0x4C08,
+    0x000A,0x4B08,0x4C10,0x4B08,0x4C10,0x4C08,0x4B08,0x4C08,0x4B08,0x4C08,0x4B08,0x8004,
+    0x4C08,0x0002,0x4B08,0x4B10,0x8003,0x4B08,0x0007,0x4B10,0x4B08,0x4B08,0x4B10,0x4C10,
+    0x4B10,0x4C08,0x8003,0x4B10,0x0007,0x4C08,0x4B10,0x4B08,0x4B10,0x4B10,0x4B08,0x15A5,
+    0x8003,0xF7BD,0x0003,0x96B5,0xCC18,0x4B10,0x800D,0x4B08,0x0001,0x4B10,0x8006,0x4B08,
+    0x0002,0x4B10,0x4B10,0x8006,0x4B08,0x0004,0x4B10,0x4B08,0x4B10,0x4B10,0x8005,0x4B08,
+    0x0001,0x4B10,0x8003,0x4B08,0x0001,0x4B10,0x8004,0x4B08,0x0007,0x4B10,0x4B10,0x4B08,
+    0x4B10,0x4B08,0x4B08,0x4B10,0x8003,0x4B08,0x0002,0x4B10,0x4B08,0x8003,0x4B10,0x0002,
+    0x4B08,0x4B10,0x8004,0x4B08,0x000D,0x4B10,0x4B08,0x4B10,0x4B08,0x4B10,0x4B10,0x4B08,
+    0x4B10,0x4B08,0x4B10,0x4B08,0x4B10,0x4B10,0x8005,0x4B08,0x8003,0x4B10,0x0001,0x3284,
+    0x8004,0xF7BD,0x0001,0x0F63,0x8004,0x4B08,0x0003,0x4B10,0x4B08,0x4B08,0x8003,0x4B10,
+    0x000B,0x4B08,0x4B10,0x4B08,0x4B10,0x4B10,0x4B08,0x4B08,0x4B10,0x4B08,0x4B10,0x4B08,
+    0x8004,0x4B10,0x0004,0x4B08,0x4B08,0x4B10,0x4B08,0x8004,0x4B10,0x0004,0x4B08,0x4B08,
+    0x4B10,0x4B08,0x8004,0x4B10,0x8003,0x4B08,0x8004,0x4B10,0x8003,0x4B08,0x0008,0x4B10,
+    0x4B10,0x4B08,0x4B10,0x4B08,0x4B10,0x4B08,0x4B08,0x8004,0x4B10,0x0002,0x4B08,0x4B10,
+    0x8003,0x4B08,0x0003,0x4B10,0x4B10,0x4B08,0x8005,0x4B10,0x0002,0x4B08,0x4B08,0x8004,
+    0x4B10,0x0002,0x4B08,0x4B08,0x8004,0x4B10,0x0002,0x4B08,0x706B,0x8004,0xF7BD,0x0009,
+    0x528C,0x4B08,0x4B08,0x4B10,0x4B08,0x4B08,0x4B10,0x4B10,0x4B08,0x8004,0x4B10,0x0002,
+    0x4B08,0x4B08,0x8006,0x4B10,0x0002,0x4B08,0x4B08,0x8004,0x4B10,0x0004,0x4B08,0x4B10,
+    0x4B10,0x4B08,0x8003,0x4B10,0x0001,0x4B08,0x8005,0x4B10,0x0001,0x4B08,0x8005,0x4B10,
+    0x000C,0x4B08,0x4B10,0x4B08,0x4B10,0x4B08,0x4B10,0x4B08,0x4B08,0x4B10,0x4B08,0x4B10,
+    0x4B08,0x8009,0x4B10,0x0003,0x4B08,0x4B10,0x4B08,0x8009,0x4B10,0x0002,0x4B08,0x4B08,
+    0x8003,0x4B10,0x0007,0x4B08,0x4B10,0x4B10,0x4B08,0x4B10,0x4B10,0x0F63,0x8004,0xF7BD,
+    0x0005,0xD49C,0x8B18,0x4B08,0x4B10,0x4B08,0x800D,0x4B10,0x0001,0x4B08,0x801B,0x4B10,
+    0x0001,0x4B08,0x802B,0x4B10,0x0002,0xAE5A,0xD7BD,0x8003,0xF7BD,0x0002,0x15A5,0xCB18,
+    0x8058,0x4B10,0x0002,0x6E4A,0xB7B5,0x8003,0xF7BD,0x0002,0x55AD,0x0B21,0x8058,0x4B10,
+    0x0002,0x2D4A,0xB6B5,0x8003,0xF7BD,0x0002,0x55AD,0x6C31,0x801A,0x4B10,0x0002,0x4A10,
+    0x4A10,0x8005,0x4B10,0x0001,0x4A10,0x8003,0x4B10,0x0006,0x4A10,0x4B10,0x4A10,0x4A10,
+    0x4B10,0x4A10,0x800E,0x4B10,0x0001,0x4A10,0x800B,0x4B10,0x0015,0x4A10,0x4B10,0x4A10,
+    0x4B10,0x4A10,0x4A10,0x4B10,0x4A10,0x4B10,0x4A10,0x4B10,0x4B10,0x4A10,0x4B10,0x4A10,
+    0x4A10,0x4B10,0x4A10,0x4B10,0xEC39,0x96B5,0x8003,0xF7BD,0x0002,0x76AD,0xAC31,0x8058,
+    0x4A10,0x0002,0xCC39,0x96B5,0x8003,0xF7BD,0x0002,0x96B5,0xEC39,0x8058,0x4A10,0x0002,
+    0x6B31,0x55AD,0x8003,0xF7BD,0x0002,0xB6B5,0x0C42,0x8058,0x4A10,0x0002,0x2B29,0x35AD,
+    0x8003,0xF7BD,0x0002,0xB6B5,0x4D4A,0x8058,0x4A10,0x0002,0xCA20,0x15A5,0x8003,0xF7BD,
+    0x0002,0xB7B5,0x6D52,0x8058,0x4A10,0x0002,0x8A10,0xF49C,0x8003,0xF7BD,0x0002,0xD7BD,
+    0xCE5A,0x8059,0x4A10,0x0001,0xB394,0x8003,0xF7BD,0x0002,0xD7BD,0xEE5A,0x8023,0x4A10,
+    0x0003,0x4910,0x4A10,0x4910,0x8007,0x4A10,0x0005,0x4910,0x4A10,0x4910,0x4A10,0x4910,
+    0x8018,0x4A10,0x0001,0x4910,0x8008,0x4A10,0x0003,0x4910,0x4A10,0x4A10,0x8003,0x4910,
+    0x0001,0xAB31,0x8012,0xF7BD,0x0003,0x3284,0x4910,0x6910,0x8013,0x4910,0x0001,0x6910,
+    0x800A,0x4910,0x0001,0x6910,0x8003,0x4910,0x0001,0x6910,0x8009,0x4910,0x0002,0x6910,
+    0x6910,0x8005,0x4910,0x0001,0x6910,0x8009,0x4910,0x0001,0x6910,0x8008,0x4910,0x0001,
+    0x6910,0x8003,0x4910,0x0001,0xAB31,0x8012,0xF7BD,0x0001,0x3284,0x8004,0x4910,0x0001,
+    0x6910,0x8005,0x4910,0x0001,0x6910,0x8003,0x4910,0x0002,0x6910,0x6910,0x802A,0x4910,
+    0x0003,0x6910,0x4910,0x4910,0x8004,0x6910,0x0002,0x4910,0x6910,0x8009,0x4910,0x0001,
+    0xAB31,0x8012,0xF7BD,0x0002,0x3284,0x6910,0x8007,0x4910,0x0001,0x6910,0x8004,0x4910,
+    0x0001,0x6910,0x8005,0x4910,0x0004,0x6910,0x4910,0x4910,0x6910,0x8009,0x4910,0x000D,
+    0x6910,0x4910,0x6910,0x4910,0x6910,0x4910,0x6910,0x4910,0x4910,0x6910,0x4910,0x4910,
+    0x6910,0x8005,0x4910,0x0003,0x6910,0x4910,0x6910,0x8005,0x4910,0x0001,0x6910,0x8007,
+    0x4910,0x0002,0x6910,0x6910,0x8009,0x4910,0x0001,0x6910,0x8007,0x4910,0x0002,0x6910,
+    0x6910,0x8004,0x4910,0x0001,0x6910,0x8003,0x4910,0x0001,0x6910,0x8012,0x4910,0x0005,
+    0x6910,0x4910,0x6910,0x4910,0x6910,0x8005,0x4910,0x0001,0x6910,0x8006,0x4910,0x0003,
+    0x6910,0x4910,0x6910,0x8007,0x4910,0x0004,0x6910,0x4910,0x4910,0x6910,0x8005,0x4910,
+    0x0001,0x6910,0x8004,0x4910,0x0002,0x6910,0x6910,0x8004,0x4910,0x0001,0x6910,0x8003,
+    0x4910,0x0001,0x6910,0x8004,0x4910,0x0001,0x6910,0x8005,0x4910,0x0001,0x6910,0x8004,
+    0x4910,0x0001,0x6910,0x8003,0x4910,0x0002,0x6910,0x6910,0x8011,0x4910,0x0001,0x6910,
+    0x8011,0x4910,0x0005,0x6910,0x4910,0x4910,0x6910,0x6910,0x800C,0x4910,0x0002,0x6910,
+    0x6910,0x8004,0x4910,0x0001,0x6910,0x8006,0x4910,0x0001,0x6910,0x8005,0x4910,0x0001,
+    0x6910,0x800F,0x4910,0x0001,0x6910,0x8004,0x4910,0x0001,0x6910,0x8019,0x4910,0x0001,
+    0x6910,0x800A,0x4910,0x0004,0x6910,0x6910,0x4910,0x6910,0x8009,0x4910,0x0003,0x6910,
+    0x4910,0x6910,0x800E,0x4910,0x0001,0x6910,0x8009,0x4910,0x0003,0x6910,0x4910,0x6910,
+    0x800A,0x4910,0x0001,0x6910,0x8007,0x4910,0x0001,0x6910,0x8005,0x4910,0x0001,0x6910,
+    0x8006,0x4910,0x0003,0x6910,0x4910,0x6910,0x8006,0x4910,0x0009,0x6910,0x4910,0x4910,
+    0x6910,0x4910,0x6910,0x4910,0x4910,0x6910,0x8014,0x4910,0x0001,0x6910,0x8007,0x4910,
+    0x0001,0x6910,0x800C,0x4910,0x0004,0x6910,0x4910,0x4910,0x6910,0x8004,0x4910,0x0001,
+    0x6910,0x8005,0x4910,0x0001,0x6910,0x8003,0x4910,0x0004,0x6910,0x6910,0x4910,0x6910,
+    0x8005,0x4910,0x0001,0x6910,0x8008,0x4910,0x0001,0x6910,0x8003,0x4910,0x0004,0x6910,
+    0x4910,0x4910,0x6910,0x8005,0x4910,0x0001,0x6910,0x8005,0x4910,0x0003,0x6910,0x4910,
+    0x6910,0x8006,0x4910,0x0006,0x6910,0x6910,0x4910,0x6910,0x4910,0x6910,0x8009,0x4910,
+    0x0001,0x6910,0x8006,0x4910,0x0001,0x6910,0x8006,0x4910,0x0001,0x6910,0x8010,0x4910,
+    0x0001,0x6910,0x8005,0x4910,0x0003,0x6910,0x4910,0x6910,0x8003,0x4910,0x0001,0x6910,
+    0x8006,0x4910,0x0001,0x6910,0x8006,0x4910,0x0007,0x6910,0x4910,0x4910,0x6910,0x6910,
+    0x4910,0x6910,0x801C,0x4910,0x0001,0x6910,0x8006,0x4910,0x0001,0x6910,0x800A,0x4910,
+    0x0001,0x6910,0x8005,0x4910,0x0001,0x6910,0x800A,0x4910,0x0003,0x6910,0x4910,0x6910,
+    0x8003,0x4910,0x0002,0x6910,0x6910,0x8003,0x4910,0x0004,0x6910,0x4910,0x4910,0x6910,
+    0x8005,0x4910,0x0001,0x6910,0x8006,0x4910,0x0006,0x6910,0x4910,0x4910,0x6910,0x4910,
+    0x6910,0x8018,0x4910,0x0001,0x6910,0x8011,0x4910,0x0001,0x6910,0x8008,0x4910,0x0001,
+    0x6910,0x8003,0x4910,0x0001,0x6910,0x800F,0x4910,0x0002,0x6910,0x6910,0x8004,0x4910,
+    0x0001,0x6910,0x8005,0x4910,0x0002,0x6910,0x6910,0x8022,0x4910,0x0001,0x6910,0x8012,
+    0x4910,0x0003,0x6910,0x4910,0x6910,0x8003,0x4910,0x0001,0x6910,0x8005,0x4910,0x0001,
+    0x6910,0x800C,0x4910,0x0001,0x6910,0x8003,0x4910,0x0001,0x6910,0x8012,0x4910,0x0004,
+    0x6910,0x4910,0x4910,0x6910,0x8010,0x4910,0x0001,0x6910,0x8005,0x4910,0x0001,0x6910,
+    0x8007,0x4910,0x0001,0x6910,0x800F,0x4910,0x0001,0x6910,0x8008,0x4910,0x0001,0x6910,
+    0x800B,0x4910,0x0001,0x6910,0x800F,0x4910,0x0001,0x6910,0x8006,0x4910,0x0001,0x6910,
+    0x8003,0x4910,0x0001,0x6910,0x8003,0x4910,0x0001,0x6910,0x8004,0x4910,0x0001,0x6910,
+    0x8003,0x4910,0x0004,0x6910,0x4910,0x4910,0x6910,0x800A,0x4910,0x0003,0x6910,0x4910,
+    0x6910,0x8008,0x4910,0x0001,0x6910,0x8004,0x4910,0x0001,0x6910,0x8012,0x4910,0x0001,
+    0x6910,0x8003,0x4910,0x0001,0x6910,0x8004,0x4910,0x0001,0x6910,0x8004,0x4910,0x0003,
+    0x6910,0x4910,0x6910,0x8005,0x4910,0x0001,0x6910,0x8005,0x4910,0x0001,0x6910,0x8008,
+    0x4910,0x0002,0x6910,0x6910,0x8006,0x4910,0x0002,0x6910,0x6910,0x800D,0x4910,
+};
+//! \brief Logo for Embedded, 96x96, rle, 7198 bytes
 const image logo_image = {
-  96, 96, 2,
-  "Logo for Embedded",
-  "\022\013O\377\023\013O\377\022\014O\377\023\013O\377\022\014N\377\022\013O\377\022\013"
-  "O\377\023\013N\377\023\013O\377\022\013O\377\023\014O\377\023\013N\377\022\013O\377\022"
-  "\013O\377\022\013O\377\022\013N\377\022\014O\377\022\013N\377\023\013O\377\022\013O\377"
-  "\022\013O\377\022\013N\377\022\013O\377\022\013N\377\022\013O\377\022\014O\377\022\014"
-  "O\377\023\013N\377\023\013O\377\022\013N\377\022\013O\377\023\013O\377\022\013O\377\022"
-  "\014O\377\023\014N\377\022\013O\377\023\013O\377\023\013O\377\022\013O\377\022\013O\377"
-  "\022\013O\377\023\013O\377\023\013O\377\022\013O\377\023\013O\377\023\013O\377\022\013"
-  "N\377\022\013N\377\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000\025\000"
-  "\025\000\025\000\025\000\025\000\025\000\025\000\025\000\024\000\025\000\025\000\025\000\025\000\025\000\025\000\025"
-  "\000\025\000\024\000\024\000\024\000\025\000\025\000\024\000\025\000\024\000\024\000\024\000\025\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\025\000\024\000\025\000\025\000\024\000\024\000\025\000\025\000\024\000\024\000\025"
-  "\000\025\000\025\000\025\000\025\000\024\000\025\000\025\000\024\000\024\000\025\000\025\000\024\000\025\000\024\000"
-  "\024\000\024\000\024\000\025\000\025\000\024\000\025\000\024\000\025\000\025\000\024\000\024\000\024\000\025\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\064Bv\214w\255\367\275\227\265\266\224\264\061\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000W\255\227\265Uk"
-  "T)\365Z\227\265\227\265\064!\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024"
-  "\000\023\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000\024\000"
-  "\024\000\024\000\024\000\024\000\023\000\023\000\023\000\024\000\023\000\023\000\024\000\024\000\024\000\024\000\024"
-  "\000\023\000\024\000\023\000\024\000\024\000\024\000U\214T)\024\000\024\000\024\000\024c\367\275\325{\024"
-  "\000\023\000\024\000\024\000\024\000\024\000\023\000\024\000\023\000\024\000\024\000\024\000\023\000\023\000\023\000"
-  "\024\000\023\000\023\000\023\000\023\000\024\000\023\000\023\000\024\000\023\000\024\000\024\000\023\000\023\000\023"
-  "\000\023\000\024\000\024\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\024B\367\275V\214\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\325{\367\275\325{\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\323\071\267\265\267\265\063)"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\363\030V\255\367\275\064c\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000s\020\366"
-  "\234\367\275\265s\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\063B\065\204\066\245\267\265\367\275"
-  "\367\275\327\275W\255u\214SJ\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\263\061\365{\026\245\227\265\327\275\367\275\267\265W\255U\214\224R\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023"
-  "\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\225\224"
-  "\367\275\025\204\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\363\071"
-  "\367\275\367\275\367\275\367\275W\255\023\000\023\000\263\071\326\234\367\275\367"
-  "\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\225"
-  "\224\323\030\023\000\023\000\023\000\023\000\023\000\363\030u\214\327\275\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\225\224\063!\023\000"
-  "\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\364Z\367\275\367\275\367\275\367"
-  "\275\327\275\323\030\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\023\000\022\000\022"
-  "\000\023\000\023\000\022\000\022\000\023\000S)\327\275\367\275\367\275\367\275\367\275\223"
-  "R\022\000\022\000U\214\367\275U\214\022\000\023\000\023\000\023\000\022\000\022\000\022\000\023\000\023"
-  "\000\022\000\023\000\363\071\367\275\367\275\367\275\367\275V\255\023\000\264R\267\265"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275"
-  "\367\275\367\275\367\275V\255\063!\022\000\022\000\022\000\063Bw\255\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275"
-  "\367\275V\255S)\022\000\022\000\022\000\022\000\022\000\022\000\022\000\022\000\022\000\227\265\367"
-  "\275\367\275\367\275\367\275tk\062\000\022\000\022\000\022\000\022\000\022\000\022\000\022\000\022"
-  "\000\022\000\022\000\022\000\022\000\062\000\022\000\022\000\264s\367\275\367\275\367\275\367\275"
-  "v\255\022\000\022\000\365{\367\275\225\224\022\000\022\000\022\000\022\000\022\000\022\000\022\000\022"
-  "\000\022\000\022\000\022\000\022\000\363\071\367\275\367\275\367\275\367\275V\255sJ\327"
-  "\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367"
-  "\275\367\275\367\275\367\275\367\275\367\275\026\245\022\000\022\000\063B\267\265"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\366\234\022\000\022\000\022\000\022\000\022\000"
-  "\062\000\022\000\062\000\022\000U\214\367\275\367\275\367\275\367\275\366\234\022\000\062"
-  "\000\022\000\022\000\022\000\022\000\022\000\022\000\022\000\062\000\022\000\022\000\022\000\022\000\062\000\022\000"
-  "\066\245\367\275\367\275\367\275\367\275\025\204\022\000\062\000\227\265\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\265\224\022\000\022\000\062\000\022\000\022\000"
-  "\022\000\022\000\363\071\367\275\367\275\367\275\367\275w\255w\255\367\275\367\275"
-  "\367\275\026\245\264sSJR)\223\061\323Zu\214\367\275\367\275\367\275\367\275"
-  "\367\275\367\275\224s\362\040w\255\367\275\367\275\367\275V\255\365{sJ\223"
-  "\061R)\223R\065\204\327\275\367\275\367\275\367\275\367\275\367\275Tk\022\000"
-  "\022\000\022\000\062\000\022\000\022\000\022\000\022\000\063B\370\275\367\275\367\275\367\275\367"
-  "\275\262\061\022\000\022\000\062\000\022\000\022\000\022\000\022\000\022\000\022\000\022\000\022\000\062\000\022"
-  "\000\022\000\363\071\367\275\367\275\367\275\367\275\367\275\262\071\022\000\022\000\062"
-  "\000\022\000\062\000\022\000\022\000\062\000\022\000\022\000\022\000\022\000\022\000\062\000\022\000\022\000\022\000"
-  "\363\071\367\275\367\275\367\275\367\275\367\275\367\275\367\275\327\275\064"
-  "c\062\000\022\000\022\000\022\000\022\000\062\000\062\000sJ\267\265\367\275\367\275\367\275\367"
-  "\275w\255u\214\367\275\367\275\367\275\264s\022\000\022\000\022\000\062\000\062\000\022\000"
-  "\062\000\363\071\227\265\367\275\367\275\367\275\367\275V\255\022\000\062\000\062\000"
-  "\062\000\062\000\022\000\022\000\022\000\062\000\066\245\367\275\367\275\367\275\367\275\364"
-  "{\062\000\062\000\062\000\062\000\022\000\062\000\062\000\062\000\062\000\062\000\062\000\062\000\062\000\062\000\065"
-  "\204\367\275\367\275\367\275\367\275\026\245\062\000\062\000\062\000\062\000\022\000\022\000"
-  "\022\000\062\000\022\000\022\000\022\000\062\000\062\000\062\000\062\000\022\000\062\000\022\000\363\071\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\327\275\223R\022\000\062\000\062\000\062\000"
-  "\022\000\022\000\022\000\062\000\062\000\064c\367\275\367\275\367\275\367\275\367\275\370"
-  "\275\367\275\367\275\023c\022\000\022\000\062\000\022\000\022\000\022\000\062\000\062\000\022\000\223"
-  "R\367\275\367\275\367\275\367\275\367\275sJ\022\000\062\000\062\000\062\000\062\000\062\000"
-  "\062\000\062\000\324{\367\275\367\275\367\275\367\275V\255\062\000\022\000\062\000\062\000"
-  "\062\000\062\000\022\000\022\000\022\000\062\000\062\000\062\000\062\000\062\000w\255\367\275\367\275\367"
-  "\275\367\275\224s\062\000\062\000\062\000\062\000\062\000\062\000\062\000\062\000\022\000\022\000\022\000"
-  "\022\000\022\000\062\000\022\000\022\000\062\000\062\000\363A\367\275\367\275\367\275\367\275"
-  "\367\275\367\275\264s\062\000\022\000\062\000\062\000\022\000\062\000\062\000\062\000\062\000\062\000\062"
-  "\000V\255\367\275\367\275\367\275\367\275\367\275\367\275\065\204\062\000\062\000"
-  "\062\000\062\000\062\000\062\000\022\000\062\000\062\000\062\000\062\000\366\234\367\275\367\275\367"
-  "\275\367\275\065\204\062\000\062\000\062\000\062\000\022\000\062\000\062\000\022\000\062!\327\275\367"
-  "\275\367\275\367\275\367\275SJ\062\000\022\000\062\000\062\000\062\000\022\000\062\000\062\000\062"
-  "\000\062\000\062\000\062\000\263R\367\275\367\275\367\275\367\275\327\275\362\030\062"
-  "\000\062\000\022\000\062\000\062\000\022\000\022\000\022\000\062\000\022\000\062\000\062\000\022\000\062\000\062\000"
-  "\062\000\022\000\062\000\362A\367\275\367\275\367\275\367\275\367\275v\255\062\000\062"
-  "\000\062\000\062\000\062\000\022\000\062\000\062\000\062\000\062\000\062\000\062\000\064\204\367\275\367\275"
-  "\367\275\367\275\367\275\267\265\362\030\062\000\062\000\062\000\062\000\062\000\022\000\062"
-  "\000\062\000\062\000\062\000\062\000\224s\367\275\367\275\367\275\367\275\366\234\062\000"
-  "\062\000\062\000\062\000\062\000\062\000\062\000\062\000\062\000\325\234\367\275\367\275\367\275"
-  "\367\275u\214\062\000\062\000\022\000\062\000\062\000\062\000\062\000\062\000\062\000\021\000\062\000\062\000"
-  "\225\224\367\275\367\275\367\275\367\275\265\224\061\000\062\000\062\000\062\000\062\000"
-  "\061\000\062\000\062\000\061\000\061\000\061\000\062\000\061\000\061\000\061\000\062\000\061\000\062\000\062\000\362"
-  "A\367\275\367\275\367\275\367\275\367\275\364{\021\000\062\000\062\000\061\000\062\000\062"
-  "\000\021\000\061\000\062\000\061\000\061\000\061\000\023c\367\275\367\275\367\275\367\275\367"
-  "\275u\214\061\000\061\000\061\000\062\000\061\000\062\000\061\000\061\000\061\000\061\000\062\000\021\000\062"
-  "B\367\275\367\275\367\275\367\275w\255\061\000\061\000\061\000\061\000\061\000\061\000\061\000"
-  "\061\000\061\000\063c\367\275\367\275\367\275\367\275\267\265\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\221\020\267\265\367\275\367\275\367"
-  "\275\367\275\363Z\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000"
-  "\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\362A\367\275\367\275\367\275\367"
-  "\275\367\275RJ\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061"
-  "\000\362A\367\275\367\275\367\275\367\275\367\275\063c\061\000\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\221\020\367\275\367\275\367\275\367"
-  "\275\267\265\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\221\020\267\265"
-  "\367\275\367\275\367\275\367\275\023c\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061"
-  "\000\061\000\061\000Sk\367\275\367\275\367\275\367\275\227\265\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000"
-  "\061\000\061\000\362A\367\275\367\275\367\275\367\275\327\275\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000R)\367\275\367\275\367\275"
-  "\367\275\367\275\222\061\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000"
-  "\061\000\061\000\061\000\327\275\367\275\367\275\367\275\367\275\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000u\214\367\275\367\275\367\275\367\275\265"
-  "\234\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\366\234\367\275\367"
-  "\275\367\275\367\275T\214\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\362A\367\275\367\275"
-  "\367\275\367\275\227\265\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\370\275\367\275\367\275\367\275\367\275\061\000\061\000"
-  "\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\267\265\367"
-  "\275\367\275\367\275\367\275Q\010\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000"
-  "\061\000rJ\367\275\367\275\367\275\367\275\327\275\361\040\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\010q)\367\275\367\275\367\275\367\275\370\275\062B\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000\061\010\061\010\061\000\061\000\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\362A\367\275\367\275\367\275\367\275v\255\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\010\061\000\061\000\061\000\061\000\367"
-  "\275\367\275\367\275\367\275\327\275\061\000\061\000\061\000\061\000\061\010\061\000\061\000"
-  "\061\010\061\000\061\000\061\010\061\000\061\000\061\000\227\265\367\275\367\275\367\275\367"
-  "\275\321\030\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000V\255\367\275"
-  "\367\275\367\275\367\275\263s\061\000\061\000\061\000\061\000\061\000\061\000\061\000\061\000\324"
-  "{\367\275\367\275\367\275\367\275\066\245\061\000\061\000\061\010\061\000\061\000\061\000\061"
-  "\000\061\000\061\000\061\000\061\010\061\010\061\000\061\010\061\000\061\000\061\010\061\000\061\010\061\000"
-  "\061\000\362A\367\275\367\275\367\275\367\275V\255\061\000\061\000\061\000\061\010\061\000"
-  "\061\000\061\000\061\010\061\000\061\010\061\010\061\010\061\000\061\010\367\275\367\275\367\275"
-  "\367\275\267\265\061\000\061\000\061\000\061\010\061\000\061\000\061\000\061\000\061\000\061\000\061\000"
-  "\061\010\061\000\061\010\227\265\367\275\367\275\367\275\367\275\321\030\061\000\061"
-  "\000\061\000\061\000\061\000\061\000\061\000\061\010\061\000\061\000\364{\367\275\367\275\367\275"
-  "\367\275\026\245\061\010\061\000\061\010\061\010\061\010\061\010\061\000\061\010\066\245\367"
-  "\275\367\275\367\275\367\275\324{\061\010\061\000\061\000\061\000\061\000\061\000\061\010\061"
-  "\000\061\000\061\000\061\000\061\000\061\010\061\010\061\000\061\000\061\000\061\000\061\010\061\000\061\000\361"
-  "A\367\275\367\275\367\275\367\275V\255\061\000\061\000\061\000\061\000\061\010\061\010\061"
-  "\010\061\000\061\000\061\010\061\010\061\010\061\000\061\010\367\275\367\275\367\275\367\275"
-  "\267\265\061\010\061\010\061\000\061\000\061\000\061\010\061\000\061\000\061\000\061\000\061\000\061\010"
-  "\061\000\061\010\227\265\367\275\367\275\367\275\367\275\321\030\061\000\061\010\061"
-  "\010\061\010\061\010\061\010\061\010\061\010\061\010\061\010\261\061\367\275\367\275\367"
-  "\275\367\275\367\275\321\071\061\000\061\000\061\000\061\010\061\000\061\000\062B\370\275\367"
-  "\275\367\275\367\275\327\275Q)\060\010\061\000\061\010\061\010\061\010\060\010\061\000\060"
-  "\010\061\010\060\010\061\010\060\010\060\000\061\010\061\010\060\010\060\010\061\010\061\000\060\010"
-  "\060\000\361A\367\275\367\275\367\275\367\275V\255\061\010\061\010\060\010\061\000\061"
-  "\010\060\010\060\010\060\010\061\010\060\000\060\010\060\010\061\010\060\010\367\275\367\275"
-  "\367\275\367\275\267\265\061\010\060\010\060\010\060\010\060\010\061\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\061\010\060\000\227\265\367\275\367\275\367\275\367\275"
-  "\321\030\060\010\060\010\060\010\060\000\060\010\060\010\060\010\060\010\060\000\060\010\060\000\025"
-  "\245\367\275\367\275\367\275\367\275\024\204\060\010\060\010\060\010\060\010\060\010"
-  "\060\010T\214\367\275\367\275\367\275\367\275\325\234\060\010\060\010\060\010\060"
-  "\000\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\000\060\010\060\000\361A\367\275\367\275\367\275\367\275V"
-  "\255\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\367\275\367\275\367\275\367\275\267\265\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\227\265"
-  "\367\275\367\275\367\275\367\275\320\030\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010sk\367\275\367\275\367\275\367\275v\255"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\226\265\367\275\367\275\367\275\367"
-  "\275\062c\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\361A\367"
-  "\275\367\275\367\275\367\275V\255\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\367\275\367\275\367\275\367"
-  "\275\267\265\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\227\265\367\275\367\275\367\275\367\275\320\030\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\320\030\327"
-  "\275\367\275\367\275\367\275\367\275\262R\060\010\060\010\060\010\060\010\362Z\367"
-  "\275\367\275\367\275\367\275\267\265\220\020\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\060\010\361A\367\275\367\275\367\275\367\275V\255"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\367\275\367\275\367\275\367\275\267\265\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\227\265\367"
-  "\275\367\275\367\275\367\275\320\030\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\225\224\367\275\367\275\367\275\367\275"
-  "\224\224\060\010\060\010\060\010\060\010\265\224\367\275\367\275\367\275\367\275"
-  "t\214\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\361"
-  "A\367\275\367\275\367\275\367\275V\255\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\367\275\367\275\367\275"
-  "\367\275\267\265\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\227\265\367\275\367\275\367\275\367\275\320\030"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\322Z\367\275\367\275\367\275\367\275\267\265P\010\060\010\060\010\360\040\327"
-  "\275\367\275\367\275\367\275\367\275\221R\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\361A\367\275\367\275\367\275\367\275V\255"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\367\275\367\275\367\275\367\275\267\265\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\227\265\367"
-  "\275\367\275\367\275\367\275\320\030\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010v\255\367\275\367\275\367\275\367"
-  "\275Rk\060\010\060\010rk\367\275\367\275\367\275\367\275V\255\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\361A\367\275\367"
-  "\275\367\275\367\275V\255\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\367\275\367\275\367\275\367\275\267"
-  "\265\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\060\010\060\010\227\265\367\275\367\275\367\275\367\275\320\030\060\010\060\010"
-  "\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\060\010\064\204"
-  "\367\275\367\275\367\275\367\275\365\234\060\010\060\010\025\245\367\275\367\275"
-  "\367\275\367\275\023\204\060\010\060\010/\010\060\010\060\010/\010\060\010\060\010/\010\060"
-  "\010\060\010/\010\060\010\060\010/\010/\010/\010/\010\060\010\060\010\060\010\060\010\060\010\060"
-  "\010\361A\367\275\367\275\367\275\367\275V\255\060\010\060\010\060\010\060\010\060"
-  "\010/\010\060\010/\010/\010/\010\060\010/\010/\010\060\010\367\275\367\275\367\275\367"
-  "\275\267\265\060\010/\010/\010\060\010\060\010/\010\060\010/\010/\010\060\010/\010/\010/\010"
-  "\060\010\227\265\367\275\367\275\367\275\367\275\320\030/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010\020B\367\275\367\275\367\275\367\275\327"
-  "\275p)\260\071\367\275\367\275\367\275\367\275\367\275\260\061/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010/\010/\010\020B\367\275\367\275\367\275\367\275V\255/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010\367\275\367\275\367\275\367\275\267"
-  "\265/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\227\265\367"
-  "\275\367\275\367\275\367\275\317\030/\010/\010/\010/\010/\010/\010/\010/\010/\010/"
-  "\010/\010/\010/\010/\010\066\245\367\275\367\275\367\275\367\275\323{\363\203\367"
-  "\275\367\275\367\275\367\275\025\245/\010/\010/\010/\010/\010/\010/\010/\010/\010/"
-  "\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\020B\367\275"
-  "\367\275\367\275\367\275V\255/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010/\010/\010\367\275\367\275\367\275\367\275\267\265/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010\227\265\367\275\367\275\367\275\367"
-  "\275\317\030/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\263s"
-  "\367\275\367\275\367\275\367\275\066\245V\255\367\275\367\275\367\275\367"
-  "\275rk/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010\020B\367\275\367\275\367\275\367\275V\255"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\367\275\367\275"
-  "\367\275\367\275\267\265/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010/\010\227\265\367\275\367\275\367\275\367\275\317\030/\010/\010/\010/\010/"
-  "\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/!\327\275\367\275\367\275\367\275"
-  "\370\275\367\275\367\275\367\275\367\275\327\275\357\040/\010/\010/\010/\010/"
-  "\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/"
-  "\010/\010/\010\020B\367\275\367\275\367\275\367\275V\255/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010\367\275\367\275\367\275\367\275\267"
-  "\265/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\227\265\367"
-  "\275\367\275\367\275\367\275\317\030/\010/\010/\010/\010/\010/\010/\010/\010/\010/"
-  "\010/\010/\010/\010/\010/\010\325\234\367\275\367\275\367\275\367\275\367\275\367"
-  "\275\367\275\367\275\264\224/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\020B\367\275"
-  "\367\275\367\275\367\275V\255/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010/\010/\010\367\275\367\275\367\275\367\275\267\265/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010\226\265\367\275\367\275\367\275\367"
-  "\275\317\030/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\061"
-  "c\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\321Z/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010/\010/\010/\010/\010/\010/\010\020B\367\275\367\275\367\275\367\275V\255/\010"
-  "/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\367\275\367\275\367"
-  "\275\367\275\267\265/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010"
-  "/\010\226\265\367\275\367\275\367\275\367\275\317\030/\010/\010/\010/\010/\010/"
-  "\010/\010/\010/\010/\010/\010/\010/\010/\010/\010/\010\267\265\367\275\367\275\367\275"
-  "\367\275\367\275\367\275\226\265/\010/\010/\010/\010.\010.\010/\010/\010/\010/\010"
-  "/\010.\010.\010.\010/\010/\010/\010/\010.\010/\010/\010/\010.\010/\010/\010/\010/\010\020B"
-  "\367\275\367\275\367\275\367\275V\255/\010/\010.\010.\010/\010/\010/\010/\010.\010"
-  "/\010/\010.\010.\010.\010\367\275\367\275\367\275\367\275\267\265/\010/\010/\010"
-  ".\010.\010.\010/\010.\010.\010.\010.\010.\010/\010.\010\226\265\367\275\367\275\367"
-  "\275\367\275\317\030.\010.\010.\010.\010.\010.\010.\010.\010.\010/\010.\010.\010.\010."
-  "\010.\010.\010t\214\367\275\367\275\367\275\367\275\367\275\367\275\063\214."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010N\010N"
-  "\010.\010.\010.\010.\010.\010N\010.\010.\010.\010.\010.\010.\010N\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010N\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010N\010.\010.\010.\010.\010N\010.\010.\010.\010.\010.\010.\010."
-  "\010.\010N\010.\010.\010N\010N\010N\010.\010.\010N\010.\010.\010.\010N\010.\010.\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010N\010.\010N\010.\010N\010.\010.\010.\010.\010N"
-  "\010.\010.\010.\010.\010N\010.\010.\010.\010.\010.\010N\010N\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010N\010N\010.\010.\010.\010.\010N\010.\010N\010.\010.\010.\010.\010N\010.\010."
-  "\010N\010.\010N\010.\010.\010N\010.\010.\010.\010.\010N\010.\010.\010N\010.\010.\010N\010."
-  "\010.\010.\010.\010N\010.\010.\010N\010N\010N\010.\010.\010.\010N\010N\010.\010.\010.\010."
-  "\010.\010.\010.\010N\010.\010N\010.\010.\010.\010N\010N\010N\010.\010.\010.\010.\010.\010."
-  "\010.\010.\010N\010N\010N\010N\010.\010.\010.\010N\010N\010N\010.\010N\010.\010N\010.\010."
-  "\010.\010.\010.\010.\010.\010.\010N\010.\010.\010.\010.\010.\010.\010.\010.\010.\010N\010N"
-  "\010.\010.\010.\010N\010N\010N\010N\010.\010.\010N\010N\010.\010.\010N\010N\010.\010.\010."
-  "\010.\010.\010N\010.\010.\010N\010N\010.\010.\010.\010.\010.\010N\010N\010.\010.\010.\010."
-  "\010N\010N\010.\010.\010N\010.\010N\010.\010N\010.\010.\010.\010.\010N\010.\010.\010.\010N"
-  "\010.\010.\010.\010.\010.\010.\010.\010.\010.\010N\010.\010N\010N\010N\010.\010.\010.\010."
-  "\010-\010.\010.\010.\010-\010N\010M\010.\010N\010N\010N\010.\010.\010N\010.\010-\010M\010M"
-  "\010M\010-\010.\010.\010.\010.\010.\010N\010N\010N\010M\010.\010.\010N\010M\010-\010N\010M"
-  "\010M\010-\010M\010M\010.\010N\010N\010N\010N\010N\010.\010N\010N\010.\010.\010-\010.\010M"
-  "\010N\010N\010M\010M\010M\010N\010M\010-\010M\010M\010M\010M\010M\010-\010M\010-\010.\010N"
-  "\010M\010M\010-\010-\010M\010-\010-\010-\010M\010-\010-\010M\010-\010M\010M\010-\010-\010M"
-  "\010-\010M\010M\010-\010M\010-\010-\010M\010M\010M\010M\010-\010M\010-\010-\010-\010M\010M"
-  "\010-\010-\010M\010M\010M\010M\010M\010M\010M\010M\010-\010M\010M\010-\010-\010-\010-\010-"
-  "\010-\010M\010-\010-\010M\010M\010-\010-\010-\010-\010-\010M\010-\010M\010-\010-\010M\010M"
-  "\010M\010M\010M\010-\010M\010-\010M\010M\010M\010M\010M\010M\010M\010M\010M\010-\010\260R"
-  "\063\204\025\245\226\265\327\275\367\275\327\275\226\265\365\234\322{N)-\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010-\010M\010M\010M\010M\010-\010M\010M\010"
-  "M\010M\010M\010M\010-\010-\010-\010M\010M\010-\010M\010M\010M\010M\010-\010M\010M\010-\010"
-  "M\010M\010M\010-\010-\010M\010M\010-\010M\010-\010M\010M\010-\010-\010M\010M\010-\010M\010"
-  "M\010M\010M\010M\010-\010M\010M\010M\010M\010M\010M\010M\010M\010-\010M\010M\010-\010M\010"
-  "M\010M\010-\010M\010M\010-\010-\010M\010M\010oJs\214\266\265\367\275\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\327\275\023\204\215"
-  "\020M\010-\010-\010M\010M\010M\010M\010M\010-\010-\010M\010-\010M\010-\010M\010M\010M\010M"
-  "\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010-\010M\010M\010M\010M\010-\010M"
-  "\010M\010M\010M\010M\010M\010-\010M\010-\010M\010M\010-\010M\010M\010M\010M\010M\010M\010M"
-  "\010-\010M\010M\010M\010-\010M\010M\010M\010M\010-\010M\010M\010M\010M\010M\010M\010M\010M"
-  "\010M\010M\010M\010M\010M\010M\010M\010M\010\266\265\367\275\367\275\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275"
-  "\367\275\025\245\355\030M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010\266\265\367\275\367\275"
-  "\367\275V\255S\214\020c\016B\355\030\356\071qk\065\245\367\275\367\275\367\275"
-  "\367\275\025\245M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M"
-  "\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M"
-  "\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M"
-  "\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M"
-  "\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010\266\265\367\275\365\234\320Z"
-  "M\010M\010M\010M\010M\010M\010M\010M\010\362\203\367\275\367\275\367\275\367\275"
-  "\221sM\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010\365\234\360ZM\010M\010M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010\223\224\367\275\367\275\367\275U\255M\010M\010M\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010L\010L\010M\010M\010M\010M\010M\010M\010M\010M\010M\010L\010"
-  "M\010M\010L\010M\010M\010L\010M\010L\010M\010L\010M\010L\010L\010M\010L\010M\010M\010M\010"
-  "M\010M\010M\010M\010M\010M\010M\010L\010M\010M\010M\010L\010M\010M\010L\010L\010L\010M\010"
-  "M\010M\010L\010M\010L\010L\010M\010M\010L\010M\010M\010M\010M\010M\010L\010L\010L\010L\010"
-  "M\010L\010M\010L\010L\010M\010M\010M\010L\010L\010M\010L\010M\010m\061\367\275\367\275"
-  "\367\275\367\275\255\061L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010V\255\367\275\367\275\367\275\317ZL\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010\025\245\367"
-  "\275\367\275\367\275PkL\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010v\255\367\275\367\275\367\275\357ZL\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010\315\071\367\275\367"
-  "\275\367\275\367\275\255\061L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010\062\204\367\275\367\275\367\275U\255L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L"
-  "\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010\315\071\327"
-  "\275\367\275\367\275\367\275\362{L\010L\010L\010L\010L\010L\010L\010L\010L\010L\010"
-  "L\010K\010L\010K\010L\010L\010L\010L\010L\010L\010K\010L\010L\010L\010L\020L\010K\010L\010"
-  "K\010K\010L\020L\010L\010K\020L\010L\020L\010L\010L\010L\010L\010L\020L\010L\010L\010L\010"
-  "L\010L\010L\010L\010L\010L\010L\010L\010L\010K\010L\020K\010L\020L\010K\010L\010K\010L\010"
-  "K\010L\010L\010L\010L\010K\010K\020K\010K\010K\010K\020K\010K\010K\020L\020K\020L\010K\020"
-  "K\020K\020L\010K\020K\010K\020K\020K\010\025\245\367\275\367\275\367\275\226\265\314"
-  "\030K\020K\010K\010K\010K\010K\010K\010K\010K\010K\010K\010K\010K\010K\010K\020K\010K\010K"
-  "\010K\010K\010K\010K\020K\020K\010K\010K\010K\010K\010K\010K\020K\010K\020K\020K\010K\010K"
-  "\010K\010K\010K\020K\010K\010K\010K\020K\010K\010K\010K\010K\020K\020K\010K\020K\010K\010K"
-  "\020K\010K\010K\010K\020K\010K\020K\020K\020K\010K\020K\010K\010K\010K\010K\020K\010K\020K"
-  "\010K\020K\020K\010K\020K\010K\020K\010K\020K\020K\010K\010K\010K\010K\010K\020K\020K\020\062"
-  "\204\367\275\367\275\367\275\367\275\017cK\010K\010K\010K\010K\020K\010K\010K\020"
-  "K\020K\020K\010K\020K\010K\020K\020K\010K\010K\020K\010K\020K\010K\020K\020K\020K\020K\010"
-  "K\010K\020K\010K\020K\020K\020K\020K\010K\010K\020K\010K\020K\020K\020K\020K\010K\010K\010"
-  "K\020K\020K\020K\020K\010K\010K\010K\020K\020K\010K\020K\010K\020K\010K\010K\020K\020K\020"
-  "K\020K\010K\020K\010K\010K\010K\020K\020K\010K\020K\020K\020K\020K\020K\010K\010K\020K\020"
-  "K\020K\020K\010K\010K\020K\020K\020K\020K\010pk\367\275\367\275\367\275\367\275R\214"
-  "K\010K\010K\020K\010K\010K\020K\020K\010K\020K\020K\020K\020K\010K\010K\020K\020K\020K\020"
-  "K\020K\020K\010K\010K\020K\020K\020K\020K\010K\020K\020K\010K\020K\020K\020K\010K\020K\020"
-  "K\020K\020K\020K\010K\020K\020K\020K\020K\020K\010K\020K\010K\020K\010K\020K\010K\010K\020"
-  "K\010K\020K\010K\020K\020K\020K\020K\020K\020K\020K\020K\020K\010K\020K\010K\020K\020K\020"
-  "K\020K\020K\020K\020K\020K\020K\010K\010K\020K\020K\020K\010K\020K\020K\010K\020K\020\017c"
-  "\367\275\367\275\367\275\367\275\324\234\213\030K\010K\020K\010K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\010K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\010K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020\256Z\327\275\367\275\367\275\367"
-  "\275\025\245\313\030K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "K\020K\020nJ\267\265\367\275\367\275\367\275U\255\013!K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K"
-  "\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020-J\266\265\367\275\367\275\367"
-  "\275U\255l\061K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020J\020J\020K\020K\020K\020K\020K\020"
-  "J\020K\020K\020K\020J\020K\020J\020J\020K\020J\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "K\020K\020K\020K\020K\020K\020J\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020K\020"
-  "J\020K\020J\020K\020J\020J\020K\020J\020K\020J\020K\020K\020J\020K\020J\020J\020K\020J\020"
-  "K\020\354\071\226\265\367\275\367\275\367\275v\255\254\061J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020\314\071\226\265\367\275\367"
-  "\275\367\275\226\265\354\071J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J"
-  "\020J\020J\020J\020J\020k\061U\255\367\275\367\275\367\275\266\265\014BJ\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020+)\065\255\367\275"
-  "\367\275\367\275\266\265MJJ\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020\312\040\025\245\367\275\367\275\367\275\267\265mRJ\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020\212\020\364\234\367"
-  "\275\367\275\367\275\327\275\316ZJ\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020\263\224\367\275\367\275\367\275\327\275\356"
-  "ZJ\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020I\020"
-  "J\020I\020J\020J\020J\020J\020J\020J\020J\020I\020J\020I\020J\020I\020J\020J\020J\020J\020"
-  "J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020J\020"
-  "J\020J\020I\020J\020J\020J\020J\020J\020J\020J\020J\020I\020J\020J\020I\020I\020I\020\253"
-  "\061\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275"
-  "\062\204I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I"
-  "\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020i\020I\020I\020I\020I\020I"
-  "\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020i\020I\020I\020I\020\253\061\367\275\367\275\367\275\367\275\367\275\367"
-  "\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367"
-  "\275\367\275\367\275\367\275\062\204I\020I\020I\020I\020i\020I\020I\020I\020I\020I"
-  "\020i\020I\020I\020I\020i\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020i\020i\020i"
-  "\020i\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020\253\061\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275\367\275"
-  "\367\275\367\275\367\275\367\275\367\275\367\275\367\275\062\204i\020I\020I"
-  "\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I"
-  "\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020i\020I\020i\020I\020i"
-  "\020I\020I\020i\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020i\020I\020I\020I\020I"
-  "\020I\020i\020I\020I\020I\020I\020I\020I\020I\020i\020i\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020i\020i\020I\020I\020I\020I\020i\020I"
-  "\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020i\020I\020i\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I"
-  "\020I\020I\020i\020I\020i\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020i\020I\020I"
-  "\020I\020I\020I\020i\020I\020I\020I\020I\020i\020i\020I\020I\020I\020I\020i\020I\020I\020I"
-  "\020i\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020i\020I"
-  "\020I\020I\020i\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020i\020I\020I\020i\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020i\020i\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i\020I\020I"
-  "\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020i\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020i\020i\020I\020i\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020i\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020i\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I"
-  "\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i\020I\020i\020I\020I\020I\020I\020I\020I"
-  "\020i\020I\020I\020i\020I\020i\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I"
-  "\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020i"
-  "\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020i\020i\020I\020i"
-  "\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I"
-  "\020i\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020i"
-  "\020I\020I\020I\020I\020I\020I\020i\020i\020I\020i\020I\020i\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I"
-  "\020I\020I\020I\020I\020i\020I\020i\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i"
-  "\020I\020I\020I\020I\020I\020I\020i\020I\020I\020i\020i\020I\020i\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020i\020I\020i\020I\020I\020I\020i\020i\020I\020I\020I\020i\020I\020I"
-  "\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i\020I\020I\020i\020I"
-  "\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I"
-  "\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020i\020i\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020i\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020i\020I\020I"
-  "\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020i\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I"
-  "\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020i\020I\020I\020I\020i\020I\020I"
-  "\020I\020i\020I\020I\020I\020I\020i\020I\020I\020I\020i\020I\020I\020i\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020i\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020i"
-  "\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I"
-  "\020I\020I\020I\020I\020I\020i\020I\020I\020I\020i\020I\020I\020I\020I\020i\020I\020I\020I"
-  "\020I\020i\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I\020I\020I\020I\020i\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020i\020i\020I\020I\020I\020I\020I\020I\020i\020i\020I\020I"
-  "\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020I\020",
+    96, 96, IMAGE_RLE, 0, "Logo for Embedded", NULL, logoImageData, 3599
 };
-/* \brief goodby image
- * \param image, struct defined in image.h (Snoopy as Mr. Cool)
- */
+
+static const uint16_t coolImageData[] = {
+    0x0030,0x00A5,0x4F00,0xA54F,0x00A5,0x4F01,0xA64F,0x01A6,0x4F02,0xA750,0x03A7,0x5204,
+    0xA651,0x07A4,0x510E,0xA350,0x16A1,0x4F19,0xA04F,0x16A1,0x4D13,0xA14E,0x10A2,0x4F0A,
+    0xA34F,0x07A5,0x5003,0xA750,0x03A7,0x5104,0xA651,0x03A6,0x5102,0xA752,0x01A7,0x5202,
+    0xA751,0x02A7,0x5102,0xA751,0x02A7,0x5102,0xA751,0x02A7,0x5002,0xA750,0x02A7,0x5102,
+    0x9F50,0x8010,0x7E6E,0x0022,0xD084,0x139C,0xD084,0x139C,0xD084,0x139C,0x9084,0x319B,
+    0x0F0B,0xED62,0x6F7B,0xED6B,0x6F7B,0xED6B,0x737B,0xED6B,0x6B5B,0xED6A,0x6F7B,0xED6B,
+    0x6F7B,0xED6B,0x6F7B,0xED6B,0x6F7B,0xED6B,0x737B,0xED6B,0x6F7B,0xED6B,0x6F7B,0xED6B,
+    0x819A,0x819A,0x8006,0x809A,0x0007,0x819A,0x819A,0x848A,0xA96A,0x325C,0xFA65,0x7D6E,
+    0x8003,0x7E6E,0x000A,0x9E6E,0x7E6E,0x7E6E,0x9E6E,0x7D76,0x1B6E,0xBA6D,0x9A65,0xFB6D,
+    0x7D6E,0x8010,0x7E6E,0x0001,0x9E6E,0x8031,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,
+    0x8006,0x809A,0x0006,0x819A,0x6292,0xA87A,0x325C,0xDB6D,0x7D6E,0x8003,0x9E6E,0x8004,
+    0x7E6E,0x0008,0x7D6E,0xFA6D,0x165D,0xF764,0x5865,0xBA65,0x3C6E,0x7E76,0x8003,0x7E6E,
+    0x0009,0x3D6E,0x1C6E,0x5E6E,0x7E6E,0x7E6E,0x3D6E,0x1C6E,0x1C6E,0x3D6E,0x8003,0x7E6E,
+    0x0003,0x9E6E,0x7F6E,0x7F76,0x802F,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8005,
+    0x809A,0x0006,0x819A,0x819A,0x638A,0x0C63,0x7965,0x5D6E,0x8004,0x7E6E,0x001B,0x7D76,
+    0x5D6E,0x1C6E,0xDA6D,0x786D,0xB46C,0x937C,0xF57C,0x367D,0x3775,0x376D,0x996D,0xFA6D,
+    0x3C6E,0xDB6D,0x796D,0x385D,0x1C6E,0x3C66,0x9A65,0xB554,0xF24B,0x1354,0xD65C,0xBA6D,
+    0x5D6E,0x7E6E,0x8003,0x7F6E,0x802F,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8006,
+    0x809A,0x0027,0x619A,0x638A,0x2D63,0xBA6D,0x5E6E,0x7F6E,0x7F6E,0x7E6E,0x3D6E,0xDB6D,
+    0x586D,0xF67C,0xB384,0x317C,0x75AD,0x59C6,0x79CE,0x18BE,0xB7B5,0x35A5,0x9384,0xD47C,
+    0xF574,0x535C,0xF66C,0xBA6D,0xBA65,0xB554,0x2E3B,0x092A,0xA729,0xA729,0x2A32,0x904B,
+    0x3865,0x3C6E,0x7E6E,0x7F6E,0x7F6E,0x802F,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,
+    0x8006,0x809A,0x000F,0x619A,0x6292,0xEC6A,0x596D,0x5E6E,0x7E6E,0x5E76,0xFB6D,0x176D,
+    0x7374,0x359D,0x59CE,0xBAD6,0x18C6,0x5DEF,0x8003,0xBEF7,0x0013,0x9DF7,0x5DEF,0xFBDE,
+    0x79CE,0x34A5,0x938C,0xF584,0x366D,0xF153,0x8B3A,0x6629,0xE420,0xE320,0xE320,0xE420,
+    0x8729,0xED3A,0x165D,0x1C6E,0x8031,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8006,
+    0x809A,0x0013,0x819A,0x6192,0xEB72,0x3865,0x5D6E,0x3C6E,0x9A6D,0x946C,0xB38C,0x18C6,
+    0x5DEF,0xBEF7,0xBEF7,0x5DEF,0xBEF7,0x9EF7,0x7DEF,0x7DEF,0x9DF7,0x8003,0xBEF7,0x0008,
+    0x5DEF,0x1CE7,0x59CE,0x517C,0x4942,0x6631,0x0421,0x0321,0x8004,0xE420,0x0005,0x4621,
+    0xEE3A,0x3865,0x5D6E,0x9E6E,0x802F,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8005,
+    0x809A,0x001F,0x819A,0x819A,0x8192,0xEA72,0xF764,0xDB6D,0x386D,0xD484,0x96AD,0xDBDE,
+    0x9EF7,0xFFFF,0xFFFF,0xDFFF,0xBEF7,0x1CE7,0x18C6,0x75B5,0x34AD,0xB6B5,0x99D6,0x7DEF,
+    0xDFFF,0xFFFF,0xDFFF,0x3DEF,0x718C,0xA739,0x0421,0x0421,0xE320,0x8004,0xE420,0x0004,
+    0x0421,0xA729,0xB14B,0xBB6D,0x8030,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8004,
+    0x809A,0x8003,0x819A,0x0008,0x828A,0xC972,0x3364,0xB46C,0x159D,0x9AD6,0x7DEF,0xDEF7,
+    0x8003,0xFFFF,0x000F,0xDFFF,0xFBDE,0xF39C,0x0C63,0x694A,0x284A,0x6A52,0x8E73,0x96B5,
+    0x1CE7,0xDFFF,0xFFFF,0x5DEF,0x518C,0x8631,0x8008,0xE420,0x0004,0x0421,0x2A32,0x5454,
+    0x1C6E,0x802F,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8005,0x809A,0x0008,0x819A,
+    0x619A,0x6292,0x4572,0xCB52,0xB394,0xDBD6,0xBEF7,0x8005,0xFFFF,0x000F,0x5DEF,0x14A5,
+    0x8A52,0x2429,0x0421,0xE420,0x0421,0x6529,0xCB5A,0x14A5,0x1CE7,0xDFFF,0x5DEF,0x518C,
+    0x8631,0x8008,0xE420,0x0005,0x0421,0x2521,0xEE3A,0x7A65,0x5E6E,0x802E,0x7E6E,0x0004,
+    0x7F6E,0x3D6E,0x819A,0x819A,0x8005,0x809A,0x0007,0x819A,0x619A,0x6292,0x466A,0xCF7B,
+    0x59CE,0x9EF7,0x8005,0xFFFF,0x0004,0xDFFF,0x9AD6,0x8E73,0x4529,0x8004,0xE420,0x0009,
+    0x0421,0x2429,0xCB5A,0x75AD,0x3CE7,0x5DEF,0x9294,0xE741,0x0421,0x8006,0xE420,0x0009,
+    0x0321,0x0421,0x0421,0x292A,0x9554,0x1C6E,0x5E6E,0x7E76,0x7E76,0x802B,0x7E6E,0x0004,
+    0x7F6E,0x3D6E,0x819A,0x819A,0x8005,0x809A,0x0007,0x819A,0x8192,0x447A,0x2C73,0xF8BD,
+    0x7DEF,0xDFFF,0x8005,0xFFFF,0x0004,0x9EF7,0x75AD,0x8A52,0x0421,0x8004,0xE420,0x0009,
+    0x0421,0x0421,0x4529,0x4D6B,0xD7BD,0x79CE,0xEF83,0x2842,0x4529,0x8006,0xE420,0x000A,
+    0xE320,0xE420,0x0421,0x6621,0x0E3B,0xF764,0x996D,0x9A6D,0xFB75,0x5D76,0x802A,0x7E6E,
+    0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8005,0x809A,0x0006,0x819A,0x628A,0xA86A,0xD39C,
+    0x3CE7,0xDFFF,0x8006,0xFFFF,0x0004,0x3CE7,0x3084,0xA631,0x0421,0x8007,0xE420,0x0006,
+    0x8631,0x0C63,0xAE73,0x494A,0x6631,0x0421,0x8009,0xE420,0x000B,0x0421,0x093A,0x317C,
+    0xD494,0xB38C,0xF57C,0xBA75,0x1C6E,0x5D6E,0x7E6E,0x9E6E,0x8026,0x7E6E,0x0004,0x7F6E,
+    0x3D6E,0x819A,0x819A,0x8005,0x809A,0x0005,0x6192,0x657A,0xEF83,0xBAD6,0xBEF7,0x8006,
+    0xFFFF,0x0004,0xDFFF,0x9AD6,0x4D6B,0x0421,0x8008,0xE420,0x0005,0x0421,0x4529,0x6631,
+    0x2429,0x0421,0x800B,0xE420,0x0009,0x8A52,0xB6B5,0x1CE7,0x1CE7,0x38C6,0x569D,0x3685,
+    0x796D,0x1C6E,0x8027,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8004,0x809A,0x0005,
+    0x819A,0x628A,0xC97A,0x75AD,0x7DEF,0x8007,0xFFFF,0x0004,0xBEF7,0x18C6,0xCB5A,0x0421,
+    0x800A,0xE420,0x0001,0x0421,0x800D,0xE420,0x000A,0x8A52,0xD7BD,0x9EF7,0xDFFF,0xBEF7,
+    0x5DEF,0x79CE,0xF494,0xF674,0xFB6D,0x8026,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,
+    0x8004,0x809A,0x0005,0x8192,0x4382,0x6D7B,0x9ACE,0xDEF7,0x8007,0xFFFF,0x0004,0x9EF7,
+    0x55AD,0x494A,0x0421,0x8018,0xE420,0x000B,0x6952,0x96B5,0x9EEF,0xDFFF,0xFFFF,0xFFFF,
+    0xBEF7,0xDBDE,0x55A5,0xF574,0xFB6D,0x8025,0x7E6E,0x0005,0x7F6E,0x3D6E,0x819A,0x819A,
+    0x809A,0x8003,0x819A,0x0004,0x6192,0x667A,0x7194,0x5CE7,0x8008,0xFFFF,0x0004,0x7DEF,
+    0xF39C,0x2842,0x0421,0x800A,0xE420,0x0005,0x0421,0x8631,0xAA52,0x0C63,0xC739,0x8003,
+    0x0421,0x8004,0xE420,0x0005,0x0421,0x2429,0xCB5A,0x18C6,0x9EF7,0x8004,0xFFFF,0x0009,
+    0xBEFF,0x1CE7,0x76A5,0xF574,0xFB6D,0x7D6E,0x7E6E,0x7F6E,0x7F6E,0x8020,0x7E6E,0x000C,
+    0x7F6E,0x3D6E,0x819A,0x819A,0x809A,0x819A,0x619A,0x619A,0x6292,0xA972,0x75AD,0x9EF7,
+    0x8008,0xFFFF,0x0003,0x5DEF,0x9294,0xC739,0x800B,0xE420,0x0008,0x2429,0xCB5A,0x75AD,
+    0xF7BD,0x3084,0xE841,0x0421,0x0421,0x8003,0xE420,0x0006,0x0421,0x4529,0xE739,0xCF7B,
+    0xBAD6,0xBEF7,0x8005,0xFFFF,0x0008,0xDFFF,0x1CE7,0x76A5,0xB56C,0xDB6D,0x7E6E,0x7F6E,
+    0x7F6E,0x8020,0x7E6E,0x000C,0x7F6E,0x3D6E,0x819A,0x819A,0x809A,0x809A,0x619A,0x619A,
+    0x428A,0xEA72,0xF7BD,0xBEF7,0x8007,0xFFFF,0x0004,0xBEFF,0xBAD6,0xAE73,0x4529,0x800B,
+    0xE420,0x0010,0x8631,0x1084,0x1CE7,0x9EF7,0x9AD6,0x9294,0xAA5A,0x8631,0x2429,0x0421,
+    0x0421,0x8631,0x694A,0xAE73,0xD7BD,0x7DEF,0x8007,0xFFFF,0x0007,0xDFFF,0xDBDE,0x938C,
+    0xF764,0x3D6E,0x7F6E,0x7F6E,0x8020,0x7E6E,0x000C,0x7F6E,0x3D6E,0x819A,0x819A,0x809A,
+    0x609A,0x809A,0x8192,0x6482,0x8D7B,0x9AD6,0xDFFF,0x8006,0xFFFF,0x0006,0xDFFF,0xDBDE,
+    0x9294,0x8A52,0x6529,0x0421,0x800A,0xE420,0x000F,0x0842,0xD39C,0x7DEF,0xFFFF,0xBEF7,
+    0x1CE7,0x96B5,0x718C,0xCF7B,0x8E73,0x8E73,0x3084,0x14A5,0x59CE,0x7DEF,0x8009,0xFFFF,
+    0x0006,0x9EF7,0xD7BD,0x736C,0xFB6D,0x7E76,0x7F6E,0x8020,0x7E6E,0x000B,0x7F6E,0x3D6E,
+    0x819A,0x819A,0x619A,0x619A,0x809A,0x628A,0xA872,0xD29C,0x3CE7,0x8006,0xFFFF,0x0008,
+    0xDFFF,0xFBDE,0xD39C,0x4D6B,0x518C,0x4D6B,0xA631,0x0421,0x8009,0xE420,0x000E,0x494A,
+    0x55AD,0x9EF7,0xFFFF,0xFFFF,0xDFFF,0x9EF7,0x5DEF,0x1CE7,0xBAD6,0xBBDE,0x3CE7,0x7DEF,
+    0xBEF7,0x800A,0xFFFF,0x0005,0xDFFF,0xFBDE,0x7284,0x586D,0x5D6E,0x8021,0x7E6E,0x0002,
+    0x7F6E,0x3D6E,0x8003,0x819A,0x0006,0x619A,0x619A,0x667A,0x0F8C,0x99CE,0xBEF7,0x8005,
+    0xFFFF,0x0009,0xDFFF,0x1CE7,0xF39C,0x4D6B,0xF39C,0xDBDE,0xF7BD,0x4D6B,0x4529,0x8008,
+    0xE420,0x0004,0x0421,0xEB5A,0x38C6,0xBEF7,0x8005,0xFFFF,0x8003,0xDFFF,0x800E,0xFFFF,
+    0x0004,0x7DEF,0x75AD,0x946C,0x1C6E,0x8021,0x7E6E,0x001B,0x7F6E,0x3D6E,0x819A,0x819A,
+    0x809A,0x819A,0x848A,0x6C83,0x18C6,0x5DE7,0x7DEF,0x7DEF,0xDFFF,0xFFFF,0xFFFF,0xDFFF,
+    0x3CE7,0x55AD,0x8E73,0xD39C,0xFBDE,0xBEF7,0x5DEF,0x55AD,0x6952,0x0421,0x0421,0x8006,
+    0xE420,0x0004,0xC739,0x718C,0x1CE7,0xDFFF,0x800C,0xFFFF,0x0002,0xDFFF,0xDFFF,0x8008,
+    0xFFFF,0x0004,0xDEF7,0x99D6,0x727C,0x9965,0x8021,0x7E6E,0x0002,0x7F6E,0x3D6E,0x8003,
+    0x819A,0x001F,0x8192,0xA782,0xD39C,0xFBDE,0x9AD6,0x18C6,0x38C6,0x7DEF,0xFFFF,0xDFFF,
+    0x1CE7,0x96B5,0xEF7B,0x34A5,0x1CE7,0xBEF7,0xFFFF,0xDFFF,0xDBDE,0x518C,0x2842,0xC739,
+    0xE741,0x4529,0x0421,0xE320,0x0421,0xE739,0xCF7B,0x79CE,0xBEF7,0x800A,0xFFFF,0x0007,
+    0xDFFF,0x7DEF,0x1CE7,0xBAD6,0xBAD6,0x3CE7,0xBEF7,0x8007,0xFFFF,0x0004,0x5CEF,0x928C,
+    0xF75C,0x5D6E,0x8020,0x7E6E,0x0002,0x7F6E,0x3D6E,0x8003,0x819A,0x000F,0x638A,0x2B7B,
+    0xF7BD,0xDBDE,0xB294,0xEF7B,0x34A5,0x79CE,0x9EF7,0x7DEF,0x34A5,0x6D6B,0xF39C,0x1CE7,
+    0xDFFF,0x8003,0xFFFF,0x000C,0xBEF7,0x9AD6,0xD39C,0xF083,0x6E73,0x494A,0xE741,0x2842,
+    0xCB5A,0x718C,0x38C6,0x9EF7,0x800A,0xFFFF,0x0009,0xBEF7,0xDBDE,0x75AD,0x3084,0x8E73,
+    0x4D6B,0xB294,0x38C6,0x7DEF,0x8006,0xFFFF,0x0004,0x7DEF,0xF49C,0xD564,0x3D6E,0x8020,
+    0x7E6E,0x0013,0x7F6E,0x3D6E,0x819A,0x819A,0x6192,0x8682,0x108C,0x9AD6,0x59CE,0x8E73,
+    0xCB5A,0x718C,0x718C,0x9AD6,0x5DEF,0x96B5,0xEF7B,0x79CE,0xBEF7,0x8005,0xFFFF,0x000B,
+    0xBEF7,0x5DEF,0x79CE,0x35AD,0xB29C,0xD39C,0x14A5,0xB6BD,0xFBDE,0x9EF7,0xDFFF,0x8009,
+    0xFFFF,0x000B,0xDFFF,0x1CE7,0x718C,0xCB5A,0x8E73,0xAE73,0x2842,0xE739,0x8E73,0x79CE,
+    0xBEF7,0x8005,0xFFFF,0x0004,0x9EF7,0x96B5,0x946C,0x1C6E,0x8020,0x7E6E,0x0013,0x7F6E,
+    0x3D6E,0x819A,0x809A,0x6192,0xC982,0x55AD,0xDBDE,0x34A5,0xEF7B,0x2D6B,0x7294,0x0C63,
+    0x718C,0x9AD6,0xDBDE,0x14A5,0x38C6,0x9EF7,0x8007,0xFFFF,0x0001,0xDFFF,0x8004,0x9EF7,
+    0x0002,0xBEF7,0xDFFF,0x800B,0xFFFF,0x000B,0xDFFF,0x79CE,0x4D6B,0xA631,0x2C63,0x6D6B,
+    0xE739,0x2421,0xCB5A,0x38C6,0xBEF7,0x8005,0xFFFF,0x0004,0xBEF7,0xD7BD,0x9574,0x1C6E,
+    0x8020,0x7E6E,0x0014,0x7F6E,0x3D6E,0x819A,0x809A,0x6192,0x0A83,0x96B5,0x59CE,0x1084,
+    0xCF7B,0xCB5A,0x6E6B,0x0842,0x8A52,0x14A5,0xFBDE,0x59CE,0x34A5,0x1CE7,0xDFFF,0x8018,
+    0xFFFF,0x000B,0xDFFF,0xFBDE,0x9294,0xAA52,0x2842,0x694A,0x8A52,0x2C63,0x718C,0xBAD6,
+    0xDFFF,0x8005,0xFFFF,0x0004,0xBEF7,0x18C6,0x746C,0x1C6E,0x8020,0x7E6E,0x0014,0x7F6E,
+    0x3D6E,0x809A,0x809A,0x6292,0x0A7B,0x55AD,0x14A5,0xCB5A,0x2842,0x8631,0xE741,0x6952,
+    0xCB5A,0x2C63,0xB6B5,0xDBDE,0x34A5,0x18C6,0x9EF7,0x8019,0xFFFF,0x0009,0xBEF7,0xDBDE,
+    0xB6B5,0xB294,0xF39C,0x75AD,0x38C6,0x1CE7,0xBEF7,0x8006,0xFFFF,0x0004,0xBEF7,0xD7BD,
+    0x956C,0x1C6E,0x8020,0x7E6E,0x0014,0x7F6E,0x3D6E,0x809A,0x809A,0x638A,0x8D83,0x38CE,
+    0xF3A4,0x494A,0x2421,0x2429,0x494A,0x1084,0x1084,0x494A,0xAE73,0x59CE,0xD7BD,0x14A5,
+    0x3CE7,0x801A,0xFFFF,0x0007,0xDFFF,0x9EF7,0x7DEF,0x9EF7,0x9EF7,0xBEF7,0xDFFF,0x8007,
+    0xFFFF,0x0004,0x9EF7,0x76AD,0xF66C,0x3D6E,0x8020,0x7E6E,0x0015,0x7F6E,0x3D6E,0x809A,
+    0x819A,0x648A,0xEF8B,0xBADE,0xD7BD,0xCB5A,0x0421,0x0421,0x8A52,0x9294,0x8E73,0xA739,
+    0xCB5A,0xD7BD,0xBAD6,0xF39C,0x79CE,0xBEF7,0x8026,0xFFFF,0x0005,0xDFFF,0x7DEF,0x149D,
+    0x166D,0x3D6E,0x8020,0x7E6E,0x0015,0x7F6E,0x3D6E,0x809A,0x6192,0x8682,0x919C,0xDBDE,
+    0x14A5,0x494A,0x0421,0x0421,0xE741,0x6E73,0x6952,0x4529,0x694A,0x75AD,0x3CE7,0xB6B5,
+    0x75AD,0x5DEF,0x8026,0xFFFF,0x0004,0xBEFF,0xDBDE,0xB384,0x7965,0x8021,0x7E6E,0x0016,
+    0x7F6E,0x3D6E,0x819A,0x6192,0xA782,0xD3A4,0xDBDE,0xF4A4,0x284A,0x0421,0x0421,0xC739,
+    0x2C6B,0xAA52,0x6529,0xE739,0xB294,0x3CE7,0xBAD6,0xB294,0xFBDE,0xDFFF,0x8024,0xFFFF,
+    0x0005,0xDFFF,0x3CEF,0x76AD,0xD56C,0x1C6E,0x8021,0x7E6E,0x0016,0x7F6E,0x3D6E,0x819A,
+    0x8192,0xA782,0xD2A4,0x1CE7,0x38CE,0x0C63,0x0421,0x0421,0xA631,0xCB5A,0x0842,0x2429,
+    0x4529,0x6D6B,0xBAD6,0xFBDE,0x9294,0x79CE,0xBEF7,0x8023,0xFFFF,0x0005,0xDFFF,0x3CE7,
+    0xB6B5,0xB474,0xBA6D,0x8022,0x7E6E,0x0016,0x7F6E,0x3D6E,0xA19A,0x8192,0x8682,0x5094,
+    0xFBDE,0x38C6,0x0C63,0x0421,0xE420,0x0421,0x6531,0x2429,0x0421,0x0421,0xCB5A,0xF7BD,
+    0x1CE7,0xF39C,0xD7BD,0x9EF7,0x8022,0xFFFF,0x0006,0x9EF7,0xFBDE,0x96AD,0xD474,0xDA6D,
+    0x5E6E,0x8022,0x7E6E,0x0016,0x7F6E,0x3D6E,0x819A,0x829A,0x6582,0x6D7B,0x79CE,0x9AD6,
+    0x6D73,0x0421,0xE420,0xE420,0x0421,0x2529,0xC739,0x4529,0x8A52,0xB6B5,0x3CE7,0x55AD,
+    0x55AD,0x7DEF,0x8020,0xFFFF,0x0007,0xBEF7,0x3DE7,0x59C6,0xD48C,0xD674,0xDB75,0x5E6E,
+    0x8023,0x7E6E,0x0016,0x7F6E,0x3D6E,0xA192,0x8292,0x447A,0xEA62,0xD7B5,0x9ADE,0x8E73,
+    0x0421,0xE420,0x0421,0x2421,0xE741,0x6D6B,0x494A,0xCB5A,0xF7BD,0x3CE7,0x96B5,0xD39C,
+    0x5DEF,0x801D,0xFFFF,0x0008,0xDFFF,0x9EF7,0x1CE7,0x59C6,0x149D,0x9374,0x376D,0x1C6E,
+    0x8025,0x7E6E,0x0016,0x7F6E,0x3D6E,0xA192,0x828A,0xC361,0x0742,0x718C,0x38CE,0x6D73,
+    0x2421,0xE420,0x8631,0xAA5A,0xEB5A,0x3084,0xCB5A,0xAA52,0xB6B5,0x3CE7,0x96B5,0xF39C,
+    0x5DEF,0x8019,0xFFFF,0x000B,0xDFFF,0xBEFF,0x9DF7,0x5DEF,0xDBDE,0xD7BD,0xD494,0x7374,
+    0x1665,0xFB6D,0x5D6E,0x8026,0x7E6E,0x0016,0x7F6E,0x3D6E,0x819A,0x6282,0x8349,0x4429,
+    0x2C6B,0xB6B5,0x518C,0x284A,0x2429,0x494A,0x7194,0xCF7B,0x8A52,0x8631,0xAA52,0xD7BD,
+    0x1CE7,0x55AD,0xB294,0x5DEF,0x8016,0xFFFF,0x000C,0xDEFF,0x9DF7,0x5DEF,0xFBE6,0x9AD6,
+    0x18C6,0x359D,0xB484,0xB46C,0x376D,0xFA6D,0x5C6E,0x8028,0x7E6E,0x0018,0x7F6E,0x3D6E,
+    0x819A,0x6282,0x8351,0x6441,0xCA62,0x75AD,0x38C6,0x718C,0x2842,0x0842,0x1084,0x1084,
+    0x2842,0x8631,0xAF7B,0xBAD6,0xDBDE,0x718C,0x518C,0xBAD6,0x7DEF,0xBEF7,0x8012,0xFFFF,
+    0x000E,0xDFFF,0x7DEF,0xBAD6,0xD7BD,0x35A5,0xB484,0xB474,0x1675,0x586D,0xDA75,0x1C76,
+    0x5D6E,0x7E6E,0x9E6E,0x8028,0x7E6E,0x001C,0x7F6E,0x3D6E,0x819A,0x8192,0x0272,0x2372,
+    0x666A,0xCE7B,0x17BE,0x38C6,0x7194,0x2C63,0x0C63,0x6952,0xE739,0x8E73,0xB6B5,0x1BE7,
+    0xD7B5,0xD06B,0x326C,0xB384,0x96A5,0x9ACE,0x3CE7,0x7DF7,0xBEF7,0xBEF7,0x800D,0xFFFF,
+    0x0010,0x9EF7,0xDBDE,0x75AD,0xCF7B,0xF163,0x5775,0xDB75,0x1C76,0x5C6E,0x7D6E,0x7D6E,
+    0x7E6E,0x7E6E,0x9E6E,0x9F6E,0x7F6E,0x8027,0x7E6E,0x001E,0x7F6E,0x3D6E,0x819A,0x809A,
+    0x6192,0x6192,0x6282,0x8772,0x7194,0x59CE,0xBADE,0xF7BD,0x928C,0x2D63,0x1084,0x38C6,
+    0x3CEF,0xBAD6,0x5184,0xB664,0xFB75,0xFB75,0x7875,0xF67C,0x3595,0xD7B5,0x59C6,0xBAD6,
+    0x5DE7,0xBEF7,0x8009,0xFFFF,0x000C,0xDFFF,0x7DEF,0x59CE,0x518C,0x8A52,0x093A,0x334C,
+    0x1C6E,0x5E76,0x7E76,0x7E6E,0x9E6E,0x8003,0x7E6E,0x0001,0x9E6E,0x8029,0x7E6E,0x0003,
+    0x7F6E,0x3D6E,0x819A,0x8003,0x809A,0x0019,0x8192,0x638A,0xA872,0x308C,0x38C6,0xFBDE,
+    0x9AD6,0xD7BD,0x59CE,0xFBDE,0xBADE,0x55AD,0xF263,0x5965,0x5E6E,0x7E6E,0x7D6E,0x3C6E,
+    0xDA75,0x7975,0x3775,0xD57C,0x76A5,0xBAD6,0x9EF7,0x8007,0xFFFF,0x000A,0xDFFF,0x5DEF,
+    0xF7BD,0x107C,0x6A42,0x4521,0x0932,0x9554,0x3D66,0x9E6E,0x8030,0x7E6E,0x0017,0x7F6E,
+    0x3D6E,0x819A,0x819A,0x809A,0x609A,0x609A,0x819A,0x638A,0x4772,0x8D7B,0x14A5,0x96B5,
+    0xD7BD,0xB6B5,0x14A5,0x3184,0x5364,0x796D,0x3D76,0x7E6E,0x9E6E,0x9E6E,0x8003,0x7E6E,
+    0x0006,0x5D6E,0x1C6E,0x3775,0x1595,0xBAD6,0xBEF7,0x8006,0xFFFF,0x000A,0x9EF7,0x18C6,
+    0x327C,0xB56C,0x1254,0xCD3A,0x2E43,0x3865,0x5E6E,0x9E6E,0x8030,0x7E6E,0x0021,0x7F6E,
+    0x3D6E,0x819A,0x819A,0x809A,0x609A,0x619A,0x819A,0x619A,0x628A,0x447A,0x886A,0xAA6A,
+    0x0B63,0x8F5B,0xF15B,0xB55C,0xDB6D,0x5E6E,0x9E6E,0x9E6E,0x7E6E,0x7E6E,0x9E6E,0x9E6E,
+    0x7F6E,0x7F6E,0x9E6E,0x5C6E,0x5775,0x359D,0x1CE7,0xDFFF,0x8005,0xFFFF,0x000A,0x3CE7,
+    0x928C,0x9464,0x1C6E,0x1C6E,0x3865,0x7865,0x3C6E,0x7E6E,0x9E6E,0x8030,0x7E6E,0x0012,
+    0x7F6E,0x3D6E,0x819A,0x819A,0x809A,0x809A,0x609A,0x819A,0x819A,0x619A,0x8192,0x6292,
+    0x6382,0xCA5A,0xF664,0xFB6D,0x5C6E,0x7E6E,0x8003,0x9E6E,0x8003,0x7E6E,0x0001,0x9E6E,
+    0x8003,0x7F6E,0x0010,0x7E76,0xDA75,0x5274,0x18C6,0xBEF7,0xFFFF,0xFFFF,0xDFFF,0xBEF7,
+    0x5DE7,0x59CE,0xAF73,0x745C,0x1C6E,0x7E6E,0x5E6E,0x8004,0x7E6E,0x0001,0x7E76,0x802F,
+    0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8003,0x809A,0x0024,0x819A,0x819A,0x809A,
+    0x809A,0x819A,0x6292,0x0C63,0x996D,0x7D6E,0x7E6E,0x9E6E,0x9F6E,0x7E6E,0x7E6E,0x7F6E,
+    0x7F6E,0x7E6E,0x7E6E,0x9E6E,0x9E6E,0x7E6E,0x7D6E,0xDA6D,0x3264,0x75AD,0x1BDF,0x5DEF,
+    0x3CE7,0x1CE7,0x59CE,0xF3AC,0x8E93,0x2982,0x0D5B,0x7965,0x5E6E,0x8003,0x9E6E,0x0003,
+    0x7E6E,0x7E6E,0x7F6E,0x802F,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8006,0x809A,
+    0x0009,0x8092,0x609A,0x6392,0x4E63,0xDB6D,0x7E6E,0x7F6E,0x7F6E,0x9E6E,0x8005,0x7E6E,
+    0x0015,0x7F6E,0x7E6E,0x9E6E,0x9D6E,0x5D6E,0xF65C,0xED52,0x2C7B,0x71A4,0x92AC,0x71A4,
+    0xEFA3,0x0CA3,0x49B2,0xA7C9,0x46C1,0x4A7A,0xD564,0x1C6E,0x7E6E,0x7E76,0x8033,0x7E6E,
+    0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8007,0x809A,0x0007,0x619A,0x658A,0x6E5B,0xDA6D,
+    0x5D6E,0x7F6E,0x7F6E,0x8007,0x7E6E,0x0016,0x7E76,0x5D76,0x3C6E,0x996D,0xB15B,0x0972,
+    0xA799,0x08AA,0x08B2,0xE8B9,0xC8B1,0x66B1,0x46D1,0xE5E0,0x06E1,0x87A9,0x0E63,0xD65C,
+    0xDB6D,0x1D76,0x7E6E,0x9E6E,0x8031,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8005,
+    0x809A,0x000A,0x819A,0x619A,0x6292,0x4672,0x4D5B,0xD56C,0xB96D,0x5D6E,0x7E6E,0x7E76,
+    0x8005,0x7E6E,0x0007,0x5D6E,0xDB75,0x1875,0x7474,0x2E73,0xE989,0x6691,0x8003,0x4599,
+    0x000D,0x2599,0x66A1,0x65A9,0x46D1,0xE5E8,0xE6E8,0x26D9,0x8791,0x4A52,0x6F63,0xB574,
+    0xDA75,0x5D6E,0x8005,0x7E6E,0x0002,0x7F6E,0x7F6E,0x802A,0x7E6E,0x0036,0x7F6E,0x3D6E,
+    0x819A,0x819A,0x809A,0x609A,0x809A,0x819A,0x819A,0x8292,0x638A,0x457A,0xA96A,0xB294,
+    0x96AD,0xF584,0x5875,0x1C6E,0x7E76,0x7E6E,0x7E6E,0x3D6E,0x1C6E,0xDB6D,0x1765,0xB16B,
+    0x8C8A,0x09AA,0x67C1,0x06D9,0x05E1,0x05D9,0x26D9,0x26D1,0x26D1,0x25D1,0x06E1,0xE6E8,
+    0xC6E8,0xE6E8,0x06E1,0x26C1,0x4589,0xC889,0x6B9A,0xB07B,0x796D,0x5D6E,0x7F6E,0x7F6E,
+    0x7E6E,0x7E6E,0x7F6E,0x7F6E,0x802A,0x7E6E,0x0031,0x7F6E,0x3D6E,0x819A,0x819A,0x809A,
+    0x609A,0x609A,0x819A,0xA392,0x088B,0x8D83,0x108C,0x7194,0xF7BD,0xFBDE,0xB7B5,0x3274,
+    0xD65C,0x1C76,0x1B6E,0xB965,0xD664,0x136C,0x7073,0x8C7A,0xC8A1,0x46C9,0xE5E0,0xE6E8,
+    0xE6E8,0xE5E8,0xE5E8,0xE6E8,0xE6E8,0x06E1,0x06E1,0xE6E0,0x05E1,0xE6E8,0xE6E8,0xE6E0,
+    0x05D9,0x46B9,0x6691,0x67A9,0xE9B1,0x6F8B,0x586D,0x5D6E,0x8004,0x7E6E,0x0001,0x9E6E,
+    0x802A,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8003,0x809A,0x0016,0x6192,0x088B,
+    0xF2A4,0x79CE,0x1CE7,0xBBD6,0xB6B5,0x9AD6,0xF7BD,0x7294,0xB05B,0xF664,0x3264,0x0D73,
+    0x6A8A,0xE8A1,0xA7B9,0x46C9,0x26D9,0xE5E8,0xC5F0,0xC6F0,0x8003,0xE5E8,0x0014,0xE6E8,
+    0x06D9,0x26D1,0x25D9,0x45C9,0x46C1,0x26D1,0x26C9,0x46B9,0x46C1,0x26D1,0x46A9,0x2691,
+    0x47C1,0xC8B9,0x9083,0x996D,0x7E6E,0x9E6E,0x7E6E,0x8003,0x9E6E,0x8029,0x7E6E,0x0018,
+    0x7F6E,0x3D6E,0x819A,0x819A,0x809A,0x809A,0x819A,0x6292,0x6C83,0x79CE,0x9EF7,0xDFFF,
+    0xBEF7,0xDADE,0x59CE,0x38C6,0xB294,0x8A52,0x6A5A,0xE991,0x67B9,0x26D1,0xE6E0,0xE5E0,
+    0x8008,0xE5E8,0x0016,0xE6E0,0x46C1,0x66A9,0x65B1,0x45B1,0x66B1,0x66A9,0x6599,0x65A9,
+    0x65C1,0x26D9,0x06D1,0x2591,0x4599,0x26C9,0x09B2,0x1274,0x1B6E,0x7E66,0x7F6E,0x9E6E,
+    0x9E6E,0x802A,0x7E6E,0x0003,0x7F6E,0x3D6E,0x819A,0x8003,0x809A,0x0013,0x8192,0x8392,
+    0xAD83,0xBAD6,0xDEF7,0xFFFF,0xDFFF,0xBEF7,0x9EF7,0x3CE7,0x54AD,0x2C6B,0xE779,0x66A9,
+    0x26D9,0xE6E8,0xC5E8,0xC5E8,0xE5E8,0x8003,0xE6E8,0x8004,0xE5E8,0x0013,0xE6E8,0x46C1,
+    0x8699,0x65A1,0x46C9,0x46D1,0x6699,0x8689,0x86A9,0x46C1,0x06D9,0xE5E8,0x25B9,0x2589,
+    0x46B1,0x47C9,0xAC8A,0x376D,0x5D66,0x802D,0x7E6E,0x0003,0x7F6E,0x3D6E,0x819A,0x8003,
+    0x809A,0x0013,0x8192,0x8292,0x0983,0x75AD,0x3CE7,0xBEF7,0xDFFF,0xFFFF,0xFFFF,0xDEFF,
+    0x1CE7,0x55AD,0xAA7A,0x6591,0x46C9,0x05E9,0xE5E8,0xC5E8,0xC5E8,0x8003,0xC6E8,0x8003,
+    0xE5E8,0x0015,0xC5E8,0xE5E8,0x45D1,0x6691,0x4699,0x26D9,0x06D9,0x6699,0xA679,0x8691,
+    0x66A9,0x25D1,0xE5E8,0x05D9,0x26B1,0x4589,0x26B1,0x0992,0x3364,0x1C6E,0x7E76,0x802C,
+    0x7E6E,0x000D,0x7F6E,0x3D6E,0x819A,0x809A,0x609A,0x809A,0x8192,0x8192,0xA58A,0x6C83,
+    0x75B5,0xBAD6,0x9EF7,0x8003,0xFFFF,0x000A,0x9EF7,0xB7BD,0xCB8A,0x4599,0x45C9,0x05E1,
+    0xE5E8,0xC5E8,0xC5E8,0xC6F0,0x8003,0xC6E8,0x0017,0xE5E8,0xE5E8,0xE5E0,0xE5E0,0x46D1,
+    0x6691,0x6791,0x47C1,0x26D1,0x6599,0xA691,0x86A9,0x46C1,0x26D9,0xE5E8,0xE5E8,0x06D9,
+    0x25A1,0x2579,0xC771,0xB153,0x1C6E,0x7E76,0x802C,0x7E6E,0x0033,0x7F6E,0x3D6E,0x819A,
+    0x809A,0x609A,0x809A,0x8192,0x819A,0x8292,0x858A,0x097B,0x508C,0xBAD6,0xBEF7,0xFFFF,
+    0xFFFF,0xBEF7,0x59CE,0x4C93,0x6699,0x46B9,0xE6E0,0xE6E8,0xC5E8,0xC5E8,0xC5F0,0xC5F0,
+    0xC5E8,0xC6E8,0xC5E8,0xE5E8,0x25D1,0x26C1,0x46B9,0x4699,0x67A1,0x4699,0x66A1,0x45A9,
+    0x45A9,0x4599,0x25A1,0x26C1,0xE6E0,0xE5E8,0xE5E8,0x25C9,0x2479,0xA749,0xF24B,0x1D6E,
+    0x802D,0x7E6E,0x0033,0x7F6E,0x3D6E,0x819A,0x809A,0x609A,0x609A,0x819A,0x819A,0x809A,
+    0x8192,0x657A,0x6D73,0xF7BD,0xBEEF,0xFFFF,0xFFFF,0xDEFF,0xFBDE,0xEF93,0xE791,0x6699,
+    0x26D1,0x06E1,0xE5E0,0xE6E0,0xE6E0,0xE5E0,0xE5E8,0xE5E8,0xC6E8,0xE6E8,0x26D1,0x46A9,
+    0x4599,0x46B1,0x27C9,0x46B1,0x46A9,0x26C9,0x26D9,0x45C1,0x46C1,0x26D9,0x05E1,0x05E1,
+    0xE5E8,0x05E1,0x46A1,0xE859,0x745C,0x3D6E,0x802D,0x7E6E,0x0034,0x7F6E,0x3D6E,0x819A,
+    0x819A,0x809A,0x809A,0x819A,0x619A,0x819A,0x628A,0xC972,0x34AD,0x3CE7,0xDEFF,0xFFFF,
+    0xDEFF,0x5DEF,0x7ACE,0x7294,0x498A,0x6679,0x46A1,0x46B9,0x66B9,0x46B9,0x87B9,0x67B9,
+    0x26D1,0xE5E8,0xC6F0,0xC6E8,0xE6E0,0x26D1,0x46C1,0x26C1,0x26D1,0x65B1,0x45A9,0x26C9,
+    0x26D1,0x65B1,0x45A9,0x46B1,0x46B9,0x45D1,0xE5E8,0xE5E8,0x26C1,0xE871,0x5354,0x3D66,
+    0x9E6E,0x801B,0x7E6E,0x0002,0x9E6E,0x9E6E,0x800F,0x7E6E,0x0036,0x7F6E,0x3D6E,0x819A,
+    0x819A,0x809A,0x809A,0x819A,0x619A,0x619A,0x438A,0x4D7B,0x7ACE,0xBEF7,0xFFFF,0xDEF7,
+    0x1BE7,0xB6B5,0xB484,0x336C,0x2F5B,0x8B4A,0xAC5A,0xED62,0x0E63,0x0D63,0x4E63,0xCC6A,
+    0x8799,0x05D9,0xC5E8,0xE5E8,0x05E1,0x26D1,0x45A9,0x25A9,0x46B1,0x66B1,0x66B9,0x46A9,
+    0x46B1,0x46C1,0x46C1,0x4599,0x8699,0x66C1,0x05E9,0xE5E8,0x25D9,0xC899,0x1264,0x3C66,
+    0x7E6E,0x7E6E,0x9E6E,0x8014,0x7E6E,0x0002,0x7E76,0x7E76,0x8003,0x7E6E,0x0006,0x9E6E,
+    0x7F6E,0x7E6E,0x5E6E,0x7E6E,0x7E76,0x800B,0x7E6E,0x0006,0x7F6E,0x3D6E,0x819A,0x819A,
+    0x809A,0x809A,0x8003,0x819A,0x002D,0x648A,0xEF8B,0x1CE7,0xDFFF,0xDFFF,0x3CE7,0x55A5,
+    0xD574,0xDA75,0xFC6D,0x7965,0x175D,0x5865,0xBA6D,0xBA6D,0xBA65,0xB965,0x5364,0x298A,
+    0x05D1,0xE5E8,0xE5E8,0x05E1,0x45B9,0x66B9,0x26C9,0x45A9,0x26C9,0x26D9,0x45A1,0x8699,
+    0x46C9,0x06D9,0x45A9,0xA791,0x67C1,0x06E9,0xE5E8,0xE5E0,0x67C1,0x2E73,0xDB65,0x7E6E,
+    0x7E6E,0x9E6E,0x8015,0x7E6E,0x0003,0x7F6E,0x7F6E,0x9E6E,0x8003,0x7E6E,0x0005,0x5E6E,
+    0xFB75,0x5D6E,0x7F6E,0x9E6E,0x800A,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8004,
+    0x809A,0x000D,0x8192,0x638A,0xAE83,0xDBDE,0xBEF7,0x5CE7,0xD6B5,0x326C,0x996D,0x5D6E,
+    0x9E6E,0x7E6E,0x5E6E,0x8004,0x7E6E,0x001B,0x3C6E,0x5364,0x0992,0xE6D8,0xE5E8,0xE5E8,
+    0x05D9,0x45A9,0x46C9,0x26D9,0x46A9,0x26C9,0x06D9,0x65A1,0xA689,0x66C1,0x26D9,0x65A9,
+    0xA691,0x47C1,0x06E1,0xE5E8,0xE6E8,0x06D1,0x8C8A,0x386D,0x5E6E,0x8018,0x7E6E,0x000C,
+    0x9E6E,0x9C7E,0x9C7E,0x7D76,0x7D6E,0x3B76,0xB785,0x5C76,0x7E76,0x7D6E,0xFB6D,0x1C6E,
+    0x8008,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8004,0x809A,0x0009,0x819A,0x828A,
+    0x0A7B,0x75AD,0x9ACE,0x95AD,0xCF6B,0xD564,0x3C6E,0x8003,0x7E6E,0x0020,0x7E76,0x7E76,
+    0x7E6E,0x7F6E,0x7E6E,0x5C66,0x5364,0x099A,0xE6D8,0xE5E8,0xE5E8,0x25D9,0x45A1,0x46C9,
+    0x26D1,0x46A1,0x47B9,0x26C9,0x6599,0x8699,0x66A1,0x47B9,0x4599,0x8699,0x67B1,0x46C1,
+    0x26D1,0xE6E0,0x06E1,0x09A2,0x746C,0x3D6E,0x8015,0x7E6E,0x000F,0x7E76,0x7E6E,0x7E6E,
+    0x5C76,0x569E,0x93AE,0x98A6,0x7B7E,0xF97D,0xF2AD,0x5896,0x7C7E,0x5A7E,0x976D,0x1C76,
+    0x8008,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8004,0x809A,0x0008,0x819A,0x8192,
+    0x848A,0xE97A,0x6C7B,0xCA6A,0xEC52,0x586D,0x8006,0x7E6E,0x8003,0x7F6E,0x001B,0x3C6E,
+    0xF263,0xC8A1,0xE6E0,0xC6E8,0xE6E8,0x05E1,0x25A9,0x46A1,0x46A9,0x46A9,0x2591,0x4699,
+    0x45A9,0x46C1,0x45A1,0x2599,0x45A9,0x65C1,0x46B1,0x26B1,0x06D1,0xE6E8,0xE6E0,0xC8B9,
+    0xF273,0x3C66,0x8018,0x7E6E,0x000C,0xDA6D,0x7585,0x90A5,0x4FBE,0x76A6,0xB68D,0x2ECE,
+    0xB0CE,0x74B6,0xF39D,0xB77D,0x5C6E,0x8003,0x7E6E,0x0001,0x9E6E,0x8004,0x7E6E,0x0004,
+    0x7F6E,0x3D6E,0x819A,0x819A,0x8005,0x809A,0x000C,0x819A,0x8192,0x628A,0x638A,0x638A,
+    0xA972,0x9564,0x3D6E,0x7F6E,0x7F76,0x7F6E,0x9F6E,0x8004,0x7E6E,0x001D,0x1C66,0xB063,
+    0xA7B1,0xE6E0,0xC6E8,0xC5E8,0xE5E8,0x06D1,0x26C1,0x26C9,0x26D1,0x06C9,0x25C9,0x05D9,
+    0x06E1,0x06D9,0x26D1,0x05D9,0xE5E0,0x05E1,0xE6E0,0xC6E8,0xC5E8,0xE5E0,0x87C9,0x6F73,
+    0xFB6D,0x7E6E,0x9E6E,0x8013,0x7E6E,0x0011,0x9E6E,0x7E6E,0x7E6E,0x1C6E,0x3C76,0xB97D,
+    0x50A5,0x4EC6,0x8FAD,0x0ACE,0xC7EE,0xAAE6,0x6FA5,0xDA7D,0x7D6E,0x7E6E,0x7E76,0x8006,
+    0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,0x819A,0x8007,0x809A,0x0008,0x819A,0x819A,0x8192,
+    0x8582,0xB05B,0xFC6D,0x7F6E,0x7F6E,0x8005,0x7E6E,0x0008,0x7F6E,0x3C66,0xF163,0xC8B1,
+    0xE6E0,0xE5E8,0xE5E8,0xC5E8,0x8004,0xE6E8,0x0001,0xE5E0,0x8007,0xE5E8,0x0008,0xC5E8,
+    0xE5E8,0xC5E8,0xE5E8,0x05E1,0x66C1,0x0D73,0xDA65,0x8015,0x7E6E,0x0001,0x9E6E,0x8003,
+    0x7E6E,0x0010,0x9E6E,0x5D6E,0x3585,0x2BCE,0x27D6,0xC6CD,0xA4EE,0xA6EE,0xEE9C,0xFB75,
+    0x7D76,0x5D6E,0x5C76,0x3C76,0x3E76,0x5E76,0x8003,0x7E6E,0x0004,0x7F6E,0x3D6E,0x819A,
+    0x819A,0x8009,0x809A,0x0006,0x819A,0x638A,0x2D63,0xBA6D,0x5E6E,0x7F6E,0x8005,0x7E6E,
+    0x000C,0x9F6E,0xFC6D,0x6F63,0x66B9,0x05E1,0xE6E8,0xC6E8,0xC5E8,0xC5E8,0xC6E8,0xC6E8,
+    0xC5E8,0x8004,0xE5E8,0x8005,0xE6E8,0x0009,0xE5E0,0xE5E0,0xE6E0,0x25D1,0x87A9,0x0D6B,
+    0xB965,0x7E6E,0x7F6E,0x8017,0x7E6E,0x0005,0x9E6E,0x7D6E,0x5585,0x2BD6,0xA400,0x8A90,
+    0x0000,
+};
+//! \brief Goodby Screen, 96x96, rle, 6770 bytes
 const image cool_image = {
-  96, 96, 2,
-  "Goodby Screen",
-  "\000\245O\000\245O\000\245O\001\246O\001\246O\002\247P\003\247R\004\246Q\007\244Q\016\243P\026"
-  "\241O\031\240O\026\241M\023\241N\020\242O\012\243O\007\245P\003\247P\003\247Q\004\246"
-  "Q\003\246Q\002\247R\001\247R\002\247Q\002\247Q\002\247Q\002\247Q\002\247Q\002\247P\002\247P\002"
-  "\247Q\002\237P~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\320\204\023\234\320\204\023\234"
-  "\320\204\023\234\220\204\061\233\017\013\355bo{\355ko{\355ks{\355kk[\355jo{\355"
-  "ko{\355ko{\355ko{\355ks{\355ko{\355ko{\355k\201\232\201\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232\201\232\201\232\204\212\251j\062\\\372e}"
-  "n~n~n~n\236n~n~n\236n}v\033n\272m\232e\373m}n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232\201\232b\222\250z\062\\\333m}n\236n\236n"
-  "\236n~n~n~n~n}n\372m\026]\367dXe\272e<n~v~n~n~n=n\034n^n~n~n=n\034n\034n=n~n"
-  "~n~n\236n\177n\177v~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232"
-  "\200\232\200\232\200\232\200\232\201\232\201\232c\212\014cye]n~n~n~n~n}v]"
-  "n\034n\332mxm\264l\223|\365|\066}\067u\067m\231m\372m<n\333mym\070]\034n<f\232"
-  "e\265T\362K\023T\326\\\272m]n~n\177n\177n\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n"
-  "=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232a\232c"
-  "\212-c\272m^n\177n\177n~n=n\333mXm\366|\263\204\061|u\255Y\306y\316\030\276"
-  "\267\265\065\245\223\204\324|\365tS\\\366l\272m\272e\265T.;\011*\247)\247)"
-  "*\062\220K\070e<n~n\177n\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232a\232b\222\354jYm^n~n^v\373"
-  "m\027mst\065\235Y\316\272\326\030\306]\357\276\367\276\367\276\367\235\367]"
-  "\357\373\336y\316\064\245\223\214\365\204\066m\361S\213:f)\344\040\343\040\343"
-  "\040\344\040\207)\355:\026]\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201"
-  "\232\200\232\200\232\200\232\200\232\200\232\200\232\201\232a\222\353r\070"
-  "e]n<n\232m\224l\263\214\030\306]\357\276\367\276\367]\357\276\367\236\367"
-  "}\357}\357\235\367\276\367\276\367\276\367]\357\034\347Y\316Q|IBf\061\004!\003"
-  "!\344\040\344\040\344\040\344\040F!\356:\070e]n\236n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177"
-  "n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\201\232\201\232"
-  "\201\222\352r\367d\333m\070m\324\204\226\255\333\336\236\367\377\377\377\377"
-  "\337\377\276\367\034\347\030\306u\265\064\255\266\265\231\326}\357\337\377\377"
-  "\377\337\377=\357q\214\247\071\004!\004!\343\040\344\040\344\040\344\040\344\040\004"
-  "!\247)\261K\273m~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200"
-  "\232\200\232\200\232\201\232\201\232\201\232\202\212\311r\063d\264l\025\235"
-  "\232\326}\357\336\367\377\377\377\377\377\377\337\377\373\336\363\234\014"
-  "ciJ(JjR\216s\226\265\034\347\337\377\377\377]\357Q\214\206\061\344\040\344\040"
-  "\344\040\344\040\344\040\344\040\344\040\344\040\004!*\062TT\034n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\201"
-  "\232a\232b\222Er\313R\263\224\333\326\276\367\377\377\377\377\377\377\377"
-  "\377\377\377]\357\024\245\212R$)\004!\344\040\004!e)\313Z\024\245\034\347\337\377"
-  "]\357Q\214\206\061\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040"
-  "\004!%!\356:ze^n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232"
-  "\200\232\200\232\200\232\201\232a\232b\222Fj\317{Y\316\236\367\377\377\377"
-  "\377\377\377\377\377\377\377\337\377\232\326\216sE)\344\040\344\040\344\040"
-  "\344\040\004!$)\313Zu\255<\347]\357\222\224\347A\004!\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\003!\004!\004!)*\225T\034n^n~v~v~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232"
-  "\201\232\200\232\200\232\200\232\200\232\200\232\201\232\201\222Dz,s\370"
-  "\275}\357\337\377\377\377\377\377\377\377\377\377\377\377\236\367u\255\212"
-  "R\004!\344\040\344\040\344\040\344\040\004!\004!E)Mk\327\275y\316\357\203(BE)\344\040"
-  "\344\040\344\040\344\040\344\040\344\040\343\040\344\040\004!f!\016;\367d\231m\232"
-  "m\373u]v~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232"
-  "\200\232\201\232b\212\250j\323\234<\347\337\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377<\347\060\204\246\061\004!\344\040\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\206\061\014c\256sIJf\061\004!\344\040\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\344\040\344\040\004!\011:\061|\324\224\263\214\365|\272u\034n"
-  "]n~n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200"
-  "\232a\222ez\357\203\272\326\276\367\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\337\377\232\326Mk\004!\344\040\344\040\344\040\344\040\344\040\344\040\344"
-  "\040\344\040\004!E)f\061$)\004!\344\040\344\040\344\040\344\040\344\040\344\040\344\040"
-  "\344\040\344\040\344\040\344\040\212R\266\265\034\347\034\347\070\306V\235\066\205"
-  "ym\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\201\232"
-  "b\212\311zu\255}\357\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\276\367\030\306\313Z\004!\344\040\344\040\344\040\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\344\040\004!\344\040\344\040\344\040\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\344\040\344\040\344\040\344\040\212R\327\275\236\367\337\377"
-  "\276\367]\357y\316\364\224\366t\373m~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200"
-  "\232\200\232\200\232\201\222C\202m{\232\316\336\367\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\236\367U\255IJ\004!\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040"
-  "\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040iR"
-  "\226\265\236\357\337\377\377\377\377\377\276\367\333\336U\245\365t\373m~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n\177n=n\201\232\201\232\200\232\201\232\201\232\201\232a\222fzq\224\\\347"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377}\357\363"
-  "\234(B\004!\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040"
-  "\344\040\004!\206\061\252R\014c\307\071\004!\004!\004!\344\040\344\040\344\040\344\040\004"
-  "!$)\313Z\030\306\236\367\377\377\377\377\377\377\377\377\276\377\034\347v\245"
-  "\365t\373m}n~n\177n\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\201\232a\232a\232b\222\251"
-  "ru\255\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377]\357\222\224\307\071\344\040\344\040\344\040\344\040\344\040\344\040\344\040"
-  "\344\040\344\040\344\040\344\040$)\313Zu\255\367\275\060\204\350A\004!\004!\344\040"
-  "\344\040\344\040\004!E)\347\071\317{\272\326\276\367\377\377\377\377\377\377\377"
-  "\377\377\377\337\377\034\347v\245\265l\333m~n\177n\177n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200"
-  "\232\200\232a\232a\232B\212\352r\367\275\276\367\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\276\377\272\326\256sE)\344\040\344\040\344"
-  "\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\206\061\020\204"
-  "\034\347\236\367\232\326\222\224\252Z\206\061$)\004!\004!\206\061iJ\256s\327\275"
-  "}\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377\333"
-  "\336\223\214\367d=n\177n\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232`\232\200\232\201\222"
-  "d\202\215{\232\326\337\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\337\377\333\336\222\224\212Re)\004!\344\040\344\040\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\344\040\344\040\010B\323\234}\357\377\377\276\367\034\347\226"
-  "\265q\214\317{\216s\216s\060\204\024\245Y\316}\357\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\236\367\327\275sl\373m~"
-  "v\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177"
-  "n=n\201\232\201\232a\232a\232\200\232b\212\250r\322\234<\347\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\337\377\373\336\323\234MkQ\214Mk\246"
-  "\061\004!\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040\344\040IJU"
-  "\255\236\367\377\377\377\377\337\377\236\367]\357\034\347\272\326\273\336"
-  "<\347}\357\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\337\377\373\336r\204Xm]n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\201\232"
-  "a\232a\232fz\017\214\231\316\276\367\377\377\377\377\377\377\377\377\377\377"
-  "\337\377\034\347\363\234Mk\363\234\333\336\367\275MkE)\344\040\344\040\344\040"
-  "\344\040\344\040\344\040\344\040\344\040\004!\353Z\070\306\276\367\377\377\377\377"
-  "\377\377\377\377\377\377\337\377\337\377\337\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377}\357u\255\224l\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\201\232\204"
-  "\212l\203\030\306]\347}\357}\357\337\377\377\377\377\377\337\377<\347U\255"
-  "\216s\323\234\373\336\276\367]\357U\255iR\004!\004!\344\040\344\040\344\040\344"
-  "\040\344\040\344\040\307\071q\214\034\347\337\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337"
-  "\377\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\336\367\231\326r|\231e~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\201\232\201\222\247\202\323"
-  "\234\373\336\232\326\030\306\070\306}\357\377\377\337\377\034\347\226\265\357"
-  "{\064\245\034\347\276\367\377\377\337\377\333\336Q\214(B\307\071\347AE)\004!\343"
-  "\040\004!\347\071\317{y\316\276\367\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\337\377}\357\034\347\272\326\272\326"
-  "<\347\276\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\\\357"
-  "\222\214\367\\]n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n\177n=n\201\232\201\232\201\232c\212+{\367\275\333\336\262\224\357"
-  "{\064\245y\316\236\367}\357\064\245mk\363\234\034\347\337\377\377\377\377\377"
-  "\377\377\276\367\232\326\323\234\360\203nsIJ\347A(B\313Zq\214\070\306\236"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\276\367\333\336u\255\060\204\216sMk\262\224\070\306}\357\377\377"
-  "\377\377\377\377\377\377\377\377\377\377}\357\364\234\325d=n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232"
-  "a\222\206\202\020\214\232\326Y\316\216s\313Zq\214q\214\232\326]\357\226\265"
-  "\357{y\316\276\367\377\377\377\377\377\377\377\377\377\377\276\367]\357y"
-  "\316\065\255\262\234\323\234\024\245\266\275\373\336\236\367\337\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377"
-  "\034\347q\214\313Z\216s\256s(B\347\071\216sy\316\276\367\377\377\377\377\377"
-  "\377\377\377\377\377\236\367\226\265\224l\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\200\232a\222\311\202"
-  "U\255\333\336\064\245\357{-kr\224\014cq\214\232\326\333\336\024\245\070\306\236"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377\236"
-  "\367\236\367\236\367\236\367\276\367\337\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377y\316"
-  "Mk\246\061,cmk\347\071$!\313Z\070\306\276\367\377\377\377\377\377\377\377\377"
-  "\377\377\276\367\327\275\225t\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\200\232a\222\012\203\226\265Y\316"
-  "\020\204\317{\313Znk\010B\212R\024\245\373\336Y\316\064\245\034\347\337\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\337\377\373\336\222\224\252"
-  "R(BiJ\212R,cq\214\272\326\337\377\377\377\377\377\377\377\377\377\377\377"
-  "\276\367\030\306tl\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n\177n=n\200\232\200\232b\222\012{U\255\024\245\313Z(B\206\061\347"
-  "AiR\313Z,c\266\265\333\336\064\245\030\306\236\367\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\276\367\333\336\266\265\262\224\363\234"
-  "u\255\070\306\034\347\276\367\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\276\367\327\275\225l\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n\177n=n\200\232\200\232c\212\215\203\070\316\363\244IJ$!"
-  "$)IJ\020\204\020\204IJ\256sY\316\327\275\024\245<\347\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\337\377\236\367}\357\236\367\236"
-  "\367\276\367\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\236\367v\255\366l=n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n\177n=n\200\232\201\232d\212\357\213\272\336\327\275\313"
-  "Z\004!\004!\212R\222\224\216s\247\071\313Z\327\275\272\326\363\234y\316\276\367"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\337\377}\357\024\235\026m=n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\200\232a\222\206\202\221\234\333"
-  "\336\024\245IJ\004!\004!\347AnsiRE)iJu\255<\347\266\265u\255]\357\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\276\377\333\336\263\204ye~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232a\222\247\202\323\244\333\336\364"
-  "\244(J\004!\004!\307\071,k\252Re)\347\071\262\224<\347\272\326\262\224\373\336"
-  "\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\337\377<\357v\255\325l\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\222\247\202\322\244\034\347"
-  "\070\316\014c\004!\004!\246\061\313Z\010B$)E)mk\272\326\373\336\222\224y\316\276"
-  "\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337"
-  "\377<\347\266\265\264t\272m~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n\177n=n\241\232\201\222\206\202P\224\373\336\070\306"
-  "\014c\004!\344\040\004!e\061$)\004!\004!\313Z\367\275\034\347\363\234\327\275\236\367"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\373\336"
-  "\226\255\324t\332m^n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n\177n=n\201\232\202\232e\202m{y\316\232\326ms\004!\344\040\344"
-  "\040\004!%)\307\071E)\212R\266\265<\347U\255U\255}\357\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\276\367=\347Y\306\324\214\326t\333u^n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\241\222\202\222"
-  "Dz\352b\327\265\232\336\216s\004!\344\040\004!$!\347AmkIJ\313Z\367\275<\347\226"
-  "\265\323\234]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\337\377\236\367\034\347Y\306\024\235\223t"
-  "\067m\034n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n\177n=n\241\222\202\212\303a\007Bq\214\070\316ms$!\344\040\206\061\252"
-  "Z\353Z\060\204\313Z\252R\266\265<\347\226\265\363\234]\357\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\337\377\276\377\235\367]\357\333"
-  "\336\327\275\324\224st\026e\373m]n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232b\202\203ID),k\266\265"
-  "Q\214(J$)IJq\224\317{\212R\206\061\252R\327\275\034\347U\255\262\224]\357\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\336\377\235\367]\357\373\346\232\326\030\306"
-  "\065\235\264\204\264l\067m\372m\\n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232b\202\203QdA\312b"
-  "u\255\070\306q\214(B\010B\020\204\020\204(B\206\061\257{\272\326\333\336q\214"
-  "Q\214\272\326}\357\276\367\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\337\377}\357\272\326\327\275\065\245\264\204\264"
-  "t\026uXm\332u\034v]n~n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\222\002r#rfj\316{\027\276"
-  "\070\306q\224,c\014ciR\347\071\216s\266\265\033\347\327\265\320k\062l\263\204"
-  "\226\245\232\316<\347}\367\276\367\276\367\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\236\367\333\336u\255\317{\361cWu\333u\034v\\n}n}n~n~n\236n\237n\177n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n\177n=n\201\232\200\232a\222a\222b\202\207rq\224Y\316\272\336\367\275\222"
-  "\214-c\020\204\070\306<\357\272\326Q\204\266d\373u\373uxu\366|\065\225\327\265"
-  "Y\306\272\326]\347\276\367\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\337\377}\357Y\316Q\214\212R\011:\063L\034n^v~v~n\236"
-  "n~n~n~n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\200\232\200\232\200\232\201\222c\212"
-  "\250r\060\214\070\306\373\336\232\326\327\275Y\316\373\336\272\336U\255\362"
-  "cYe^n~n}n<n\332uyu\067u\325|v\245\272\326\236\367\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\337\377]\357\367\275\020|jBE!\011\062\225T"
-  "=f\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232`\232`\232"
-  "\201\232c\212Gr\215{\024\245\226\265\327\275\266\265\024\245\061\204Sdym=v~"
-  "n\236n\236n~n~n~n]n\034n\067u\025\225\272\326\276\367\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\236\367\030\306\062|\265l\022T\315:.C\070e^n\236n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232`\232a\232\201\232a"
-  "\232b\212Dz\210j\252j\013c\217[\361[\265\\\333m^n\236n\236n~n~n\236n\236n"
-  "\177n\177n\236n\\nWu\065\235\034\347\337\377\377\377\377\377\377\377\377\377"
-  "\377\377<\347\222\214\224d\034n\034n\070exe<n~n\236n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n\177n=n\201\232\201\232\200\232\200\232`\232\201\232\201\232a\232\201\222"
-  "b\222c\202\312Z\366d\373m\\n~n\236n\236n\236n~n~n~n\236n\177n\177n\177n~"
-  "v\332uRt\030\306\276\367\377\377\377\377\337\377\276\367]\347Y\316\257st\\"
-  "\034n~n^n~n~n~n~n~v~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200"
-  "\232\200\232\201\232\201\232\200\232\200\232\201\232b\222\014c\231m}n~n\236"
-  "n\237n~n~n\177n\177n~n~n\236n\236n~n}n\332m\062du\255\033\337]\357<\347\034"
-  "\347Y\316\363\254\216\223)\202\015[ye^n\236n\236n\236n~n~n\177n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232\200\222`\232c\222Nc\333m~n\177n\177n\236n~n~n~n~n~n\177n~n\236n"
-  "\235n]n\366\\\355R,{q\244\222\254q\244\357\243\014\243I\262\247\311F\301J"
-  "z\325d\034n~n~v~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232a\232e\212n[\332m]n\177n"
-  "\177n~n~n~n~n~n~n~n~v]v<n\231m\261[\011r\247\231\010\252\010\262\350\271\310"
-  "\261f\261F\321\345\340\006\341\207\251\016c\326\\\333m\035v~n\236n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200"
-  "\232\201\232a\232b\222FrM[\325l\271m]n~n~v~n~n~n~n~n]n\333u\030utt.s\351\211"
-  "f\221E\231E\231E\231%\231f\241e\251F\321\345\350\346\350&\331\207\221JRo"
-  "c\265t\332u]n~n~n~n~n~n\177n\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200"
-  "\232`\232\200\232\201\232\201\232\202\222c\212Ez\251j\262\224\226\255\365"
-  "\204Xu\034n~v~n~n=n\034n\333m\027e\261k\214\212\011\252g\301\006\331\005\341\005\331"
-  "&\331&\321&\321%\321\006\341\346\350\306\350\346\350\006\341&\301E\211\310\211"
-  "k\232\260{ym]n\177n\177n~n~n\177n\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232"
-  "\200\232`\232`\232\201\232\243\222\010\213\215\203\020\214q\224\367\275\373"
-  "\336\267\265\062t\326\\\034v\033n\271e\326d\023lps\214z\310\241F\311\345\340"
-  "\346\350\346\350\345\350\345\350\346\350\346\350\006\341\006\341\346\340\005\341"
-  "\346\350\346\350\346\340\005\331F\271f\221g\251\351\261o\213Xm]n~n~n~n~n\236"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232a\222\010\213"
-  "\362\244y\316\034\347\273\326\266\265\232\326\367\275r\224\260[\366d\062d\015"
-  "sj\212\350\241\247\271F\311&\331\345\350\305\360\306\360\345\350\345\350"
-  "\345\350\346\350\006\331&\321%\331E\311F\301&\321&\311F\271F\301&\321F\251"
-  "&\221G\301\310\271\220\203\231m~n\236n~n\236n\236n\236n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n"
-  "\201\232\201\232\200\232\200\232\201\232b\222l\203y\316\236\367\337\377\276"
-  "\367\332\336Y\316\070\306\262\224\212RjZ\351\221g\271&\321\346\340\345\340"
-  "\345\350\345\350\345\350\345\350\345\350\345\350\345\350\345\350\346\340"
-  "F\301f\251e\261E\261f\261f\251e\231e\251e\301&\331\006\321%\221E\231&\311\011"
-  "\262\022t\033n~f\177n\236n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\200\232\200\232"
-  "\200\232\201\222\203\222\255\203\272\326\336\367\377\377\337\377\276\367"
-  "\236\367<\347T\255,k\347yf\251&\331\346\350\305\350\305\350\345\350\346\350"
-  "\346\350\346\350\345\350\345\350\345\350\345\350\346\350F\301\206\231e\241"
-  "F\311F\321f\231\206\211\206\251F\301\006\331\345\350%\271%\211F\261G\311\254"
-  "\212\067m]f~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\200\232\200\232\200\232\201\222"
-  "\202\222\011\203u\255<\347\276\367\337\377\377\377\377\377\336\377\034\347"
-  "U\255\252ze\221F\311\005\351\345\350\305\350\305\350\306\350\306\350\306\350"
-  "\345\350\345\350\345\350\305\350\345\350E\321f\221F\231&\331\006\331f\231\246"
-  "y\206\221f\251%\321\345\350\005\331&\261E\211&\261\011\222\063d\034n~v~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n\177n=n\201\232\200\232`\232\200\232\201\222\201\222\245\212l\203"
-  "u\265\272\326\236\367\377\377\377\377\377\377\236\367\267\275\313\212E\231"
-  "E\311\005\341\345\350\305\350\305\350\306\360\306\350\306\350\306\350\345\350"
-  "\345\350\345\340\345\340F\321f\221g\221G\301&\321e\231\246\221\206\251F\301"
-  "&\331\345\350\345\350\006\331%\241%y\307q\261S\034n~v~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n="
-  "n\201\232\200\232`\232\200\232\201\222\201\232\202\222\205\212\011{P\214\272"
-  "\326\276\367\377\377\377\377\276\367Y\316L\223f\231F\271\346\340\346\350"
-  "\305\350\305\350\305\360\305\360\305\350\306\350\305\350\345\350%\321&\301"
-  "F\271F\231g\241F\231f\241E\251E\251E\231%\241&\301\346\340\345\350\345\350"
-  "%\311$y\247I\362K\035n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\200\232`\232`\232"
-  "\201\232\201\232\200\232\201\222ezms\367\275\276\357\377\377\377\377\336"
-  "\377\373\336\357\223\347\221f\231&\321\006\341\345\340\346\340\346\340\345"
-  "\340\345\350\345\350\306\350\346\350&\321F\251E\231F\261'\311F\261F\251&"
-  "\311&\331E\301F\301&\331\005\341\005\341\345\350\005\341F\241\350Yt\\=n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\201\232a\232\201\232b"
-  "\212\311r\064\255<\347\336\377\377\377\336\377]\357z\316r\224I\212fyF\241"
-  "F\271f\271F\271\207\271g\271&\321\345\350\306\360\306\350\346\340&\321F\301"
-  "&\301&\321e\261E\251&\311&\321e\261E\251F\261F\271E\321\345\350\345\350&"
-  "\301\350qST=f\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "\236n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200"
-  "\232\201\232a\232a\232C\212M{z\316\276\367\377\377\336\367\033\347\266\265"
-  "\264\204\063l/[\213J\254Z\355b\016c\015cNc\314j\207\231\005\331\305\350\345\350"
-  "\005\341&\321E\251%\251F\261f\261f\271F\251F\261F\301F\301E\231\206\231f\301"
-  "\005\351\345\350%\331\310\231\022d<f~n~n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~v~v~n~n~n\236n\177n~n^n~n~v~n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232"
-  "\201\232\200\232\200\232\201\232\201\232\201\232d\212\357\213\034\347\337"
-  "\377\337\377<\347U\245\325t\332u\374mye\027]Xe\272m\272m\272e\271eSd)\212"
-  "\005\321\345\350\345\350\005\341E\271f\271&\311E\251&\311&\331E\241\206\231F"
-  "\311\006\331E\251\247\221g\301\006\351\345\350\345\340g\301.s\333e~n~n\236n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\177n\177n\236n~n~n~n^n\373u]n\177"
-  "n\236n~n~n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232"
-  "\200\232\201\222c\212\256\203\333\336\276\367\\\347\326\265\062l\231m]n\236"
-  "n~n^n~n~n~n~n<nSd\011\222\346\330\345\350\345\350\005\331E\251F\311&\331F\251"
-  "&\311\006\331e\241\246\211f\301&\331e\251\246\221G\301\006\341\345\350\346\350"
-  "\006\321\214\212\070m^n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\236"
-  "n\234~\234~}v}n;v\267\205\\v~v}n\373m\034n~n~n~n~n~n~n~n~n\177n=n\201\232"
-  "\201\232\200\232\200\232\200\232\200\232\201\232\202\212\012{u\255\232\316"
-  "\225\255\317k\325d<n~n~n~n~v~v~n\177n~n\\fSd\011\232\346\330\345\350\345\350"
-  "%\331E\241F\311&\321F\241G\271&\311e\231\206\231f\241G\271E\231\206\231g"
-  "\261F\301&\321\346\340\006\341\011\242tl=n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~v~n~n\\vV\236\223\256\230\246{~\371}\362\255X\226|~Z~\227m\034v"
-  "~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\201"
-  "\232\201\222\204\212\351zl{\312j\354RXm~n~n~n~n~n~n\177n\177n\177n<n\362"
-  "c\310\241\346\340\306\350\346\350\005\341%\251F\241F\251F\251%\221F\231E\251"
-  "F\301E\241%\231E\251e\301F\261&\261\006\321\346\350\346\340\310\271\362s<f"
-  "~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\332mu\205\220\245O\276v"
-  "\246\266\215.\316\260\316t\266\363\235\267}\\n~n~n~n\236n~n~n~n~n\177n=n"
-  "\201\232\201\232\200\232\200\232\200\232\200\232\200\232\201\232\201\222"
-  "b\212c\212c\212\251r\225d=n\177n\177v\177n\237n~n~n~n~n\034f\260c\247\261"
-  "\346\340\306\350\305\350\345\350\006\321&\301&\311&\321\006\311%\311\005\331\006"
-  "\341\006\331&\321\005\331\345\340\005\341\346\340\306\350\305\350\345\340\207\311"
-  "os\373m~n\236n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\236n~n~n\034n<v\271}"
-  "P\245N\306\217\255\012\316\307\356\252\346o\245\332}}n~n~v~n~n~n~n~n~n\177"
-  "n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\201\232\201\232\201\222\205\202\260[\374m\177n\177n~n~n~n~n~n\177n<f\361"
-  "c\310\261\346\340\345\350\345\350\305\350\346\350\346\350\346\350\346\350"
-  "\345\340\345\350\345\350\345\350\345\350\345\350\345\350\345\350\305\350"
-  "\345\350\305\350\345\350\005\341f\301\015s\332e~n~n~n~n~n~n~n~n~n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n\236n~n~n~n\236n]n\065\205+\316'\326\306\315\244\356\246\356"
-  "\356\234\373u}v]n\\v<v>v^v~n~n~n\177n=n\201\232\201\232\200\232\200\232\200"
-  "\232\200\232\200\232\200\232\200\232\200\232\200\232\201\232c\212-c\272m"
-  "^n\177n~n~n~n~n~n\237n\374mocf\271\005\341\346\350\306\350\305\350\305\350"
-  "\306\350\306\350\305\350\345\350\345\350\345\350\345\350\346\350\346\350"
-  "\346\350\346\350\346\350\345\340\345\340\346\340%\321\207\251\015k\271e~n"
-  "\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\236n}nU\205+\326\244"
-  "\366\304\366\344\376\245\366\016\245\331};\206\027\216\324\225\226\205\272"
-  "m]n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232\201\232b\222\354b\232m^n~n\236n\236n~n~"
-  "n~n~n\333moc\206\241E\301\006\321\006\331\345\340\005\341\345\350\346\340\345\340"
-  "\006\341\006\351\006\341\006\341\006\341\346\340\346\340\006\331\006\321&\271F\241f\221"
-  "\310y\355bs\\\372m}n\177n\177n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n~n\236"
-  "n}n\\n\372uQ\235h\346\344\376\004\377\343\376\304\366\213\275s\235\360\265"
-  "m\316\221\276X\226\\v~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200"
-  "\232\200\232\200\232\200\232\200\232\200\232\200\232\201\232c\222-c\273e"
-  "\177n\236n\236n~n~n~n\236n\236n\034n\224\\jZ\211\202\353\232\014\253\253\262"
-  "\010\272\310\311\310\311f\301F\311f\311\207\301\310\271\011\262\010\262j\262"
-  "\252\252\354\232M\213\256\203\313bNS\366dxm\231u\272m\034n~n~n~n~n~n~n~n~"
-  "n~n~n~n~n~n~n~n~n~n~n~n^n]n\034n\372uv}\061\225*\326\344\366\003\377\003\377\343"
-  "\376\303\366\346\325)\326\250\356\313\346\266\266\234~~v~n~n~n~n\177n=n\201"
-  "\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200"
-  "\232\200\232\201\222\206\212\260[\374m\177n~n~n~n~n~n~n]n\332m\025emS\262"
-  "\224\327\275\027\306\226\275\262\244q\244Q\244\216\213m\213\317\223\020\234"
-  "Q\234\323\244\262\244\065\265\226\275\030\306\232\326\273\336\024\235\257c\224"
-  "d\223|V\245\025\225\026u\033n\236n~n~n~n~n~n~n~n~n~n~n~n~n\236n~n~n^n\034n\331"
-  "uw}\023\205\017\235k\265H\336\305\366\003\377\003\377\004\377\343\376\343\376\304"
-  "\366\344\366\305\366\251\346\223\266[\206~v~n~n~n~n\177n=n\201\232\201\232"
-  "\200\232\200\232\200\232\200\232\200\232\201\232\201\232\201\232\200\222"
-  "\201\222\250ztd<n~n~n\177n\177n~n]v\034n\027epC\253:\252JU\245<\347\236\367"
-  "\236\367}\357}\357]\357\272\326\232\326\034\347]\357]\357}\357}\357\236\367"
-  "\236\367\276\367\276\367\236\367\070\306\020|\021|\071\306<\357\033\347\065\235"
-  "\067m]n~n~n~n~n~n~n~n~n~n~n~n~n\236n\235n]n\271u\063\215.\255k\275\011\316g"
-  "\346\245\356\304\366\344\376\344\366\305\366\345\366\344\376\344\376\344"
-  "\376\344\376e\356\346\325\214\265\326\215\\v}n~n~n~n\177n=n\201\232\201\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\202\212\352j\067e]n~n~n=v=n\033n\230u\025\205\223\214\212R\247\061\010B\222\224"
-  "]\357\337\377\377\377\377\377\377\377\377\377\337\377\337\377\337\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377]\357"
-  "X\306Y\316}\357\337\377\235\367\266\265\224l\034n~n~n~v~n~n~n~n~n~n~n~n~n"
-  "~n}n\271up\245)\326\206\356\244\366\344\366\205\346G\336&\336\245\356e\346"
-  "\247\325'\336\245\356\344\376\344\376\344\376\344\366\304\356H\336\060\225"
-  "\331u<n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200"
-  "\232\200\232\200\232\200\232\200\232b\212\354bym~n\177n\035vyu\066}\365\204"
-  "v\245Y\316Y\316\317{\313Z\313J\317{\373\336\337\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\337\377\276\367\276\367\337\377\377\377"
-  "\276\367\030\306sl\374m~v\177n~n~n~n~n~n~n~n~n~n~n~n]nt\215J\326\304\366\343"
-  "\376\003\377\344\366E\336\305\315&\326\345\356\344\366f\346\246\315\005\336\304"
-  "\366\344\376\343\376\343\376\345\366\311\346\257\255Vm\034n~n~n~n\177n=n\201"
-  "\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232\201\232\201"
-  "\232\201\232b\212\311j\265d<n^v\272}V\235y\316\034\337]\357\236\367<\347\064"
-  "\245\357kr\\\020lX\316\276\367\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\276\367\030\306Sl\374"
-  "m~v~n~n~n~n~n~n~n~n~n~n~n~n=vS\225\210\346\004\377\003\377\003\377\343\376\304"
-  "\366\304\366\345\366\003\377\003\377\344\366\304\366\304\366\343\376\343\376"
-  "\343\376\304\366\211\336\222\276x\226[v}n~v~n~n\177n=n\201\232\201\232\200"
-  "\232\200\232\200\232\200\232\200\232\200\232\201\232\201\232\200\232\201"
-  "\222e\202\217[\272m\034v\271\215\030\266\373\336]\347\236\367\236\357\373\336"
-  "\024\225\066m\332m\265l\065\245<\347\337\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236\367\327\265"
-  "Sl\034n~n~n~n~n~n~n~n~n~n~n~n~n\236n=vV\205\013\316\305\356\344\366\344\366"
-  "\003\377\003\377\344\376\004\377\003\377\003\377\343\376\344\376\304\366\344\376\344"
-  "\376\304\376\205\356k\275\267\215|v\236n~v~v~n~n\177n=n\201\232\201\232\200"
-  "\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\201"
-  "\232b\222\353j\366l\367d\224l\224t\025\215\330\255z\306\071\306\065\235\026u"
-  "\034n}n\232mSt\370\275]\357\337\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\235\357\065\245\225l=n~n~n~n~n~n"
-  "~n~n~n~n~n~n~n\236n~n\373u\022\215\313\305H\336F\336\305\366\344\376\003\377"
-  "\003\377\003\377\004\367\344\366\205\356%\336\304\366\344\366e\346f\346\313\305"
-  "U\205=n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232a\222\311r\265d\231m\333"
-  "m\033v\033v\332uWu\026uXu\034v~n\236n=v\027es|\370\275]\347\337\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377<\347\223\214"
-  "\327d=n\236n~n\236n~n~n~n~n~n~n~n~n~n\236n\236f~f\333m\065}\361\214\356\234"
-  "\012\316\206\356\304\366\344\366\304\366\304\356\246\346\346\325\006\326\305"
-  "\356\347\356\011\316\014\306\062\266v}\035n~n\236n~n~n~n\177n=n\201\232\201\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232\201\222\207z\022\\\034n~n\236n\236n~n]n=n^v~n\177n\236n~n=nXest\267"
-  "\265\374\336\236\367\276\367\377\377\377\377\377\377\377\377\377\377\337"
-  "\377\236\367]\357]\357\276\367\377\377\377\377\377\377\377\377\377\377\276"
-  "\367y\316\062t\232m}n~n~n~n~n~n~n~n~n~n~n~n~n\236n\236n\236n~n]n\034n\271u"
-  "\024\205\016\245\311\315'\336&\336\346\315\345\315&\326h\336\252\336o\306\361"
-  "\245\264\225;\206<n^v~v~v~n~n~n\177n=n\201\232\201\232\200\232\200\232\200"
-  "\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\201\222\204"
-  "\212Mc\231e}n~n\236n\177n~n~n~n~v~n\236n\236n~n]nxe\224l\324\214\367\275"
-  "\272\326\034\347]\357}\357<\347\034\347\232\326\266\265\262\224\024\245\034\347"
-  "\337\377\377\377\377\377\377\377\377\377\236\367\267\265sl\374m~n~n~n~v~"
-  "n~n~n~n~n~n~n~n\177n\177n~n~n~n\236n\236n}n<n\231u\262tK\214\347\315\206"
-  "\346g\336\354\305\222\235\225\215\327}\270u\332m]n\236n\236n\236n~n~n~n~"
-  "n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232\201\232b\222\251r\224d\033n}n~n~n~n~n~n~"
-  "n~n~n~n~n~n]n\034n\231m\026ust\060|\363\234\065\245\363\234\363\234\363\234q"
-  "\214\353Z\060\204\034\347\337\377\377\377\377\377\377\377\377\377}\357\024\235"
-  "\265d=n~n~n~n~n~n~n~n~n~n\177n\177n\177n\177n\177n\177n~n~n\\v[~\\~\\v<n"
-  "\332u\362\214I\336\246\356\315\275\226\215\372u\032~:v<n]n~n~n~n~n~n~n~n~"
-  "n\177n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232\201\232a\232d\212\014c\026]]n~n~n~n~n~n~n"
-  "~n~n~n~v~n~n~n^n=n\231m\320cU\255Y\316\272\326\034\347<\347\232\326\317{\262"
-  "\224<\347\276\367\337\377\377\377\377\377\337\377]\357\222\214\067e]n~n~n"
-  "~n~n~n~n~n~n\177n\237n\177n\177n\237n\237n\177n\236n]n\025m\060\225\220\235"
-  "\224\215\330\205\227\205\216\265\206\356h\336S\235\267\205\326\225\262\245"
-  "q\225\230u=n~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232\200\232\201\232a\232a\222"
-  "\247z\062\\\374m~n~n~n~n~n~n~n~v~n~n~n~v~v^v]nye\361k\070\306\235\357\337\367"
-  "\337\377\337\377<\347\262\224\222\224\030\306y\316\373\336]\357}\357}\367"
-  "\333\336R|ye^n~n~n~n~n~n~n~n~n~n~n~n\236n\236n\237n\237n\236n=n\263l\212"
-  "\234\310\305*\316\255\265L\255h\346\304\366f\336\015\245\255\265K\326I\336"
-  "\312\315\321\204\333m~n~n~n~n~n~n~n~n\177n=n\201\232\201\232\200\232\200"
-  "\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232`\232"
-  "`\232a\232d\212\354b\367\\=n~n~n~n~n~n~v^n]n~n~n~v\034vym\366d\022\\q\214\373"
-  "\336\337\367\377\377\377\377\377\377\276\367Y\316\363\234Q\214q\214\262\224"
-  "\024\245U\255\327\275U\255\361c\272m~n~n~n~n~n~n~n~n~n^v\374m]v\236n\236n"
-  "\236n~n\236n]n\223l\352\244\307\305\307\305g\275&\336\344\366\343\376\305"
-  "\366\307\315G\275\247\305\207\305k\275\024\205<n\236n\236n~n~n~n~n~n~n\237"
-  "v=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232\200\232\200\232`\232`\232`\232\202\222\206z\220[\232e~n\236n~n~"
-  "n~v^n\333m\333m]n=n\373m\265d\061tQ\204\262\224Y\316\236\367\377\377\377\377"
-  "\377\377\377\377\377\377\276\367]\357\333\336\333\336\232\316\327\275\064"
-  "\245\262\224\360{\217c\067e\034n~n~n<n]n^n\034n<n~n\034vye<n\236n~n~n~v\236n"
-  "]f\027e\015|\011\255*\265\207\305\205\356\003\377\003\377\344\366e\346\306\254\250"
-  "\234\013\245\020\225\271}^v\236n\236n\236n~n]n]n^n~n\236n=n\201\232\201\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232`\232`\232`\232\201\232\203\212\211j\063d\231m=n~n~v]v<nXe\332m\332"
-  "mYe\225\\r\204Y\316<\347]\357\276\367\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\337\377\337\377\337\377\236\367}\357<\347\232"
-  "\326v\255r|\027e<n]nXe\333m\373uXe\333m<n\230m\231m<n^n~n~n~n\236n~n\374m"
-  "\325l\362\204\256\224\011\326\344\366\003\377\004\377\003\377\304\356I\265\257\204"
-  "\023\205\270}]v\236v\236n\236n~n]n\231e\272e>v~v~n=n\201\232\201\232\200\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "a\232a\232\201\232\200\232\201\222d\202\210rnc\027e\034n\373m\231e\272m\026"
-  "e\271m\326\\\325d\021l\070\306\235\357\337\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\337\377\337\377\276\367]\357]\357\232\316\025\225\272u\332m\224T\231"
-  "mXm\231m\034v\271m\067e\332m\332m\374m]n}n~n~n\177n~n=v\033v\024\205*\326\345"
-  "\366\003\367\003\377\004\377\305\356\214\265\266}\032v<n]n[~;~\\v]n\272m\366\\\373"
-  "m}n]v}n=n\201\232\201\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232\200\232\200\232\200\232`\232a\232a\232\200\232\200\232a\232B\222"
-  "e\212Mk\326d\265\\xe\027e\067e\325\\\321K\223d\263\224\033\347\337\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\276\367<\347\236\367<\347Y\316]\357\236\357Y\306"
-  "\026}\366ds\\XeXe\034n\333m\224\\\026exm\027e\034n]n\333m=n~n\177n\177n~n}nx}"
-  "\216\265\206\346\004\367\004\377\344\366F\336\014\245\063\215u\215v\215t\225\220"
-  "\255\257\265\222\235\230}\366d\232m]n<n\332m\\n<n\201\232\201\232\200\232"
-  "\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232\200\232"
-  "\200\232`\232\201\232\200\232\200\232a\232a\232b\222\206z\015[\022T\067e\063"
-  "\\\265\\\220CSL\366l\226\255\034\347\236\367\276\377\337\377\337\377\337\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "}\357\367\275<\347]\357\226\265\333\336\276\367\034\337\223\204\260[\021\\"
-  "S\\Wm\231m\224\\\062\\\264dS\\\265d\373m\373m\027e\273m^n~n\177n~n]v\373u\064"
-  "\205\253\305\245\356\344\376\206\346(\265K\245\353\305+\326K\336\212\346"
-  "\247\356G\336k\275\263|ym=v]v\271mxe<n<n\201\232\200\232\200\232a\232\201"
-  "\232\201\232\200\232\200\232\201\222\201\222\200\232\201\232\201\232\200"
-  "\232\200\232\201\222\201\222a\232a\232\201\232b\222\210j\361S\062TnKNC\014"
-  "C\323T\064]\222|T\255\367\275y\326\272\326\333\326\373\336<\357]\357}\357"
-  "}\357}\357\236\357\235\357\235\357\235\357\033\347u\255\272\326\373\336u\255"
-  "\030\306\333\336y\316\357s\212B\313:l;\017L\256;MC\060\\\256K\016D\363T\066]\264"
-  "TR\\\026e\332e<n\\n;~\367\215\267\205\227\205\255\265&\336\205\346\010\326"
-  "\220\245S\215\060\235\312\305f\346\245\356E\336\007\255,\214\365t\373m\033n\231"
-  "mWm\332m]n\034n\200\232\200\232\200\232\201\232a\222a\232a\232a\232\201\222"
-  "a\212\201\222\202\222\201\232\200\232\201\222\202\222B\202b\222\201\232\201"
-  "\232\201\232EziRjB\211\062\011+(#L,\315,K\064\013L\014T\355c\355c\315k\356s\060"
-  "|q\204\024\235\064\245\024\235U\255u\255u\255u\265\322\224\255kP|p\204\316k"
-  "\017t/t\315c);\010+h\033J\034\253$j$\311#\312\063\012$\253$\354,\214,+,+\064\316"
-  "\064Q=\264U\324\205\020\266L\326\254\275\316\214\212\265g\275g\305\213\265"
-  "\326\215\032~\271}\363\204\014\245H\275'\224)cn[\027uxm\326dt\\Xm\332m\333m"
-  "\272m\200\232\200\232\200\232\201\222B\212a\232a\232a\232b\222\"\202b\212"
-  "\203\212\201\232a\222A\212b\212\002rb\222\202\222\201\222\201\232c\202\004b%"
-  "b\246J\310+i\034\311\024\012\015\012\015\351\014\351\014\312\024\212\024j\034I$\011,"
-  "\012\064\352C\312C\252C\313K\313K\313K\253K\353C\012,J\064*,J,\212,\212$\212"
-  "\034\212\034\252\034\312\024\012\015*\015\011\015\351\014\352\014\352\014\012\015*\005\012"
-  "\015\352\024\351\024*\025\013-\313l\253\265H\326'\336\210\305(\265\250\305\211"
-  "\305\010\265\352\244Q\235\262\245\330\205\332m\025m\255cLS\360[\062\\\365d\325"
-  "dsdRT\066e\331e\031f\267]\201\232\201\232\201\232\202\222\"\202a\232\201\232"
-  "a\232C\212C\212C\212Bzb\222C\202\"zb\212\343ic\202\202\222\201\232\202\222"
-  "CzCzc\212dz\346Bj\034\012\025*\005*\005*\005J\005*\005\012\005\012\015\012\015\011\015\011\015\351"
-  "\014\351\014\311\014\311\014\311\014\311\014\251\014\352\014\012\015\012\015\012\005\012"
-  "\015\012\015\012\015\012\005\012\015\012\015*\005*\005\012\005\012\005\012\005\012\005\012\005*\005*\005*\005"
-  "*\005*\005*\015\352\064it\351\244\011\255\251\244\250\244h\305\351\325)\265\210"
-  "\244\010\255\311\315\012\306r\215\270m\325\\\257CqT\025e\223T\363T\024UoD\360"
-  "<\061=\321<\260\064\216,a\232\201\232a\232B\202B\202\201\222\201\232b\222#"
-  "zb\222b\212\002r#\202\003rDzC\202\303Y$rC\212b\222c\202\003bCzb\212C\202\004R'+\212"
-  "\034\012\015*\005*\005*\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005*\005*\005*\005*\005"
-  "*\005*\005)\005)\005)\005)\005)\005\012\005*\005)\005)\005)\005)\005)\005*\005)\005)\005)\005\012\035i<\350S\350"
-  "S\350S\010t\251\234)\255i\255\210\265\247\275\207\265\010\225ldoL\015\064l,\016"
-  "\065\016\065\355,\014%-%\353\034+\025\013\025\212\034\212\034\252\024b\222a\232b\212"
-  "#zc\202\201\222b\222#zCzb\212b\212\004r\344a\344QebEj\244Q\343iB\212b\212\003"
-  "b\343Ydr\204r\205ZEBF*\250\033\311\024*\005*\005*\005)\005)\005)\005)\005)\005)\005)\005)\005)\005"
-  ")\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005*\005"
-  ")\005)\005)\005)\005)\015\352\024\352\024\351\034\311\064\211T\211\\\250\\\250\\\310d"
-  "\351T\352<\352$\012\035\352\024\012\025K\015*\015*\015*\015*\005*\005*\005*\005\012\015\012\005"
-  "\352\004c\212b\212\004r\343ib\212b\232#\202%bejDjejfZ\205:&+\310\063h;fJErdzC"
-  "j\344Af:F;\347\063i,\351+h+i$\352\024*\005*\005*\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)"
-  "\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)\005)"
-  "\005)\005)\005)\005*\005*\005*\005*\005\012\015\011\025\011\035\011\025\011\025\011\025\011\015*\005*\005*"
-  "\005*\005*\005*\005*\005*\005*\005*\005*\005*\005*\005*\005*\005\352\004",
+    96, 96, IMAGE_RLE, 0, "Goodby Screen", NULL, coolImageData, 3385
 };
+
 // Close the Doxygen group.
 //! @}
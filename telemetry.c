@@ -0,0 +1,276 @@
+/*!
+ * \file telemetry.c
+ * \brief publishes heart rate, raw samples and health of every sensor as UDP datagrams
+ * The acquisition does nothing for the telemetry: the telemetry task reads the samples straight
+ * out of the sensor ring buffers behind the acquisition, with its own read index per sensor,
+ * and serializes them once into the datagram. If the task falls behind by almost a whole ring,
+ * the oldest samples are skipped and counted. Sending only starts once the NDK reports an IP
+ * address (see telemetry_ipAddrHook in application.cfg).
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/telemetry.h"
+#include "local_inc/heartrate.h"
+#include "local_inc/boot.h"
+
+#include <ti/ndk/inc/netmain.h>
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ defines ---
+//! \brief largest datagram without IP fragmentation on Ethernet
+#define TELEMETRY_DATAGRAM_SIZE 1472
+#define TELEMETRY_HEADER_SIZE 24
+#define TELEMETRY_SECTION_SIZE 36
+#define TELEMETRY_SAMPLE_SIZE 6
+//! \brief samples of one sensor that fit into one datagram
+#define TELEMETRY_MAX_SAMPLES (((TELEMETRY_DATAGRAM_SIZE - TELEMETRY_HEADER_SIZE) / HEARTRATE_SENSOR_COUNT \
+                               - TELEMETRY_SECTION_SIZE) / TELEMETRY_SAMPLE_SIZE)
+//! \brief slots of the ring the acquisition may fill while a section is copied
+#define TELEMETRY_RING_MARGIN (2 * HEARTRATE_FIFO_DEPTH)
+#define TELEMETRY_FLAG_MORE 0x01
+#define TELEMETRY_FLAG_PRESENT 0x01
+#define TELEMETRY_FLAG_TIMER 0x02
+// ------------------------------------------------------------------------------ globals ---
+//! \brief posted by the NDK as soon as the interface has an address
+static Semaphore_Handle linkSem;
+//! \brief ms between two datagrams
+static volatile uint32_t period = TELEMETRY_DEFAULT_PERIOD;
+//! \brief next sample of every ring buffer to send
+static uint16_t readIndex[HEARTRATE_SENSOR_COUNT];
+static uint8_t datagram[TELEMETRY_DATAGRAM_SIZE];
+static uint32_t sequence;
+// statistics
+static uint32_t datagramsSent;
+static uint32_t sendErrors;
+static uint32_t samplesSkipped;
+// ---------------------------------------------------------------------------- functions ---
+static void Telemetry_task(UArg arg0, UArg arg1);
+static uint16_t buildDatagram(bool *more);
+static uint8_t *putSection(uint8_t *data, const heartrateSensor *sensor, bool *more);
+static uint8_t *put16(uint8_t *data, uint16_t value);
+static uint8_t *put32(uint8_t *data, uint32_t value);
+static uint8_t *put64(uint8_t *data, uint64_t value);
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief create the telemetry task and initialize it with the necessary parameters.
+ * \param name xdc_String, identifying name of the task
+ * \param priority uint8_t initial priority of the task (1-15) 15 is highest priority
+ */
+extern void setup_Telemetry_task(xdc_String name, uint8_t priority)
+{
+    Task_Params taskParams;
+    Task_Handle task;
+    Semaphore_Params semParams;
+    Error_Block eb;
+
+    Error_init(&eb);
+    Semaphore_Params_init(&semParams);
+    linkSem = Semaphore_create(0, &semParams, &eb);
+    if (linkSem == NULL)
+    {
+        System_abort("Telemetry semaphore create failed");
+    }
+
+    Error_init(&eb);
+    Task_Params_init(&taskParams);
+    taskParams.instance->name = name;
+    taskParams.stackSize = 1024; /* stack in bytes */
+    taskParams.priority = priority; /* 0-15 (15 is highest priority on default -> see RTOS Task configuration) */
+
+    task = Task_create((Task_FuncPtr) Telemetry_task, &taskParams, &eb);
+    if (task == NULL)
+    {
+        System_abort("Telemetrytask create failed");
+    }
+}
+
+/*!
+ * \brief change the interval between two datagrams
+ * \param newPeriod ms between two datagrams, at least 1
+ */
+void telemetry_setPeriod(uint32_t newPeriod)
+{
+    period = newPeriod > 0 ? newPeriod : 1;
+}
+
+void telemetry_printStatistics(void)
+{
+    System_printf("Telemetry every %u ms: datagrams %u, send errors %u, skipped samples %u\n",
+                  period, datagramsSent, sendErrors, samplesSkipped);
+    System_flush();
+}
+
+/*!
+ * \brief NDK hook, called whenever an address is added to or removed from an interface
+ */
+void telemetry_ipAddrHook(unsigned int ipAddress, unsigned int ifIndex, unsigned int add)
+{
+    if (add)
+        Semaphore_post(linkSem);
+}
+
+/*!
+ * \brief waits for the network, then sends the datagrams every period
+ */
+static void Telemetry_task(UArg arg0, UArg arg1)
+{
+    struct sockaddr_in destination;
+    SOCKET sock;
+    int broadcast = 1;
+    uint16_t length;
+    bool more;
+    uint8_t i;
+
+    Semaphore_pend(linkSem, BIOS_WAIT_FOREVER);
+    // the read indices start at the newest samples, the sensors have to run for that
+    boot_wait(BOOT_SENSORS, BIOS_WAIT_FOREVER);
+
+    fdOpenSession(TaskSelf());
+    sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock == INVALID_SOCKET)
+    {
+        System_printf("Telemetry socket failed (%d)\n", fdError());
+        System_flush();
+        fdCloseSession(TaskSelf());
+        return;
+    }
+    setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast));
+
+    memset(&destination, 0, sizeof(destination));
+    destination.sin_family = AF_INET;
+    destination.sin_port = htons(TELEMETRY_PORT);
+    destination.sin_addr.s_addr = inet_addr(TELEMETRY_HOST);
+
+    // the first datagram starts with the newest samples
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
+        readIndex[i] = heartrate_getSensor(i)->writeIndex;
+
+    System_printf("Telemetry to %s:%u\n", TELEMETRY_HOST, TELEMETRY_PORT);
+    System_flush();
+
+    while (1)
+    {
+        Task_sleep(period);
+        do
+        {
+            length = buildDatagram(&more);
+            if (sendto(sock, datagram, length, 0, (PSA) &destination, sizeof(destination)) < 0)
+                sendErrors++;
+            else
+                datagramsSent++;
+        } while (more);
+    }
+}
+
+/*!
+ * \brief serialize the header and one section per sensor
+ * \param more set if not all pending samples fit into this datagram
+ * \return length of the datagram
+ */
+static uint16_t buildDatagram(bool *more)
+{
+    uint8_t *data = datagram;
+    uint8_t *flags;
+    uint8_t i;
+
+    *more = false;
+    data = put32(data, TELEMETRY_MAGIC);
+    data = put16(data, TELEMETRY_VERSION);
+    *data++ = HEARTRATE_SENSOR_COUNT;
+    flags = data++;
+    data = put32(data, sequence++);
+    data = put32(data, 0);  // skipped samples, known after the sections
+    data = put64(data, timestamp_now());
+
+    for (i = 0; i < HEARTRATE_SENSOR_COUNT; i++)
+        data = putSection(data, heartrate_getSensor(i), more);
+
+    *flags = *more ? TELEMETRY_FLAG_MORE : 0;
+    put32(&datagram[12], samplesSkipped);
+    return (uint16_t) (data - datagram);
+}
+
+/*!
+ * \brief health and the pending samples of one sensor, read directly from its ring buffer
+ */
+static uint8_t *putSection(uint8_t *data, const heartrateSensor *sensor, bool *more)
+{
+    uint16_t writeIndex = sensor->writeIndex;
+    uint16_t start = readIndex[sensor->id];
+    uint16_t pending = (uint16_t) (writeIndex - start);
+    uint16_t count;
+    uint16_t i;
+    uint8_t *countField;
+    const heartrateSample *first;
+    const heartrateSample *sample;
+
+    // fell behind too far, continue with the samples that are still safe to read
+    if (pending > HEARTRATE_RING_SIZE - TELEMETRY_RING_MARGIN)
+    {
+        samplesSkipped += pending - (HEARTRATE_RING_SIZE - TELEMETRY_RING_MARGIN);
+        pending = HEARTRATE_RING_SIZE - TELEMETRY_RING_MARGIN;
+        start = writeIndex - pending;
+    }
+    count = pending;
+    if (count > TELEMETRY_MAX_SAMPLES)
+    {
+        count = TELEMETRY_MAX_SAMPLES;
+        *more = true;
+    }
+
+    *data++ = sensor->id;
+    *data++ = (sensor->present ? TELEMETRY_FLAG_PRESENT : 0)
+            | (heartrate_getAcquisitionMode() == HEARTRATE_ACQUISITION_TIMER ? TELEMETRY_FLAG_TIMER : 0);
+    *data++ = sensor->estimator.lastBpm;
+    *data++ = sensor->estimator.lastQuality;
+    data = put32(data, sensor->bus.transfers);
+    data = put32(data, sensor->bus.retryCount);
+    data = put32(data, sensor->bus.failures);
+    data = put32(data, sensor->bus.recoveries);
+    data = put32(data, sensor->jitter.maxJitter);
+    countField = data;
+    data = put16(data, count);
+    data = put16(data, 0);
+
+    first = &sensor->ring[start & (HEARTRATE_RING_SIZE - 1)];
+    data = put64(data, count > 0 ? first->time : 0);
+    for (i = 0; i < count; i++)
+    {
+        sample = &sensor->ring[(uint16_t) (start + i) & (HEARTRATE_RING_SIZE - 1)];
+        data = put32(data, (uint32_t) (sample->time - first->time));
+        data = put16(data, sample->value);
+    }
+
+    // the acquisition overwrote the first samples while copying, drop them all
+    if ((uint16_t) (sensor->writeIndex - start) >= HEARTRATE_RING_SIZE)
+    {
+        samplesSkipped += count;
+        put16(countField, 0);
+        data = countField + 12;
+    }
+    readIndex[sensor->id] = start + count;
+    return data;
+}
+
+static uint8_t *put16(uint8_t *data, uint16_t value)
+{
+    *data++ = (uint8_t) value;
+    *data++ = (uint8_t) (value >> 8);
+    return data;
+}
+
+static uint8_t *put32(uint8_t *data, uint32_t value)
+{
+    data = put16(data, (uint16_t) value);
+    return put16(data, (uint16_t) (value >> 16));
+}
+
+static uint8_t *put64(uint8_t *data, uint64_t value)
+{
+    data = put32(data, (uint32_t) value);
+    return put32(data, (uint32_t) (value >> 32));
+}
+// End Doxygen group
+//! @}
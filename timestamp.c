@@ -0,0 +1,99 @@
+/*!
+ * \file timestamp.c
+ * \brief monotonic high resolution time base, based on the xdc Timestamp module
+ * The Timestamp module is backed by a hardware timer (TimestampProvider, see application.cfg),
+ * the 64 bit counter value gets converted into microseconds.
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include "local_inc/common.h"
+#include "local_inc/timestamp.h"
+
+#include <xdc/runtime/Types.h>
+#include <xdc/runtime/Timestamp.h>
+
+//! \addtogroup group_comm
+//! @{
+// ------------------------------------------------------------------------------ globals ---
+//! \brief timer ticks per microsecond, the system runs at 120 MHz -> 120
+static uint32_t ticksPerMicrosecond = 1;
+// ----------------------------------------------------------------------- implementation ---
+/*!
+ * \brief read the frequency of the timestamp provider, has to be called once before BIOS_start
+ */
+void timestamp_init(void)
+{
+    Types_FreqHz freq;
+
+    Timestamp_getFreq(&freq);
+    // the provider runs below 4 GHz, the upper word is always 0
+    ticksPerMicrosecond = freq.lo / TIMESTAMP_US_PER_SECOND;
+    if (ticksPerMicrosecond == 0)
+        System_abort("Timestamp provider too slow");
+}
+
+/*!
+ * \brief get the current time
+ * Safe to call from Hwi, Swi and Task context.
+ * \return microseconds since start of the timestamp provider
+ */
+timestamp_t timestamp_now(void)
+{
+    Types_Timestamp64 ticks;
+
+    Timestamp_get64(&ticks);
+    return (((uint64_t) ticks.hi << 32) | ticks.lo) / ticksPerMicrosecond;
+}
+
+/*!
+ * \brief clear all recorded latencies
+ * \param stats statistic to reset
+ */
+void latency_reset(latencyStats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->min = UINT32_MAX;
+}
+
+/*!
+ * \brief record the latency from a given origin until now
+ * \param stats statistic the latency is added to
+ * \param origin timestamp of the event the latency is measured from
+ */
+void latency_record(latencyStats *stats, timestamp_t origin)
+{
+    timestamp_t now = timestamp_now();
+
+    if (origin == 0 || origin > now)
+        return;     // no valid origin, nothing to measure
+    latency_add(stats, (uint32_t) (now - origin));
+}
+
+/*!
+ * \brief record a duration that was measured elsewhere, e.g. the sum of several pieces of work
+ * \param stats statistic the duration is added to
+ * \param latency duration in us
+ */
+void latency_add(latencyStats *stats, uint32_t latency)
+{
+    stats->last = latency;
+    if (latency < stats->min)
+        stats->min = latency;
+    if (latency > stats->max)
+        stats->max = latency;
+    stats->sum += latency;
+    stats->count++;
+}
+
+/*!
+ * \brief average of all recorded latencies
+ * \return average latency in us, 0 if nothing was recorded
+ */
+uint32_t latency_average(const latencyStats *stats)
+{
+    if (stats->count == 0)
+        return 0;
+    return (uint32_t) (stats->sum / stats->count);
+}
+// End Doxygen group
+//! @}
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Color table generator: writes the RGB888 to RGB565 channel tables to resources/color_table.h.
+
+Every 8 bit channel is looked up once, the red and blue table give the 5 bit value,
+the green table the 6 bit value. The channel is gamma corrected on the way,
+value = round((channel / 255) ** gamma * max), so equal steps of the 8 bit input
+give equal steps of brightness on the OLED, which emits linear to the pixel value.
+Full and zero channels stay untouched, so the named colors of the HAL are exact.
+
+    colortable.py [--gamma 2.2] [--output resources/color_table.h]
+
+A gamma of 1 gives the plain scaling round(channel * max / 255). The output is
+deterministic, run the tool again after changing the gamma and commit both files.
+"""
+
+import argparse
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_GAMMA = 2.2
+
+
+def channel_table(bits, gamma):
+    top = (1 << bits) - 1
+    return [int(round((value / 255.0) ** gamma * top)) for value in range(256)]
+
+
+def array(name, values):
+    lines = ['static const uint8_t %s[256] = {' % name]
+    for i in range(0, 256, 16):
+        lines.append('    ' + ','.join('0x%02X' % v for v in values[i:i + 16]) + ',')
+    lines.append('};')
+    return lines
+
+
+def generate(gamma):
+    out = ['/*! \\file color_table.h',
+           ' * \\brief RGB888 to RGB565 channel tables with gamma %g, generated by tools/colortable.py' % gamma,
+           ' * Do not edit, run tools/colortable.py instead. Only included by oled_hal.c.',
+           ' */',
+           '',
+           '//! \\addtogroup group_oled_res',
+           '//! @{',
+           '#ifndef COLOR_TABLE_H_',
+           '#define COLOR_TABLE_H_',
+           '#include "common.h"',
+           '',
+           '//! \\brief 8 bit red or blue channel to its 5 bit value']
+    out.extend(array('colorTable5', channel_table(5, gamma)))
+    out.append('//! \\brief 8 bit green channel to its 6 bit value')
+    out.extend(array('colorTable6', channel_table(6, gamma)))
+    out.append('')
+    out.append('#endif /* COLOR_TABLE_H_ */')
+    out.append('// Close the Doxygen group.')
+    out.append('//! @}')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--gamma', type=float, default=DEFAULT_GAMMA)
+    parser.add_argument('--output', default=os.path.join(ROOT, 'resources', 'color_table.h'))
+    args = parser.parse_args()
+    if args.gamma <= 0:
+        sys.exit('colortable: gamma must be positive')
+    with open(args.output, 'w') as output:
+        output.write(generate(args.gamma))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Sender of the framed UART commands of command.c.
+
+The frame layout is described in local_inc/command.h.
+
+    command.py [--port /dev/ttyACM0] [--baud 9600] COMMAND [ARGUMENTS] [COMMAND [ARGUMENTS] ...]
+
+All commands of one call go out in one frame, the board executes them in order
+and acknowledges them together, e.g.
+
+    command.py estimator 1 telemetry 100 heartrate 0
+
+The queues are numbered as '#5' prints them, 'queuepolicy 0 2' sets queue 0
+to drop the newest message (0 block, 1 drop oldest, 2 drop newest, 3 coalesce).
+The UART input and the bus queues refuse to block.
+
+A frame without acknowledgement is sent again. Needs pyserial.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+START = 0xA5
+BODY_SIZE = 64
+STATUS = {0: 'ok', 1: 'unknown command', 2: 'bad argument', 3: 'malformed'}
+# name: command id, argument layout, result layout
+COMMANDS = {
+    'ping': (0x01, '', ''),
+    'testcase': (0x02, '<B', ''),
+    'statistics': (0x03, '', ''),
+    'acquisition': (0x04, '<B', ''),
+    'history': (0x05, '', ''),
+    'recording': (0x06, '<B', ''),
+    'estimator': (0x07, '<B', ''),
+    'telemetry': (0x08, '<I', ''),
+    'heartrate': (0x09, '<B', '<BBHHB'),
+    'queue': (0x0A, '<B', '<BBBBIII'),
+    'queuepolicy': (0x0B, '<BB', ''),
+}
+RESULTS = {
+    0x09: ('bpm', 'quality', 'rmssd', 'sdnn', 'pnn50'),
+    0x0A: ('policy', 'depth', 'highwater', 'pending', 'posted', 'dropped', 'waited'),
+}
+
+
+def crc8(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def encode(sequence, commands):
+    """one frame of (name, arguments) pairs"""
+    body = bytes([sequence])
+    for name, values in commands:
+        command, layout, _ = COMMANDS[name]
+        arguments = struct.pack(layout, *values) if layout else b''
+        body += bytes([command, len(arguments)]) + arguments
+    if len(body) > BODY_SIZE:
+        raise ValueError('too many commands for one frame')
+    head = bytes([len(body)])
+    return bytes([START]) + head + body + bytes([crc8(head + body)])
+
+
+def decode(body):
+    """sequence number and (command, status, result) of every command of an acknowledgement"""
+    entries = []
+    offset = 1
+    while offset + 3 <= len(body):
+        command, status, length = body[offset:offset + 3]
+        entries.append((command, status, body[offset + 3:offset + 3 + length]))
+        offset += 3 + length
+    return body[0], entries
+
+
+def read_frame(port, deadline):
+    """body of the next frame with a valid CRC, None on timeout. Other output of the board is skipped"""
+    while time.monotonic() < deadline:
+        byte = port.read(1)
+        if not byte or byte[0] != START:
+            continue
+        head = port.read(1)
+        if not head or not 0 < head[0] <= BODY_SIZE:
+            continue
+        rest = port.read(head[0] + 1)
+        if len(rest) == head[0] + 1 and crc8(head + rest[:-1]) == rest[-1]:
+            return rest[:-1]
+    return None
+
+
+def parse(words):
+    commands = []
+    while words:
+        name = words.pop(0)
+        if name not in COMMANDS:
+            raise ValueError('unknown command %s' % name)
+        count = len(COMMANDS[name][1]) - 1 if COMMANDS[name][1] else 0
+        if len(words) < count:
+            raise ValueError('%s needs %u arguments' % (name, count))
+        commands.append((name, [int(words.pop(0), 0) for _ in range(count)]))
+    return commands
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--port', default='/dev/ttyACM0')
+    parser.add_argument('--baud', type=int, default=9600)
+    parser.add_argument('--timeout', type=float, default=0.5, help='seconds to wait for the acknowledgement')
+    parser.add_argument('--retries', type=int, default=3)
+    parser.add_argument('commands', nargs='+', help='%s' % ', '.join(COMMANDS))
+    args = parser.parse_args()
+    try:
+        commands = parse(args.commands)
+        sequence = int(time.monotonic() * 1000) & 0xFF
+        frame = encode(sequence, commands)
+    except (ValueError, struct.error) as error:
+        parser.error(error)
+
+    import serial
+    with serial.Serial(args.port, args.baud, timeout=0.05) as port:
+        for _ in range(args.retries + 1):
+            port.write(frame)
+            deadline = time.monotonic() + args.timeout
+            while True:
+                body = read_frame(port, deadline)
+                if body is None:
+                    break
+                acknowledged, entries = decode(body)
+                if acknowledged != sequence:
+                    continue
+                for (name, _), (command, status, result) in zip(commands, entries):
+                    line = '%-12s %s' % (name, STATUS.get(status, status))
+                    if status == 0 and command in RESULTS:
+                        values = struct.unpack(COMMANDS[name][2], result)
+                        line += '  ' + '  '.join('%s %u' % pair for pair in zip(RESULTS[command], values))
+                    print(line)
+                if len(entries) < len(commands):
+                    print('%u commands did not fit into the acknowledgement' % (len(commands) - len(entries)))
+                return 0
+        print('no acknowledgement', file=sys.stderr)
+        return 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""Font compiler: packs the glyphs of resources/font_array.h into resources/font_packed.h.
+
+font_array.h holds three full 256 glyph tables, most of them unused control codes
+and most rows empty. Only the given glyph ranges are packed, and of every glyph
+only the rows between the first and the last row with a set pixel are stored.
+An index gives the offset of the stored rows and the number of empty rows above
+them; font.c fills the empty rows with the background while expanding a glyph.
+Characters outside the ranges are drawn blank.
+
+    fontpack.py [--ranges 0x03,0x20-0x7E] [--input resources/font_array.h]
+                [--output resources/font_packed.h]
+
+The output is deterministic, run the tool again after changing font_array.h or
+the ranges and commit both files.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_RANGES = '0x03,0x20-0x7E'
+# longest range font.h can describe, fontRange.count is a uint8_t
+RANGE_MAX = 255
+# name in font_array.h, name of the descriptor in font.c, bytes per row, rows
+FONTS = (('font1', 'fontSmall', 1, 14),
+         ('font2', 'fontMedium', 2, 26),
+         ('font3', 'fontLarge', 3, 36))
+
+
+def parse_ranges(text):
+    """'0x03,0x20-0x7E' to a list of (first, count), sorted and merged.
+    The count of a range is 8 bit in font.h, all 256 codes become two ranges"""
+    codes = set()
+    for part in text.split(','):
+        first, _, last = part.strip().partition('-')
+        first = int(first, 0)
+        last = int(last, 0) if last else first
+        if not 0 <= first <= last <= 0xFF:
+            raise ValueError('illegal range %s' % part)
+        codes.update(range(first, last + 1))
+    ranges = []
+    for code in sorted(codes):
+        if ranges and ranges[-1][0] + ranges[-1][1] == code and ranges[-1][1] < RANGE_MAX:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([code, 1])
+    return [tuple(r) for r in ranges]
+
+
+def read_table(source, name, length):
+    """the 256 glyphs of one table as lists of bytes"""
+    match = re.search(r'\b%s\s*\[256\]\s*\[%d\]\s*=\s*\{' % (name, length), source)
+    if match is None:
+        raise ValueError('%s[256][%d] not found' % (name, length))
+    glyphs = []
+    position = match.end()
+    for row in re.finditer(r'\{([^{}]*)\}|\}', source[position:]):
+        if row.group(1) is None:
+            break
+        values = [int(v, 0) for v in row.group(1).split(',') if v.strip()]
+        if len(values) != length:
+            raise ValueError('%s glyph %d has %d bytes' % (name, len(glyphs), len(values)))
+        glyphs.append(values)
+    if len(glyphs) != 256:
+        raise ValueError('%s has %d glyphs' % (name, len(glyphs)))
+    return glyphs
+
+
+def pack(glyph, row_bytes, rows):
+    """(empty rows above, stored rows) of one glyph"""
+    lines = [glyph[i * row_bytes:(i + 1) * row_bytes] for i in range(rows)]
+    used = [i for i, line in enumerate(lines) if any(line)]
+    if not used:
+        return 0, []
+    return used[0], lines[used[0]:used[-1] + 1]
+
+
+def hex_bytes(values):
+    return ','.join('0x%02X' % v for v in values)
+
+
+def generate(source, ranges, range_text):
+    out = ['/*! \\file font_packed.h',
+           ' * \\brief packed glyphs of the three fonts, generated by tools/fontpack.py from font_array.h',
+           ' * Do not edit, run tools/fontpack.py instead. Glyph ranges: %s' % range_text,
+           ' */',
+           '',
+           '//! \\addtogroup group_oled_res',
+           '//! @{',
+           '#ifndef FONT_PACKED_H_',
+           '#define FONT_PACKED_H_',
+           '#include "font.h"',
+           '']
+    summary = []
+    for table, name, row_bytes, rows in FONTS:
+        glyphs = read_table(source, table, row_bytes * rows)
+        index = []
+        bitmap = []
+        stored = 0
+        range_lines = []
+        for first, count in ranges:
+            range_lines.append('    {0x%02X, %d, %d},' % (first, count, len(index)))
+            for code in range(first, first + count):
+                top, lines = pack(glyphs[code], row_bytes, rows)
+                index.append('    {%d, %d, %d},  // 0x%02X' % (stored, top, len(lines), code))
+                if lines:
+                    bitmap.append('    %s,  // 0x%02X' % (hex_bytes(sum(lines, [])), code))
+                stored += len(lines) * row_bytes
+        if stored > 0xFFFF:
+            raise ValueError('%s does not fit 16 bit offsets' % name)
+        size = stored + 4 * len(index) + 4 * len(ranges)
+        summary.append('%s: %d glyphs, %d bytes instead of %d' % (name, len(index), size, 256 * row_bytes * rows))
+        out.append('//! \\brief %s, %d glyphs, %d bytes of rows' % (name, len(index), stored))
+        out.append('static const fontRange %sRanges[] = {' % name)
+        out.extend(range_lines)
+        out.append('};')
+        out.append('static const fontGlyph %sGlyphs[] = {' % name)
+        out.extend(index)
+        out.append('};')
+        out.append('static const unsigned char %sBitmap[] = {' % name)
+        out.extend(bitmap)
+        out.append('};')
+        out.append('')
+    out.append('#endif /* FONT_PACKED_H_ */')
+    out.append('// Close the Doxygen group.')
+    out.append('//! @}')
+    return '\n'.join(out) + '\n', summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--ranges', default=DEFAULT_RANGES, help='glyph codes to keep, e.g. 0x03,0x20-0x7E')
+    parser.add_argument('--input', default=os.path.join(ROOT, 'resources', 'font_array.h'))
+    parser.add_argument('--output', default=os.path.join(ROOT, 'resources', 'font_packed.h'))
+    args = parser.parse_args()
+    try:
+        ranges = parse_ranges(args.ranges)
+        with open(args.input) as source:
+            text, summary = generate(source.read(), ranges, args.ranges)
+    except ValueError as error:
+        sys.exit('fontpack: %s' % error)
+    with open(args.output, 'w') as output:
+        output.write(text)
+    for line in summary:
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
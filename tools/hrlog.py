@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Reader for heart rate session recordings (HRxxxx.BIN) written by recorder.c.
+
+The format is described in local_inc/recorder_log.h: sector 0 is the session
+header, every further 512 byte sector is a self-contained block of records.
+Blocks are in time order, so seeking only reads block headers (binary search),
+the recording is never parsed from the start.
+
+    hrlog.py info HR0000.BIN
+    hrlog.py index HR0000.BIN
+    hrlog.py dump HR0000.BIN --from 600 --to 660
+
+tools/test_hrlog.py checks this reader against recorder_log.c on the host.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+SECTOR_SIZE = 512
+SESSION_MAGIC = 0x31535248
+BLOCK_MAGIC = 0x31425248
+BLOCK_HEADER = struct.Struct('<IIQHH')
+SESSION_HEADER = struct.Struct('<IHHHB5xQ')
+RECORD_HEADER = struct.Struct('<BBBxi')
+RECORD_SAMPLES = 1
+RECORD_BPM = 2
+
+
+def crc16(data):
+    """CRC-16/CCITT, polynomial 0x1021, initial value 0xFFFF"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+class Session:
+    """random access to the blocks of one recording"""
+
+    def __init__(self, path):
+        self.file = open(path, 'rb')
+        header = self.file.read(SECTOR_SIZE)
+        if len(header) < SESSION_HEADER.size:
+            raise ValueError('file too short')
+        (magic, self.version, sector_size, self.sample_rate,
+         self.sensor_count, self.start_time) = SESSION_HEADER.unpack_from(header)
+        if magic != SESSION_MAGIC:
+            raise ValueError('no session header')
+        if sector_size != SECTOR_SIZE:
+            raise ValueError('unsupported sector size %d' % sector_size)
+        # a block only counts once it is complete, a torn last sector is ignored
+        self.blocks = os.fstat(self.file.fileno()).st_size // SECTOR_SIZE - 1
+
+    def header(self, index):
+        """(sequence, base time, used, checksum) of a block, None if the sector is no block"""
+        self.file.seek((index + 1) * SECTOR_SIZE)
+        raw = self.file.read(BLOCK_HEADER.size)
+        magic, sequence, base_time, used, checksum = BLOCK_HEADER.unpack(raw)
+        if magic != BLOCK_MAGIC or sequence != index:
+            return None
+        return sequence, base_time, used, checksum
+
+    def records(self, index):
+        """decode all records of a block into (type, sensor, time, value or samples)"""
+        self.file.seek((index + 1) * SECTOR_SIZE)
+        raw = self.file.read(SECTOR_SIZE)
+        magic, sequence, base_time, used, checksum = BLOCK_HEADER.unpack_from(raw)
+        payload = raw[BLOCK_HEADER.size:BLOCK_HEADER.size + used]
+        if magic != BLOCK_MAGIC or crc16(payload) != checksum:
+            raise ValueError('block %d is damaged' % index)
+        offset = 0
+        while offset < used:
+            kind, sensor, value, delta = RECORD_HEADER.unpack_from(payload, offset)
+            offset += RECORD_HEADER.size
+            if kind == RECORD_SAMPLES:
+                samples = struct.unpack_from('<%dH' % value, payload, offset)
+                offset += 2 * value
+                yield kind, sensor, base_time + delta, samples
+            elif kind == RECORD_BPM:
+                yield kind, sensor, base_time + delta, value
+            else:
+                raise ValueError('unknown record %d in block %d' % (kind, index))
+
+    def seek(self, time):
+        """index of the last block starting at or before time, by binary search over headers"""
+        low, high = 0, self.blocks - 1
+        while low < high:
+            middle = (low + high + 1) // 2
+            header = self.header(middle)
+            if header is None or header[1] <= time:
+                low = middle
+            else:
+                high = middle - 1
+        return low
+
+
+def seconds(session, time):
+    return (time - session.start_time) / 1e6
+
+
+def info(session, args):
+    print('version %d, %d Hz, %d sensors, %d blocks' %
+          (session.version, session.sample_rate, session.sensor_count, session.blocks))
+    if session.blocks:
+        last = session.header(session.blocks - 1)
+        if last:
+            print('duration %.1f s' % seconds(session, last[1]))
+
+
+def index(session, args):
+    for block in range(session.blocks):
+        header = session.header(block)
+        if header is None:
+            print('%8d  damaged' % block)
+        else:
+            print('%8d  %10.3f s  %3d bytes' % (block, seconds(session, header[1]), header[2]))
+
+
+def dump(session, args):
+    begin = session.start_time + int(args.begin * 1e6)
+    end = session.start_time + int(args.end * 1e6) if args.end is not None else None
+    # samples in a block may be up to one FIFO read older than its base time, start one block early
+    block = max(session.seek(begin) - 1, 0)
+    period = 1e6 / session.sample_rate
+    for block in range(block, session.blocks):
+        header = session.header(block)
+        if header is None:
+            continue
+        if end is not None and header[1] > end + 1e6:
+            break
+        try:
+            records = list(session.records(block))
+        except ValueError as error:
+            print('# %s' % error, file=sys.stderr)
+            continue
+        for kind, sensor, time, value in records:
+            if kind == RECORD_BPM:
+                if begin <= time and (end is None or time <= end):
+                    print('%.6f,%d,bpm,%d' % (seconds(session, time), sensor, value))
+                continue
+            for i, sample in enumerate(value):
+                sample_time = time - (len(value) - 1 - i) * period
+                if begin <= sample_time and (end is None or sample_time <= end):
+                    print('%.6f,%d,raw,%d' % (seconds(session, sample_time), sensor, sample))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    commands = parser.add_subparsers(dest='command')
+    commands.required = True
+    for name, function in (('info', info), ('index', index), ('dump', dump)):
+        command = commands.add_parser(name)
+        command.add_argument('file')
+        command.set_defaults(function=function)
+        if name == 'dump':
+            command.add_argument('--from', dest='begin', type=float, default=0.0,
+                                 help='seconds after session start')
+            command.add_argument('--to', dest='end', type=float, help='seconds after session start')
+    args = parser.parse_args()
+    args.function(Session(args.file), args)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""Image asset converter: builds resources/logo.c with RGB565 images for the OLED display.
+
+The layout of the generated arrays is described in resources/image.h: pixels are
+RGB565 words in transfer byte order, rows top to bottom, every row left to right
+as seen on the display. They are stored raw, run length encoded or as indices
+into a palette, whatever is smallest (or as given with --encoding).
+
+    imgconv.py build [--encoding auto|raw|rle|palette] [--output resources/logo.c]
+                     NAME=SOURCE[:COMMENT] ...
+    imgconv.py export resources/logo.c NAME picture.ppm
+
+A SOURCE is a binary PPM, any picture Pillow can read (if installed), or a C file:
+either a GIMP C-source dump (16 bit, as the images were originally added) or a
+file generated by this tool, the image NAME is taken from it. So the images can
+be re-encoded or exported, edited and built again without the original pictures.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ENCODINGS = ('raw', 'rle', 'palette')
+RUN_FLAG = 0x8000
+MAX_RUN = 0x7FFF
+MIN_RUN = 3
+MAX_PALETTE = 256
+
+
+def rgb565(red, green, blue):
+    return (red >> 3) << 11 | (green >> 2) << 5 | blue >> 3
+
+
+def rgb888(color):
+    red, green, blue = color >> 11, (color >> 5) & 0x3F, color & 0x1F
+    return red << 3 | red >> 2, green << 2 | green >> 4, blue << 3 | blue >> 2
+
+
+def swap(color):
+    """RGB565 value to the word that is sent upper byte first from little endian memory"""
+    return (color >> 8) | (color & 0xFF) << 8
+
+
+# ----------------------------------------------------------------------------- sources ---
+def c_string(text):
+    """bytes of a C string literal body"""
+    escapes = {'n': 10, 't': 9, 'r': 13, '\\': 92, '"': 34, "'": 39, '?': 63, 'a': 7, 'b': 8, 'f': 12, 'v': 11}
+    out = bytearray()
+    i = 0
+    while i < len(text):
+        if text[i] != '\\':
+            out.append(ord(text[i]))
+            i += 1
+        elif text[i + 1] in '01234567':
+            j = i + 1
+            while j < i + 4 and j < len(text) and text[j] in '01234567':
+                j += 1
+            out.append(int(text[i + 1:j], 8))
+            i = j
+        else:
+            out.append(escapes[text[i + 1]])
+            i += 2
+    return bytes(out)
+
+
+def read_c(path, name):
+    """(width, height, pixels, comment) of an image in a GIMP dump or a generated file"""
+    with open(path) as source:
+        text = source.read()
+    match = re.search(r'const\s+image\s+%s\s*=\s*\{(.*?)\};' % re.escape(name), text, re.S)
+    if match is None:
+        raise ValueError('%s: no image %s' % (path, name))
+    body = match.group(1)
+    strings = re.findall(r'"((?:[^"\\]|\\.)*)"', body)
+    fields = [f.strip() for f in re.sub(r'"(?:[^"\\]|\\.)*"', '""', body).split(',')]
+    width, height = int(fields[0], 0), int(fields[1], 0)
+    if fields[2].startswith('IMAGE_'):
+        encoding = fields[2][len('IMAGE_'):].lower()
+        palette = None if fields[5] == 'NULL' else read_array(text, fields[5])
+        return width, height, decode(encoding, read_array(text, fields[6]), palette, width * height), strings[0]
+    # GIMP 16 bit dump: little endian RGB565
+    if int(fields[2], 0) != 2:
+        raise ValueError('%s: only 16 bit GIMP dumps are supported' % path)
+    data = b''.join(c_string(s) for s in strings[1:])
+    expected = width * height * 2
+    if len(data) < expected:
+        sys.stderr.write('%s: %s has %d of %d bytes, the rest is black\n' % (path, name, len(data), expected))
+        data += bytes(expected - len(data))
+    pixels = [data[i] | data[i + 1] << 8 for i in range(0, expected, 2)]
+    return width, height, pixels, strings[0]
+
+
+def read_array(text, name):
+    match = re.search(r'\b%s\s*\[\s*\]\s*=\s*\{(.*?)\};' % re.escape(name), text, re.S)
+    if match is None:
+        raise ValueError('array %s not found' % name)
+    body = re.sub(r'//[^\n]*', '', match.group(1))
+    return [int(v, 0) for v in body.split(',') if v.strip()]
+
+
+def read_ppm(path):
+    with open(path, 'rb') as source:
+        data = source.read()
+    tokens = []
+    position = 0
+    while len(tokens) < 4:
+        match = re.compile(rb'\s*(#[^\n]*\n\s*)*(\S+)').match(data, position)
+        if match is None:
+            raise ValueError('%s: broken PPM header' % path)
+        tokens.append(match.group(2))
+        position = match.end()
+    if tokens[0] != b'P6' or int(tokens[3]) != 255:
+        raise ValueError('%s: only binary PPM with 8 bit channels is supported' % path)
+    width, height = int(tokens[1]), int(tokens[2])
+    data = data[position + 1:]
+    return width, height, [(data[i], data[i + 1], data[i + 2]) for i in range(0, width * height * 3, 3)]
+
+
+def read_picture(path):
+    if path.lower().endswith(('.ppm', '.pnm')):
+        return read_ppm(path)
+    try:
+        from PIL import Image
+    except ImportError:
+        raise ValueError('%s: Pillow is needed for this format, or convert it to PPM' % path)
+    picture = Image.open(path).convert('RGB')
+    return picture.width, picture.height, list(picture.getdata())
+
+
+def load(source, name):
+    path, _, comment = source.partition(':')
+    if path.endswith('.c'):
+        width, height, pixels, original = read_c(path, name)
+        return width, height, pixels, comment or original
+    width, height, rgb = read_picture(path)
+    return width, height, [rgb565(*p) for p in rgb], comment or name
+
+
+# ---------------------------------------------------------------------------- encoding ---
+def rle(words):
+    """runs: RUN_FLAG | n followed by the word, literals: n followed by n words"""
+    out = []
+    literals = []
+
+    def flush():
+        while literals:
+            chunk = literals[:MAX_RUN]
+            del literals[:MAX_RUN]
+            out.append(len(chunk))
+            out.extend(chunk)
+
+    i = 0
+    while i < len(words):
+        run = 1
+        while i + run < len(words) and words[i + run] == words[i] and run < MAX_RUN:
+            run += 1
+        if run >= MIN_RUN:
+            flush()
+            out.extend((RUN_FLAG | run, words[i]))
+            i += run
+        else:
+            literals.append(words[i])
+            i += 1
+    flush()
+    return out
+
+
+def encode(pixels, encoding):
+    """(encoding, palette, data, size in bytes) of the pixels"""
+    words = [swap(p) for p in pixels]
+    candidates = []
+    if encoding in ('auto', 'raw'):
+        candidates.append(('raw', None, words, 2 * len(words)))
+    if encoding in ('auto', 'rle'):
+        data = rle(words)
+        candidates.append(('rle', None, data, 2 * len(data)))
+    if encoding in ('auto', 'palette'):
+        palette = sorted(set(words))
+        if len(palette) <= MAX_PALETTE:
+            lookup = {color: index for index, color in enumerate(palette)}
+            data = [lookup[w] for w in words]
+            candidates.append(('palette', palette, data, 2 * len(palette) + len(data)))
+        elif encoding == 'palette':
+            raise ValueError('%d colors do not fit a palette' % len(palette))
+    return min(candidates, key=lambda c: c[3])
+
+
+def decode(encoding, data, palette, count):
+    if encoding == 'raw':
+        words = list(data)
+    elif encoding == 'palette':
+        words = [palette[i] for i in data]
+    else:
+        words = []
+        i = 0
+        while i < len(data):
+            if data[i] & RUN_FLAG:
+                words.extend([data[i + 1]] * (data[i] & MAX_RUN))
+                i += 2
+            else:
+                words.extend(data[i + 1:i + 1 + data[i]])
+                i += 1 + data[i]
+    if len(words) != count:
+        raise ValueError('image decodes to %d of %d pixels' % (len(words), count))
+    return [swap(w) for w in words]
+
+
+# ----------------------------------------------------------------------------- output ---
+def identifier(name):
+    return re.sub(r'_(\w)', lambda m: m.group(1).upper(), name)
+
+
+def array(ctype, name, values, per_line, width):
+    lines = ['static const %s %s[] = {' % (ctype, name)]
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ','.join('0x%0*X' % (width, v) for v in values[i:i + per_line]) + ',')
+    lines.append('};')
+    return lines
+
+
+def build(args):
+    out = ['/*! \\file logo.c',
+           ' * \\brief images of the display, generated by tools/imgconv.py, do not edit',
+           ' * The encoding of the arrays is described in image.h.',
+           ' */',
+           '#include "image.h"',
+           '//! \\addtogroup group_oled_res',
+           '//! @{',
+           '']
+    for item in args.images:
+        name, _, source = item.partition('=')
+        if not source:
+            raise ValueError('%s: expected NAME=SOURCE' % item)
+        width, height, pixels, comment = load(source, name)
+        if not (0 < width <= 96 and 0 < height <= 96):
+            raise ValueError('%s: %dx%d does not fit the display' % (name, width, height))
+        encoding, palette, data, size = encode(pixels, args.encoding)
+        if decode(encoding, data, palette, len(pixels)) != pixels:
+            raise ValueError('%s: encoding does not round trip' % name)
+        base = identifier(name)
+        if palette:
+            out.extend(array('uint16_t', base + 'Palette', palette, 12, 4))
+        if encoding == 'palette':
+            out.extend(array('uint8_t', base + 'Data', data, 16, 2))
+        else:
+            out.extend(array('uint16_t', base + 'Data', data, 12, 4))
+        out.append('//! \\brief %s, %dx%d, %s, %d bytes' % (comment, width, height, encoding, size))
+        out.append('const image %s = {' % name)
+        out.append('    %d, %d, IMAGE_%s, %d, "%s", %s, %s, %d' %
+                   (width, height, encoding.upper(), len(palette) if palette else 0, comment.replace('"', '\\"'),
+                    base + 'Palette' if palette else 'NULL', base + 'Data', len(data)))
+        out.append('};')
+        out.append('')
+        print('%s: %dx%d %s, %d bytes instead of %d' % (name, width, height, encoding, size, 2 * len(pixels)))
+    out.append('// Close the Doxygen group.')
+    out.append('//! @}')
+    with open(args.output, 'w') as output:
+        output.write('\n'.join(out) + '\n')
+
+
+def export(args):
+    width, height, pixels, _ = read_c(args.file, args.name)
+    with open(args.picture, 'wb') as output:
+        output.write(b'P6\n%d %d\n255\n' % (width, height))
+        output.write(bytes(channel for p in pixels for channel in rgb888(p)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    commands = parser.add_subparsers(dest='command')
+    commands.required = True
+    command = commands.add_parser('build')
+    command.add_argument('--encoding', choices=('auto',) + ENCODINGS, default='auto')
+    command.add_argument('--output', default=os.path.join(ROOT, 'resources', 'logo.c'))
+    command.add_argument('images', nargs='+', metavar='NAME=SOURCE[:COMMENT]')
+    command.set_defaults(function=build)
+    command = commands.add_parser('export')
+    command.add_argument('file')
+    command.add_argument('name')
+    command.add_argument('picture')
+    command.set_defaults(function=export)
+    args = parser.parse_args()
+    try:
+        args.function(args)
+    except (ValueError, OSError) as error:
+        sys.exit('imgconv: %s' % error)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,158 @@
+/*!
+ * \file recorder_host.c
+ * \brief writes a recording with recorder_log.c on a host, against a file-backed recorderDevice
+ * The session is made up the way recorder.c fills it: FIFO reads of two sensors and their heart
+ * rates, a stretch where the card is busy and records are dropped, and a partially filled last
+ * block. Everything that went into the file is listed on stdout, test_hrlog.py compares it with
+ * what hrlog.py decodes.
+ *
+ *  cc -I local_inc -o recorder_host tools/recorder_host.c recorder_log.c
+ *  recorder_host HR0000.BIN
+ *
+ * stdout, one line each:
+ *  block SEQUENCE BASE_TIME USED
+ *  samples SENSOR TIME VALUE...
+ *  bpm SENSOR TIME VALUE
+ *  dropped SENSOR TIME
+ */
+
+// ----------------------------------------------------------------------------- includes ---
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "recorder_log.h"
+
+// ------------------------------------------------------------------------------ defines ---
+//! \brief sample rate stored in the session header
+#define HOST_SAMPLE_RATE 50
+//! \brief samples per FIFO read
+#define HOST_FIFO_SAMPLES 8
+#define HOST_SENSORS 2
+//! \brief FIFO reads of the whole session, per sensor
+#define HOST_READS 200
+//! \brief FIFO reads while the card is busy, their records find the block full and are dropped
+#define HOST_BUSY_FIRST 90
+#define HOST_BUSY_LAST 120
+//! \brief FIFO reads between two heart rates
+#define HOST_BPM_READS 6
+//! \brief session start in us, not 0 so offsets to it are tested
+#define HOST_START_TIME 5000000ULL
+
+// ---------------------------------------------------------------------------- functions ---
+static bool fileWrite(void *context, uint32_t sector, const void *data);
+static bool fileSync(void *context);
+static void flush(const recorderDevice *device, recorderBlock *block);
+static void fail(const char *message);
+// ----------------------------------------------------------------------- implementation ---
+int main(int argc, char **argv)
+{
+    recorderDevice device;
+    recorderSession session;
+    static recorderBlock block;
+    uint16_t values[HOST_FIFO_SAMPLES];
+    timestamp_t time;
+    FILE *file;
+    uint32_t read;
+    uint8_t sensor;
+    uint8_t i;
+    bool added;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s FILE\n", argv[0]);
+        return 2;
+    }
+    file = fopen(argv[1], "wb");
+    if (file == NULL)
+        fail("can not create the file");
+    device.context = file;
+    device.write = fileWrite;
+    device.sync = fileSync;
+
+    recorderLog_session(&session, HOST_SAMPLE_RATE, HOST_SENSORS, HOST_START_TIME);
+    if (!recorderLog_writeSession(&device, &session))
+        fail("can not write the session header");
+    recorderLog_beginBlock(&block, 0);
+
+    for (read = 0; read < HOST_READS; read++)
+    {
+        // the newest sample of a FIFO read, the sensors are read a little apart
+        time = HOST_START_TIME + (uint64_t) (read + 1) * HOST_FIFO_SAMPLES * 1000000 / HOST_SAMPLE_RATE;
+        for (sensor = 0; sensor < HOST_SENSORS; sensor++)
+        {
+            time += 137 * sensor;
+            for (i = 0; i < HOST_FIFO_SAMPLES; i++)
+                values[i] = (uint16_t) (read * 1000 + sensor * 100 + i);
+            added = recorderLog_addSamples(&block, sensor, time, values, HOST_FIFO_SAMPLES);
+            if (!added && read >= HOST_BUSY_FIRST && read <= HOST_BUSY_LAST)
+            {
+                // the other block is still on its way to the card, the full one has to wait
+                printf("dropped %u %" PRIu64 "\n", sensor, time);
+                continue;
+            }
+            if (!added)
+            {
+                flush(&device, &block);
+                if (!recorderLog_addSamples(&block, sensor, time, values, HOST_FIFO_SAMPLES))
+                    fail("samples do not fit into an empty block");
+            }
+            printf("samples %u %" PRIu64, sensor, time);
+            for (i = 0; i < HOST_FIFO_SAMPLES; i++)
+                printf(" %u", values[i]);
+            printf("\n");
+
+            if (read % HOST_BPM_READS == 0 && (read < HOST_BUSY_FIRST || read > HOST_BUSY_LAST))
+            {
+                if (!recorderLog_addBpm(&block, sensor, time, (uint8_t) (60 + read % 40)))
+                {
+                    flush(&device, &block);
+                    if (!recorderLog_addBpm(&block, sensor, time, (uint8_t) (60 + read % 40)))
+                        fail("a heart rate does not fit into an empty block");
+                }
+                printf("bpm %u %" PRIu64 " %u\n", sensor, time, 60 + read % 40);
+            }
+        }
+    }
+    // the last block is written partially filled, as by the flush timeout of recorder.c
+    if (block.used == 0 || block.used == RECORDER_PAYLOAD_SIZE)
+        fail("the session does not end with a partial block");
+    flush(&device, &block);
+    if (!device.sync(device.context) || fclose(file) != 0)
+        fail("can not close the file");
+    return 0;
+}
+
+/*!
+ * \brief seal and write a block, the next one follows in the next sector
+ */
+static void flush(const recorderDevice *device, recorderBlock *block)
+{
+    recorderLog_seal(block);
+    if (!recorderLog_writeBlock(device, block))
+        fail("can not write a block");
+    printf("block %" PRIu32 " %" PRIu64 " %u\n", block->sequence, block->baseTime, block->used);
+    recorderLog_beginBlock(block, block->sequence + 1);
+}
+
+/*!
+ * \brief recorderDevice on a stdio file, sectors are placed at their offset in the file
+ */
+static bool fileWrite(void *context, uint32_t sector, const void *data)
+{
+    FILE *file = (FILE *) context;
+
+    if (fseek(file, (long) sector * RECORDER_SECTOR_SIZE, SEEK_SET) != 0)
+        return false;
+    return fwrite(data, RECORDER_SECTOR_SIZE, 1, file) == 1;
+}
+
+static bool fileSync(void *context)
+{
+    return fflush((FILE *) context) == 0;
+}
+
+static void fail(const char *message)
+{
+    fprintf(stderr, "recorder_host: %s\n", message);
+    exit(1);
+}
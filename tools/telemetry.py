@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Receiver for the UDP telemetry of telemetry.c, with a loopback stand-in for the board.
+
+The datagram layout is described in local_inc/telemetry.h.
+
+    telemetry.py receive [--port 5005] [--raw]
+    telemetry.py loopback [--host 127.0.0.1] [--port 5005] [--period 0.2]
+
+'loopback' sends datagrams with the same layout from synthetic sensors, so the
+receiver (or any other consumer) can be tested without the board and without a
+network: run both on one machine.
+"""
+
+import argparse
+import math
+import socket
+import struct
+import time
+
+MAGIC = 0x31545248
+VERSION = 2
+PORT = 5005
+HEADER = struct.Struct('<IHBBIIQ')
+SECTION = struct.Struct('<BBBBIIIIIHxxQ')
+SAMPLE = struct.Struct('<IH')
+FLAG_MORE = 0x01
+FLAG_PRESENT = 0x01
+FLAG_TIMER = 0x02
+
+
+def decode(datagram):
+    """split a datagram into its header and one dictionary per sensor"""
+    magic, version, sensors, flags, sequence, skipped, sent = HEADER.unpack_from(datagram)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError('no telemetry datagram')
+    header = {'sequence': sequence, 'more': bool(flags & FLAG_MORE), 'skipped': skipped, 'time': sent}
+    offset = HEADER.size
+    sections = []
+    for _ in range(sensors):
+        (sensor, flags, bpm, quality, transfers, retries, failures, recoveries,
+         jitter, count, first) = SECTION.unpack_from(datagram, offset)
+        offset += SECTION.size
+        samples = []
+        for _ in range(count):
+            delta, value = SAMPLE.unpack_from(datagram, offset)
+            offset += SAMPLE.size
+            samples.append((first + delta, value))
+        sections.append({'sensor': sensor, 'present': bool(flags & FLAG_PRESENT),
+                         'timer': bool(flags & FLAG_TIMER), 'bpm': bpm, 'quality': quality,
+                         'transfers': transfers,
+                         'retries': retries, 'failures': failures, 'recoveries': recoveries,
+                         'jitter': jitter, 'samples': samples})
+    return header, sections
+
+
+def encode(sequence, skipped, now, sections, more=False):
+    """build a datagram like the board does, used by the loopback stand-in"""
+    data = HEADER.pack(MAGIC, VERSION, len(sections), FLAG_MORE if more else 0, sequence, skipped, now)
+    for section in sections:
+        samples = section['samples']
+        first = samples[0][0] if samples else 0
+        flags = (FLAG_PRESENT if section['present'] else 0) | (FLAG_TIMER if section['timer'] else 0)
+        data += SECTION.pack(section['sensor'], flags, section['bpm'], section['quality'], section['transfers'],
+                             section['retries'], section['failures'], section['recoveries'],
+                             section['jitter'], len(samples), first)
+        for sample_time, value in samples:
+            data += SAMPLE.pack(sample_time - first, value)
+    return data
+
+
+def receive(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(('', args.port))
+    expected = None
+    lost = 0
+    while True:
+        datagram, sender = sock.recvfrom(2048)
+        try:
+            header, sections = decode(datagram)
+        except (ValueError, struct.error) as error:
+            print('# %s from %s: %s' % (len(datagram), sender[0], error))
+            continue
+        if expected is not None and header['sequence'] != expected:
+            lost += (header['sequence'] - expected) & 0xFFFFFFFF
+        expected = (header['sequence'] + 1) & 0xFFFFFFFF
+        for section in sections:
+            print('%10.3f s  #%u  sensor %u  %3u bpm  %3u %%  %2u samples  i2c %u/%u/%u  rec %u  jitter %u us'
+                  '  skipped %u  lost %u' %
+                  (header['time'] / 1e6, header['sequence'], section['sensor'], section['bpm'], section['quality'],
+                   len(section['samples']), section['transfers'], section['retries'],
+                   section['failures'], section['recoveries'], section['jitter'],
+                   header['skipped'], lost))
+            if args.raw:
+                for sample_time, value in section['samples']:
+                    print('    %.6f,%u,%u' % (sample_time / 1e6, section['sensor'], value))
+
+
+def loopback(args):
+    """two synthetic sensors at 50 Hz with a 72 and 60 bpm pulse"""
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+    start = time.monotonic()
+    sent_until = 0.0
+    sequence = 0
+    transfers = 0
+    while True:
+        time.sleep(args.period)
+        now = time.monotonic() - start
+        times = [sent_until + (i + 1) * 0.02 for i in range(int((now - sent_until) / 0.02))]
+        if times:
+            sent_until = times[-1]
+        transfers += len(times) // 4 + 1
+        sections = []
+        for sensor, bpm in ((0, 72), (1, 60)):
+            samples = [(int(t * 1e6), int(40000 + 2000 * math.sin(2 * math.pi * bpm / 60 * t)))
+                       for t in times]
+            sections.append({'sensor': sensor, 'present': True, 'timer': False, 'bpm': bpm, 'quality': 100,
+                             'transfers': transfers, 'retries': 0, 'failures': 0, 'recoveries': 0,
+                             'jitter': 0, 'samples': samples})
+        sock.sendto(encode(sequence, 0, int(now * 1e6), sections), (args.host, args.port))
+        sequence += 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    commands = parser.add_subparsers(dest='command')
+    commands.required = True
+    command = commands.add_parser('receive')
+    command.add_argument('--port', type=int, default=PORT)
+    command.add_argument('--raw', action='store_true', help='print every sample')
+    command.set_defaults(function=receive)
+    command = commands.add_parser('loopback')
+    command.add_argument('--host', default='127.0.0.1')
+    command.add_argument('--port', type=int, default=PORT)
+    command.add_argument('--period', type=float, default=0.2, help='seconds between datagrams')
+    command.set_defaults(function=loopback)
+    args = parser.parse_args()
+    args.function(args)
+
+
+if __name__ == '__main__':
+    main()
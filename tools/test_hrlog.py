@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Host test of the recording format: recorder_log.c writes, hrlog.py reads.
+
+recorder_host.c is built with the host C compiler and writes a session through a
+file-backed recorderDevice, including a stretch of dropped records and a
+partially filled last block. The file is decoded with hrlog.py and compared
+with what the writer reported, seeking by time has to find the right block.
+
+    python3 tools/test_hrlog.py
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+
+TOOLS = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(TOOLS)
+sys.path.insert(0, TOOLS)
+
+import hrlog  # noqa: E402
+
+
+class RecordingTest(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.directory = tempfile.mkdtemp()
+        writer = os.path.join(cls.directory, 'recorder_host')
+        compiler = os.environ.get('CC', 'cc')
+        subprocess.check_call([compiler, '-std=c99', '-Wall', '-Werror', '-I', os.path.join(ROOT, 'local_inc'),
+                               '-o', writer, os.path.join(TOOLS, 'recorder_host.c'),
+                               os.path.join(ROOT, 'recorder_log.c')])
+        cls.path = os.path.join(cls.directory, 'HR0000.BIN')
+        output = subprocess.check_output([writer, cls.path], universal_newlines=True)
+        cls.blocks = []
+        cls.records = []
+        cls.dropped = []
+        for line in output.splitlines():
+            words = line.split()
+            values = [int(word) for word in words[1:]]
+            if words[0] == 'block':
+                cls.blocks.append(tuple(values))
+            elif words[0] == 'samples':
+                cls.records.append((hrlog.RECORD_SAMPLES, values[0], values[1], tuple(values[2:])))
+            elif words[0] == 'bpm':
+                cls.records.append((hrlog.RECORD_BPM, values[0], values[1], values[2]))
+            else:
+                cls.dropped.append(tuple(values))
+        cls.session = hrlog.Session(cls.path)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.session.file.close()
+        shutil.rmtree(cls.directory)
+
+    def test_session_header(self):
+        self.assertEqual(self.session.version, 1)
+        self.assertEqual(self.session.sample_rate, 50)
+        self.assertEqual(self.session.sensor_count, 2)
+        self.assertEqual(self.session.start_time, 5000000)
+        self.assertEqual(os.path.getsize(self.path), (len(self.blocks) + 1) * hrlog.SECTOR_SIZE)
+
+    def test_block_headers(self):
+        self.assertEqual(self.session.blocks, len(self.blocks))
+        for sequence, base_time, used in self.blocks:
+            self.assertEqual(self.session.header(sequence)[:3], (sequence, base_time, used))
+
+    def test_records(self):
+        decoded = []
+        for block in range(self.session.blocks):
+            decoded.extend(self.session.records(block))
+        self.assertEqual(decoded, self.records)
+
+    def test_dropped_records(self):
+        self.assertTrue(self.dropped)
+        # nothing of the busy stretch made it into the file, the block before it is full
+        first, last = self.dropped[0][1], self.dropped[-1][1]
+        self.assertFalse([record for record in self.records if first <= record[2] <= last])
+        before = [block for block in self.blocks if block[1] < first][-1]
+        self.assertGreater(before[2], hrlog.SECTOR_SIZE - hrlog.BLOCK_HEADER.size - 24)
+
+    def test_partial_block(self):
+        used = self.blocks[-1][2]
+        self.assertLess(used, hrlog.SECTOR_SIZE - hrlog.BLOCK_HEADER.size)
+        with open(self.path, 'rb') as file:
+            file.seek(len(self.blocks) * hrlog.SECTOR_SIZE + hrlog.BLOCK_HEADER.size + used)
+            self.assertEqual(file.read(), bytes(hrlog.SECTOR_SIZE - hrlog.BLOCK_HEADER.size - used))
+
+    def test_seek(self):
+        times = [block[1] for block in self.blocks]
+        self.assertEqual(self.session.seek(times[0] - 1), 0)
+        for index, time in enumerate(times):
+            self.assertEqual(self.session.seek(time), index)
+            self.assertEqual(self.session.seek(time + 1), index)
+            if index > 0:
+                self.assertEqual(self.session.seek(time - 1), index - 1)
+        # a time in the dropped stretch belongs to the last block before it
+        first = self.dropped[0][1]
+        self.assertEqual(self.session.seek(first), max(i for i, time in enumerate(times) if time <= first))
+        self.assertEqual(self.session.seek(times[-1] + 10 ** 9), len(times) - 1)
+
+    def test_damaged_block(self):
+        with open(self.path, 'rb') as file:
+            data = bytearray(file.read())
+        data[2 * hrlog.SECTOR_SIZE + hrlog.BLOCK_HEADER.size] ^= 0xFF
+        damaged = os.path.join(self.directory, 'damaged.BIN')
+        with open(damaged, 'wb') as file:
+            file.write(data)
+        session = hrlog.Session(damaged)
+        try:
+            with self.assertRaises(ValueError):
+                list(session.records(1))
+        finally:
+            session.file.close()
+
+
+if __name__ == '__main__':
+    unittest.main()